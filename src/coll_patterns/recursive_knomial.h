@@ -157,7 +157,8 @@ enum {
     UCC_KN_PHASE_INIT,
     UCC_KN_PHASE_LOOP,  /* main loop of recursive k-ing */
     UCC_KN_PHASE_EXTRA, /* recv from extra rank */
-    UCC_KN_PHASE_PROXY  /* recv from extra rank */
+    UCC_KN_PHASE_PROXY, /* recv from extra rank */
+    UCC_KN_PHASE_COPY   /* copy of the result by mc */
 };
 
 #define UCC_KN_CHECK_PHASE(_p)                                                 \
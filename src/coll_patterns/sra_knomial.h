@@ -76,6 +76,28 @@ static inline size_t ucc_sra_kn_compute_block_count(size_t     count,
     return block_count;
 }
 
+/* offset (in elements) of the block owned by rank at current iteration of
+   the pattern, i.e. the part of the buffer that rank and its peers of the
+   current iteration split between each other */
+static inline size_t ucc_sra_kn_compute_block_offset(size_t     count,
+                                                     ucc_rank_t rank,
+                                                     ucc_knomial_pattern_t *p)
+{
+    size_t     block_count  = count;
+    size_t     block_offset = 0;
+    ucc_rank_t k_pow        = 1;
+    ucc_rank_t i, my_si;
+
+    for (i = 0; i < p->iteration; i++) {
+        my_si = ucc_sra_kn_compute_seg_index(rank, k_pow, p);
+        block_offset +=
+            ucc_sra_kn_compute_seg_offset(block_count, p->radix, my_si);
+        block_count = ucc_sra_kn_compute_seg_size(block_count, p->radix, my_si);
+        k_pow *= p->radix;
+    }
+    return block_offset;
+}
+
 static inline void
 ucc_sra_kn_get_offset_and_seglen(size_t count, size_t dt_size, ucc_rank_t rank,
                                  ucc_rank_t size, ucc_kn_radix_t radix,
@@ -126,6 +126,48 @@ error:
     return UCC_ERR_NO_MEMORY;
 }
 
+ucc_status_t ucc_coll_score_dup(ucc_coll_score_t  *in,
+                                ucc_coll_score_t **out)
+{
+    ucc_coll_score_t *score;
+    ucc_status_t      status;
+    int               i, j;
+
+    status = ucc_coll_score_alloc(&score);
+    if (UCC_OK != status) {
+        return status;
+    }
+    for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+        for (j = 0; j < UCC_MEMORY_TYPE_LAST; j++) {
+            status = ucc_score_list_dup(&in->scores[i][j],
+                                        &score->scores[i][j]);
+            if (UCC_OK != status) {
+                ucc_coll_score_free(score);
+                return status;
+            }
+        }
+    }
+    *out = score;
+    return UCC_OK;
+}
+
+void ucc_coll_score_set_init(ucc_coll_score_t       *score,
+                             ucc_base_coll_init_fn_t init,
+                             ucc_base_team_t        *team)
+{
+    ucc_msg_range_t *range;
+    int              i, j;
+
+    for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+        for (j = 0; j < UCC_MEMORY_TYPE_LAST; j++) {
+            ucc_list_for_each(range, &score->scores[i][j], list_elem) {
+                range->init = init;
+                range->team = team;
+            }
+        }
+    }
+}
+
 static ucc_status_t ucc_coll_score_merge_one(ucc_list_link_t *list1,
                                              ucc_list_link_t *list2,
                                              ucc_list_link_t *out)
@@ -50,6 +50,17 @@ ucc_status_t  ucc_coll_score_add_range(ucc_coll_score_t *score,
    there */
 void          ucc_coll_score_free(ucc_coll_score_t *score);
 
+/* Allocates a copy of the score "in" with all its ranges */
+ucc_status_t  ucc_coll_score_dup(ucc_coll_score_t  *in,
+                                 ucc_coll_score_t **out);
+
+/* Makes every range of the score point to the given "init" fn and "team".
+   Used by CL to expose the score of its TLs as its own: ranges and score
+   values are preserved, the collective is dispatched via the CL. */
+void          ucc_coll_score_set_init(ucc_coll_score_t       *score,
+                                      ucc_base_coll_init_fn_t init,
+                                      ucc_base_team_t        *team);
+
 /* Merges 2 scores score1 and score2 into the new score "rst" selecting
    larger score. Ie.: rst will contain a range from score1 if either
    score of that range in score1 is larger than that of score2 or
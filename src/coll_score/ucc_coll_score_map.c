@@ -5,19 +5,79 @@
  */
 #include "ucc_coll_score.h"
 #include "utils/ucc_coll_utils.h"
+#include "utils/ucc_math.h"
+
+/* Flat copy of a msg range: only the fields needed for the lookup */
+typedef struct ucc_score_map_range {
+    size_t                  start;
+    size_t                  end;
+    ucc_base_coll_init_fn_t init;
+    ucc_base_team_t        *team;
+} ucc_score_map_range_t;
+
+typedef struct ucc_score_map_index {
+    uint32_t offset;
+    uint32_t n_ranges;
+} ucc_score_map_index_t;
+
+/* Immutable representation of the score built for the lookup. Ranges of
+   all coll_types/mem_types are packed into a single cache line aligned
+   array: ranges of a given coll_type/mem_type are contiguous and sorted
+   by start (score ranges never overlap), so the lookup is a binary search
+   over a few cache lines instead of a list walk. */
 typedef struct ucc_score_map {
-    ucc_coll_score_t *score;
+    ucc_coll_score_t      *score;
+    ucc_score_map_range_t *ranges;
+    ucc_score_map_index_t  index[UCC_COLL_TYPE_NUM][UCC_MEMORY_TYPE_LAST];
 } ucc_score_map_t;
 
 ucc_status_t ucc_coll_score_build_map(ucc_coll_score_t *score,
                                       ucc_score_map_t **map_p)
 {
-    ucc_score_map_t *map;
-    map = ucc_malloc(sizeof(*map), "ucc_score_map");
+    ucc_score_map_t       *map;
+    ucc_score_map_range_t *r;
+    ucc_msg_range_t       *range;
+    size_t                 n_ranges, size;
+    int                    i, j;
+
+    map = ucc_calloc(1, sizeof(*map), "ucc_score_map");
     if (!map) {
         ucc_error("failed to allocate %zd bytes for score map", sizeof(*map));
         return UCC_ERR_NO_MEMORY;
     }
+    n_ranges = 0;
+    for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+        for (j = 0; j < UCC_MEMORY_TYPE_LAST; j++) {
+            map->index[i][j].offset   = n_ranges;
+            map->index[i][j].n_ranges = ucc_list_length(&score->scores[i][j]);
+            n_ranges += map->index[i][j].n_ranges;
+        }
+    }
+    if (n_ranges > 0) {
+        size = ucc_align_up(n_ranges * sizeof(ucc_score_map_range_t),
+                            UCC_CACHE_LINE_SIZE);
+        if (0 != posix_memalign((void **)&map->ranges, UCC_CACHE_LINE_SIZE,
+                                size)) {
+            ucc_error("failed to allocate %zd bytes for score map ranges",
+                      size);
+            ucc_free(map);
+            return UCC_ERR_NO_MEMORY;
+        }
+    }
+    r = map->ranges;
+    for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+        for (j = 0; j < UCC_MEMORY_TYPE_LAST; j++) {
+            ucc_list_for_each(range, &score->scores[i][j], list_elem) {
+                ucc_assert(r == map->ranges + map->index[i][j].offset ||
+                           (r - 1)->end <= range->start);
+                r->start = range->start;
+                r->end   = range->end;
+                r->init  = range->init;
+                r->team  = range->team;
+                r++;
+            }
+        }
+    }
     map->score = score;
     *map_p     = map;
     return UCC_OK;
@@ -26,6 +86,7 @@ ucc_status_t ucc_coll_score_build_map(ucc_coll_score_t *score,
 void ucc_coll_score_free_map(ucc_score_map_t *map)
 {
     ucc_coll_score_free(map->score);
+    ucc_free(map->ranges);
     ucc_free(map);
 }
 
@@ -34,11 +95,12 @@ ucc_status_t ucc_coll_score_map_lookup(ucc_score_map_t         *map,
                                        ucc_base_coll_init_fn_t *init,
                                        ucc_base_team_t        **team)
 {
-    ucc_memory_type_t mt      = ucc_coll_args_mem_type(bargs);
-    unsigned          ct      = ucc_ilog2(bargs->args.coll_type);
-    size_t            msgsize = ucc_coll_args_msgsize(bargs);
-    ucc_list_link_t  *list;
-    ucc_msg_range_t  *range;
+    ucc_memory_type_t      mt      = ucc_coll_args_mem_type(bargs);
+    unsigned               ct      = ucc_ilog2(bargs->args.coll_type);
+    size_t                 msgsize = ucc_coll_args_msgsize(bargs);
+    ucc_score_map_range_t *ranges;
+    uint32_t               lo, hi, mid;
+
     if (mt == UCC_MEMORY_TYPE_ASSYMETRIC) {
         /* TODO */
         return UCC_ERR_NOT_SUPPORTED;
@@ -53,13 +115,22 @@ ucc_status_t ucc_coll_score_map_lookup(ucc_score_map_t         *map,
            range [0:inf]) */
         msgsize = 0;
     }
-    list = &map->score->scores[ct][mt];
-    ucc_list_for_each(range, list, list_elem) {
-        if (msgsize >= range->start && msgsize < range->end) {
-            *init = range->init;
-            *team = range->team;
-            return UCC_OK;
+    ranges = map->ranges + map->index[ct][mt].offset;
+    /* find the last range with start <= msgsize */
+    lo     = 0;
+    hi     = map->index[ct][mt].n_ranges;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (ranges[mid].start <= msgsize) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
-    return UCC_ERR_NOT_FOUND;
+    if (lo == 0 || msgsize >= ranges[lo - 1].end) {
+        return UCC_ERR_NOT_FOUND;
+    }
+    *init = ranges[lo - 1].init;
+    *team = ranges[lo - 1].team;
+    return UCC_OK;
 }
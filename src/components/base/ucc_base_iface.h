@@ -87,6 +87,12 @@ typedef struct ucc_base_team_params {
     ucc_rank_t        rank; /* Rank of a calling process in the TL/CL team. It is a uniq
                                process identifier within a team (not job) but it has the
                                property: it is always contig and in the range [0, team_size).*/
+    ucc_rank_t        size; /* Size of the TL/CL team. Can be smaller than the core
+                               team size when a CL creates TL teams over a subset
+                               of the core team processes */
+    ucc_ep_map_t      map;  /* Map from the TL/CL team ranks to the core team ranks.
+                               UCC_EP_MAP_FULL when the team spans the whole core
+                               team */
     uint16_t          id;   /* core level team id */
     ucc_team_t *      team; /* core team pointer */
 } ucc_base_team_params_t;
@@ -44,10 +44,6 @@ ucc_status_t ucc_cl_basic_team_create_test(ucc_base_team_t *cl_team);
 
 ucc_status_t ucc_cl_basic_team_destroy(ucc_base_team_t *cl_team);
 
-ucc_status_t ucc_cl_basic_coll_init(ucc_base_coll_args_t *coll_args,
-                                    ucc_base_team_t *team,
-                                    ucc_coll_task_t **task);
-
 ucc_status_t ucc_cl_basic_team_get_scores(ucc_base_team_t   *cl_team,
                                           ucc_coll_score_t **score);
 UCC_CL_IFACE_DECLARE(basic, BASIC);
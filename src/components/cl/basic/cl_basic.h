@@ -48,6 +48,7 @@ typedef struct ucc_cl_basic_team {
     ucc_team_multiple_req_t *team_create_req;
     ucc_tl_team_t          **tl_teams;
     unsigned                 n_tl_teams;
+    ucc_coll_score_t        *score; /* merged TL score, owned by score_map */
     ucc_score_map_t         *score_map;
 } ucc_cl_basic_team_t;
 UCC_CLASS_DECLARE(ucc_cl_basic_team_t, ucc_base_context_t *,
@@ -56,4 +57,8 @@ UCC_CLASS_DECLARE(ucc_cl_basic_team_t, ucc_base_context_t *,
 #define UCC_CL_BASIC_TEAM_CTX(_team)                                           \
     (ucc_derived_of((_team)->super.super.context, ucc_cl_basic_context_t))
 
+ucc_status_t ucc_cl_basic_coll_init(ucc_base_coll_args_t *coll_args,
+                                    ucc_base_team_t *team,
+                                    ucc_coll_task_t **task);
+
 #endif
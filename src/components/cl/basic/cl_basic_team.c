@@ -151,7 +151,8 @@ ucc_status_t ucc_cl_basic_team_create_test(ucc_base_team_t *cl_team)
             }
             score = score_merge;
         }
-        status = ucc_coll_score_build_map(score, &team->score_map);
+        team->score = score;
+        status      = ucc_coll_score_build_map(score, &team->score_map);
         if (UCC_OK != status) {
             cl_error(ctx->super.super.lib, "failed to build score map");
         }
@@ -159,8 +160,22 @@ ucc_status_t ucc_cl_basic_team_create_test(ucc_base_team_t *cl_team)
     return status;
 }
 
-ucc_status_t ucc_cl_basic_team_get_scores(ucc_base_team_t *cl_team, /* NOLINT */
-                                          ucc_coll_score_t **score) /* NOLINT */
+/* CL basic does not implement any algorithms itself: its score is the
+   merged score of its TL teams, with every range pointing to the CL init
+   so that the core selection dispatches through the CL team */
+ucc_status_t ucc_cl_basic_team_get_scores(ucc_base_team_t   *cl_team,
+                                          ucc_coll_score_t **score_p)
 {
-    return UCC_ERR_NOT_IMPLEMENTED;
+    ucc_cl_basic_team_t *team = ucc_derived_of(cl_team, ucc_cl_basic_team_t);
+    ucc_coll_score_t    *score;
+    ucc_status_t         status;
+
+    status = ucc_coll_score_dup(team->score, &score);
+    if (UCC_OK != status) {
+        cl_error(cl_team->context->lib, "failed to dup score");
+        return status;
+    }
+    ucc_coll_score_set_init(score, ucc_cl_basic_coll_init, cl_team);
+    *score_p = score;
+    return UCC_OK;
 }
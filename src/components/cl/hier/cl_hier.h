@@ -0,0 +1,107 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_CL_HIER_H_
+#define UCC_CL_HIER_H_
+#include "components/cl/ucc_cl.h"
+#include "components/cl/ucc_cl_log.h"
+#include "components/tl/ucc_tl.h"
+#include "coll_score/ucc_coll_score.h"
+#include "utils/ucc_mpool.h"
+
+#ifndef UCC_CL_HIER_DEFAULT_SCORE
+#define UCC_CL_HIER_DEFAULT_SCORE 50
+#endif
+
+/* Hierarchical allreduce and bcast win for latency bound messages, where
+   only one process per node takes part in the inter-node step. Larger
+   messages are bandwidth bound, there the flat algorithms of the TLs that
+   use all the processes are better, so hier reports no score for them */
+#define UCC_CL_HIER_ALLREDUCE_MAX_MSG (16 * 1024)
+#define UCC_CL_HIER_BCAST_MAX_MSG     (32 * 1024)
+
+#define UCC_CL_HIER_SUPPORTED_COLLS                                            \
+    (UCC_COLL_TYPE_ALLREDUCE | UCC_COLL_TYPE_BCAST | UCC_COLL_TYPE_BARRIER)
+
+typedef struct ucc_cl_hier_iface {
+    ucc_cl_iface_t super;
+} ucc_cl_hier_iface_t;
+/* Extern iface should follow the pattern: ucc_cl_<cl_name> */
+extern ucc_cl_hier_iface_t ucc_cl_hier;
+
+typedef struct ucc_cl_hier_lib_config {
+    ucc_cl_lib_config_t super;
+} ucc_cl_hier_lib_config_t;
+
+typedef struct ucc_cl_hier_context_config {
+    ucc_cl_context_config_t super;
+} ucc_cl_hier_context_config_t;
+
+typedef struct ucc_cl_hier_lib {
+    ucc_cl_lib_t super;
+} ucc_cl_hier_lib_t;
+UCC_CLASS_DECLARE(ucc_cl_hier_lib_t, const ucc_base_lib_params_t *,
+                  const ucc_base_config_t *);
+
+typedef struct ucc_cl_hier_context {
+    ucc_cl_context_t   super;
+    ucc_tl_context_t **tl_ctxs;
+    unsigned           n_tl_ctxs;
+    ucc_mpool_t        sched_mp;
+} ucc_cl_hier_context_t;
+UCC_CLASS_DECLARE(ucc_cl_hier_context_t, const ucc_base_context_params_t *,
+                  const ucc_base_config_t *);
+
+/* Subgroups of the hier team. The id of the subgroup is used as scope_id
+   of the TL teams created over it. */
+typedef enum {
+    UCC_CL_HIER_SBGP_NODE,         /* processes of the team on the same host */
+    UCC_CL_HIER_SBGP_NODE_LEADERS, /* one process (lowest team rank) per host */
+    UCC_CL_HIER_SBGP_LAST
+} ucc_cl_hier_sbgp_type_t;
+
+typedef enum {
+    UCC_CL_HIER_SBGP_NOT_EXISTS, /* calling process is not a member */
+    UCC_CL_HIER_SBGP_TRIVIAL,    /* calling process is the only member */
+    UCC_CL_HIER_SBGP_ENABLED
+} ucc_cl_hier_sbgp_state_t;
+
+typedef struct ucc_cl_hier_sbgp {
+    ucc_cl_hier_sbgp_state_t state;
+    ucc_rank_t               size;
+    ucc_rank_t               rank;
+    ucc_rank_t              *rank_array; /* storage of ARRAY map, can be NULL */
+    ucc_ep_map_t             map;        /* sbgp rank -> team rank */
+    ucc_tl_team_t          **tl_teams;
+    unsigned                 n_tl_teams;
+    ucc_score_map_t         *score_map;
+} ucc_cl_hier_sbgp_t;
+
+typedef struct ucc_cl_hier_team {
+    ucc_cl_team_t            super;
+    ucc_team_multiple_req_t *team_create_req;
+    ucc_rank_t               size;
+    ucc_rank_t               rank;
+    ucc_rank_t              *node_ids; /* team rank -> node id, node id is the
+                                          rank of the node in NODE_LEADERS */
+    ucc_cl_hier_sbgp_t       sbgps[UCC_CL_HIER_SBGP_LAST];
+} ucc_cl_hier_team_t;
+UCC_CLASS_DECLARE(ucc_cl_hier_team_t, ucc_base_context_t *,
+                  const ucc_base_team_params_t *);
+
+#define UCC_CL_HIER_TEAM_CTX(_team)                                            \
+    (ucc_derived_of((_team)->super.super.context, ucc_cl_hier_context_t))
+
+#define UCC_CL_HIER_TEAM_LIB(_team) ((_team)->super.super.context->lib)
+
+#define UCC_CL_HIER_SBGP_ENABLED(_team, _type)                                 \
+    (UCC_CL_HIER_SBGP_ENABLED == (_team)->sbgps[_type].state)
+
+#define UCC_CL_HIER_IS_NODE_LEADER(_team)                                      \
+    (UCC_CL_HIER_SBGP_NOT_EXISTS !=                                            \
+     (_team)->sbgps[UCC_CL_HIER_SBGP_NODE_LEADERS].state)
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "cl_hier.h"
+#include "cl_hier_coll.h"
+
+/* Two-level allreduce:
+   1. reduce to the node leader (node rank 0) inside the node
+   2. allreduce of the node results among the node leaders, in place in dst
+   3. bcast of the result from the node leader inside the node
+   Steps 1 and 3 are skipped if the process is alone on its node,
+   step 2 is only executed by the node leaders. */
+ucc_status_t ucc_cl_hier_allreduce_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task)
+{
+    ucc_cl_hier_team_t     *cl_team  = ucc_derived_of(team, ucc_cl_hier_team_t);
+    int                     has_node =
+        UCC_CL_HIER_SBGP_ENABLED(cl_team, UCC_CL_HIER_SBGP_NODE);
+    ucc_cl_hier_schedule_t *schedule;
+    ucc_base_coll_args_t    args;
+    ucc_status_t            status;
+
+    schedule = ucc_cl_hier_get_schedule(cl_team);
+    if (ucc_unlikely(!schedule)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    if (has_node) {
+        args                = *coll_args;
+        args.args.coll_type = UCC_COLL_TYPE_REDUCE;
+        args.args.root      = 0;
+        if (UCC_IS_INPLACE(coll_args->args) &&
+            !UCC_CL_HIER_IS_NODE_LEADER(cl_team)) {
+            /* data is in dst: non-root ranks send it as src */
+            args.args.src.info  = args.args.dst.info;
+            args.args.flags    &= ~UCC_COLL_ARGS_FLAG_IN_PLACE;
+        }
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE, &args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    if (UCC_CL_HIER_IS_NODE_LEADER(cl_team)) {
+        args = *coll_args;
+        if (has_node) {
+            /* node result is already in dst */
+            args.args.mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+            args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+        }
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE_LEADERS, &args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    if (has_node) {
+        args                = *coll_args;
+        args.args.coll_type = UCC_COLL_TYPE_BCAST;
+        args.args.root      = 0;
+        args.args.src.info  = args.args.dst.info;
+        args.args.flags    &= ~UCC_COLL_ARGS_FLAG_IN_PLACE;
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE, &args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    ucc_cl_hier_schedule_ready(schedule);
+    *task = &schedule->super.super;
+    return UCC_OK;
+err:
+    ucc_cl_hier_schedule_finalize(&schedule->super.super);
+    return status;
+}
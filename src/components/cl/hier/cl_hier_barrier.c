@@ -0,0 +1,57 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "cl_hier.h"
+#include "cl_hier_coll.h"
+
+/* Two-level barrier: node barrier, barrier among the node leaders, node
+   barrier. TLs do not provide fanin/fanout so the node level runs a full
+   barrier on both sides: the 1st one tells the leader that all the node
+   processes have entered, the 2nd one releases them once the leader is
+   done with the inter-node step. */
+ucc_status_t ucc_cl_hier_barrier_init(ucc_base_coll_args_t *coll_args,
+                                      ucc_base_team_t      *team,
+                                      ucc_coll_task_t     **task)
+{
+    ucc_cl_hier_team_t     *cl_team  = ucc_derived_of(team, ucc_cl_hier_team_t);
+    int                     has_node =
+        UCC_CL_HIER_SBGP_ENABLED(cl_team, UCC_CL_HIER_SBGP_NODE);
+    ucc_cl_hier_schedule_t *schedule;
+    ucc_status_t            status;
+
+    schedule = ucc_cl_hier_get_schedule(cl_team);
+    if (ucc_unlikely(!schedule)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    if (has_node) {
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE, coll_args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    if (UCC_CL_HIER_IS_NODE_LEADER(cl_team)) {
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE_LEADERS,
+                                          coll_args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    if (has_node) {
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE, coll_args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    ucc_cl_hier_schedule_ready(schedule);
+    *task = &schedule->super.super;
+    return UCC_OK;
+err:
+    ucc_cl_hier_schedule_finalize(&schedule->super.super);
+    return status;
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "cl_hier.h"
+#include "cl_hier_coll.h"
+
+static inline ucc_rank_t ucc_cl_hier_sbgp_rank(ucc_cl_hier_sbgp_t *sbgp,
+                                               ucc_rank_t          team_rank)
+{
+    ucc_rank_t i;
+
+    for (i = 0; i < sbgp->size; i++) {
+        if (ucc_ep_map_eval(sbgp->map, i) == team_rank) {
+            break;
+        }
+    }
+    ucc_assert(i < sbgp->size);
+    return i;
+}
+
+/* Two-level bcast:
+   1. on the node of the root: bcast from the root inside the node
+   2. bcast among the node leaders from the leader of the root node
+   3. on the other nodes: bcast from the node leader inside the node */
+ucc_status_t ucc_cl_hier_bcast_init(ucc_base_coll_args_t *coll_args,
+                                    ucc_base_team_t      *team,
+                                    ucc_coll_task_t     **task)
+{
+    ucc_cl_hier_team_t     *cl_team   = ucc_derived_of(team, ucc_cl_hier_team_t);
+    ucc_rank_t              root      = coll_args->args.root;
+    ucc_rank_t              root_node = cl_team->node_ids[root];
+    int                     root_local =
+        (root_node == cl_team->node_ids[cl_team->rank]);
+    int                     has_node  =
+        UCC_CL_HIER_SBGP_ENABLED(cl_team, UCC_CL_HIER_SBGP_NODE);
+    ucc_cl_hier_schedule_t *schedule;
+    ucc_base_coll_args_t    args;
+    ucc_status_t            status;
+
+    schedule = ucc_cl_hier_get_schedule(cl_team);
+    if (ucc_unlikely(!schedule)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    if (has_node && root_local) {
+        args           = *coll_args;
+        args.args.root = ucc_cl_hier_sbgp_rank(
+            &cl_team->sbgps[UCC_CL_HIER_SBGP_NODE], root);
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE, &args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    if (UCC_CL_HIER_IS_NODE_LEADER(cl_team)) {
+        args           = *coll_args;
+        args.args.root = root_node;
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE_LEADERS, &args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    if (has_node && !root_local) {
+        args           = *coll_args;
+        args.args.root = 0;
+        status = ucc_cl_hier_schedule_add(schedule, cl_team,
+                                          UCC_CL_HIER_SBGP_NODE, &args);
+        if (UCC_OK != status) {
+            goto err;
+        }
+    }
+    ucc_cl_hier_schedule_ready(schedule);
+    *task = &schedule->super.super;
+    return UCC_OK;
+err:
+    ucc_cl_hier_schedule_finalize(&schedule->super.super);
+    return status;
+}
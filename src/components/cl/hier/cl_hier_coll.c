@@ -0,0 +1,98 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "cl_hier.h"
+#include "cl_hier_coll.h"
+#include "utils/ucc_coll_utils.h"
+
+ucc_cl_hier_schedule_t *ucc_cl_hier_get_schedule(ucc_cl_hier_team_t *team)
+{
+    ucc_cl_hier_context_t  *ctx      = UCC_CL_HIER_TEAM_CTX(team);
+    ucc_cl_hier_schedule_t *schedule = ucc_mpool_get(&ctx->sched_mp);
+
+    if (ucc_unlikely(!schedule)) {
+        return NULL;
+    }
+    ucc_schedule_init(&schedule->super, ctx->super.super.ucc_context);
+    return schedule;
+}
+
+ucc_status_t ucc_cl_hier_schedule_add(ucc_cl_hier_schedule_t *schedule,
+                                      ucc_cl_hier_team_t     *team,
+                                      ucc_cl_hier_sbgp_type_t sbgp,
+                                      ucc_base_coll_args_t   *args)
+{
+    int                     n_tasks = schedule->super.n_tasks;
+    ucc_base_coll_init_fn_t init;
+    ucc_base_team_t        *bteam;
+    ucc_coll_task_t        *task;
+    ucc_status_t            status;
+
+    ucc_assert(UCC_CL_HIER_SBGP_ENABLED(team, sbgp));
+    status = ucc_coll_score_map_lookup(team->sbgps[sbgp].score_map, args,
+                                       &init, &bteam);
+    if (UCC_OK != status) {
+        return status;
+    }
+    status = init(args, bteam, &task);
+    if (UCC_OK != status) {
+        return status;
+    }
+    ucc_schedule_add_task(&schedule->super, task);
+    if (0 == n_tasks) {
+        ucc_event_manager_subscribe(&schedule->super.super.em,
+                                    UCC_EVENT_SCHEDULE_STARTED, task);
+        task->handlers[UCC_EVENT_SCHEDULE_STARTED] = ucc_task_start_handler;
+    } else {
+        /* each level starts when the previous one completes */
+        ucc_event_manager_subscribe(&schedule->super.tasks[n_tasks - 1]->em,
+                                    UCC_EVENT_COMPLETED, task);
+        task->handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
+    }
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_cl_hier_schedule_start(ucc_coll_task_t *task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(task, ucc_schedule_t);
+
+    return ucc_schedule_start(schedule);
+}
+
+ucc_status_t ucc_cl_hier_schedule_finalize(ucc_coll_task_t *task)
+{
+    ucc_cl_hier_schedule_t *schedule =
+        ucc_derived_of(task, ucc_cl_hier_schedule_t);
+    ucc_status_t            status;
+
+    status = ucc_schedule_finalize(task);
+    ucc_mpool_put(schedule);
+    return status;
+}
+
+void ucc_cl_hier_schedule_ready(ucc_cl_hier_schedule_t *schedule)
+{
+    schedule->super.super.post     = ucc_cl_hier_schedule_start;
+    schedule->super.super.progress = NULL;
+    schedule->super.super.finalize = ucc_cl_hier_schedule_finalize;
+}
+
+ucc_status_t ucc_cl_hier_coll_init(ucc_base_coll_args_t *coll_args,
+                                   ucc_base_team_t      *team,
+                                   ucc_coll_task_t     **task)
+{
+    switch (coll_args->args.coll_type) {
+    case UCC_COLL_TYPE_ALLREDUCE:
+        return ucc_cl_hier_allreduce_init(coll_args, team, task);
+    case UCC_COLL_TYPE_BCAST:
+        return ucc_cl_hier_bcast_init(coll_args, team, task);
+    case UCC_COLL_TYPE_BARRIER:
+        return ucc_cl_hier_barrier_init(coll_args, team, task);
+    default:
+        break;
+    }
+    return UCC_ERR_NOT_SUPPORTED;
+}
@@ -0,0 +1,49 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_CL_HIER_COLL_H_
+#define UCC_CL_HIER_COLL_H_
+#include "cl_hier.h"
+#include "schedule/ucc_schedule.h"
+
+/* Hierarchical collective: a chain of tasks, every task is a collective
+   of one of the subgroups selected through the subgroup score map */
+typedef struct ucc_cl_hier_schedule {
+    ucc_schedule_t super;
+} ucc_cl_hier_schedule_t;
+
+ucc_cl_hier_schedule_t *ucc_cl_hier_get_schedule(ucc_cl_hier_team_t *team);
+
+/* Initializes the collective described by args on the subgroup sbgp
+   of the team and appends it to the end of the chain */
+ucc_status_t ucc_cl_hier_schedule_add(ucc_cl_hier_schedule_t *schedule,
+                                      ucc_cl_hier_team_t     *team,
+                                      ucc_cl_hier_sbgp_type_t sbgp,
+                                      ucc_base_coll_args_t   *args);
+
+/* Sets post/finalize of the schedule, must be called once the chain
+   is complete */
+void ucc_cl_hier_schedule_ready(ucc_cl_hier_schedule_t *schedule);
+
+/* Finalizes all the tasks of the chain and releases the schedule */
+ucc_status_t ucc_cl_hier_schedule_finalize(ucc_coll_task_t *task);
+
+ucc_status_t ucc_cl_hier_coll_init(ucc_base_coll_args_t *coll_args,
+                                   ucc_base_team_t      *team,
+                                   ucc_coll_task_t     **task);
+
+ucc_status_t ucc_cl_hier_allreduce_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task);
+
+ucc_status_t ucc_cl_hier_bcast_init(ucc_base_coll_args_t *coll_args,
+                                    ucc_base_team_t      *team,
+                                    ucc_coll_task_t     **task);
+
+ucc_status_t ucc_cl_hier_barrier_init(ucc_base_coll_args_t *coll_args,
+                                      ucc_base_team_t      *team,
+                                      ucc_coll_task_t     **task);
+#endif
@@ -0,0 +1,387 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "cl_hier.h"
+#include "cl_hier_coll.h"
+#include "core/ucc_team.h"
+#include "utils/ucc_malloc.h"
+
+static const char *ucc_cl_hier_sbgp_names[] = {
+    [UCC_CL_HIER_SBGP_NODE]         = "node",
+    [UCC_CL_HIER_SBGP_NODE_LEADERS] = "node_leaders",
+};
+
+/* Fills sbgp from the list of its members (team ranks, ascending).
+   Takes ownership of "ranks". */
+static ucc_status_t ucc_cl_hier_sbgp_init(ucc_cl_hier_team_t *team,
+                                          ucc_cl_hier_sbgp_t *sbgp,
+                                          ucc_rank_t *ranks, ucc_rank_t size)
+{
+    ucc_rank_t i;
+
+    sbgp->state = UCC_CL_HIER_SBGP_NOT_EXISTS;
+    sbgp->size  = size;
+    for (i = 0; i < size; i++) {
+        if (ranks[i] == team->rank) {
+            sbgp->rank  = i;
+            sbgp->state = (size > 1) ? UCC_CL_HIER_SBGP_ENABLED
+                                     : UCC_CL_HIER_SBGP_TRIVIAL;
+            break;
+        }
+    }
+    if (sbgp->state != UCC_CL_HIER_SBGP_ENABLED) {
+        ucc_free(ranks);
+        return UCC_OK;
+    }
+    sbgp->map        = ucc_ep_map_from_array(&ranks, size, team->size, 1);
+    sbgp->rank_array = ranks;
+    sbgp->tl_teams   = ucc_malloc(sizeof(ucc_tl_team_t *) *
+                                  UCC_CL_HIER_TEAM_CTX(team)->n_tl_ctxs,
+                                  "cl_hier_sbgp_tl_teams");
+    if (!sbgp->tl_teams) {
+        cl_error(UCC_CL_HIER_TEAM_LIB(team),
+                 "failed to allocate %zd bytes for tl_teams",
+                 sizeof(ucc_tl_team_t *) *
+                 UCC_CL_HIER_TEAM_CTX(team)->n_tl_ctxs);
+        return UCC_ERR_NO_MEMORY;
+    }
+    return UCC_OK;
+}
+
+/* Splits the team into nodes using host_hash of the exchanged proc info.
+   Node id is the order of the first appearance of the host in the team,
+   so the node leader (lowest team rank of the node) with node id "i" has
+   rank "i" in the NODE_LEADERS subgroup. */
+static ucc_status_t ucc_cl_hier_topo_init(ucc_cl_hier_team_t *team,
+                                          ucc_context_t      *core_ctx,
+                                          ucc_team_t         *core_team)
+{
+    ucc_rank_t     size       = team->size;
+    ucc_rank_t     n_nodes    = 0;
+    ucc_rank_t     node_size  = 0;
+    ucc_host_id_t *host_hashes;
+    ucc_rank_t    *leaders, *node_ranks;
+    ucc_host_id_t  hash;
+    ucc_rank_t     r, n;
+    ucc_status_t   status;
+
+    team->node_ids = ucc_malloc(sizeof(ucc_rank_t) * size, "cl_hier_node_ids");
+    host_hashes    = ucc_malloc(sizeof(ucc_host_id_t) * size, "host_hashes");
+    leaders        = ucc_malloc(sizeof(ucc_rank_t) * size, "leaders");
+    if (!team->node_ids || !host_hashes || !leaders) {
+        cl_error(UCC_CL_HIER_TEAM_LIB(team),
+                 "failed to allocate topo arrays for team size %u", size);
+        status = UCC_ERR_NO_MEMORY;
+        goto out;
+    }
+    for (r = 0; r < size; r++) {
+        hash = ucc_get_team_ep_header(core_ctx, core_team, r)->ctx_id.pi
+                   .host_hash;
+        for (n = 0; n < n_nodes; n++) {
+            if (host_hashes[n] == hash) {
+                break;
+            }
+        }
+        if (n == n_nodes) {
+            host_hashes[n_nodes] = hash;
+            leaders[n_nodes++]   = r;
+        }
+        team->node_ids[r] = n;
+    }
+    for (r = 0; r < size; r++) {
+        if (team->node_ids[r] == team->node_ids[team->rank]) {
+            node_size++;
+        }
+    }
+    if (n_nodes == 1 || n_nodes == size) {
+        cl_debug(UCC_CL_HIER_TEAM_LIB(team),
+                 "hierarchy is trivial: team size %u, n_nodes %u", size,
+                 n_nodes);
+        status = UCC_ERR_NOT_SUPPORTED;
+        goto out;
+    }
+    node_ranks = ucc_malloc(sizeof(ucc_rank_t) * node_size, "node_ranks");
+    if (!node_ranks) {
+        cl_error(UCC_CL_HIER_TEAM_LIB(team),
+                 "failed to allocate %zd bytes for node ranks",
+                 sizeof(ucc_rank_t) * node_size);
+        status = UCC_ERR_NO_MEMORY;
+        goto out;
+    }
+    node_size = 0;
+    for (r = 0; r < size; r++) {
+        if (team->node_ids[r] == team->node_ids[team->rank]) {
+            node_ranks[node_size++] = r;
+        }
+    }
+    status = ucc_cl_hier_sbgp_init(team, &team->sbgps[UCC_CL_HIER_SBGP_NODE],
+                                   node_ranks, node_size);
+    if (UCC_OK != status) {
+        goto out;
+    }
+    status = ucc_cl_hier_sbgp_init(team,
+                                   &team->sbgps[UCC_CL_HIER_SBGP_NODE_LEADERS],
+                                   leaders, n_nodes);
+    leaders = NULL;
+    cl_debug(UCC_CL_HIER_TEAM_LIB(team),
+             "team size %u, n_nodes %u, node size %u, node leader %d", size,
+             n_nodes, node_size, UCC_CL_HIER_IS_NODE_LEADER(team));
+out:
+    ucc_free(host_hashes);
+    ucc_free(leaders);
+    return status;
+}
+
+static void ucc_cl_hier_sbgps_cleanup(ucc_cl_hier_team_t *team)
+{
+    int i;
+
+    for (i = 0; i < UCC_CL_HIER_SBGP_LAST; i++) {
+        ucc_free(team->sbgps[i].rank_array);
+        ucc_free(team->sbgps[i].tl_teams);
+        if (team->sbgps[i].score_map) {
+            ucc_coll_score_free_map(team->sbgps[i].score_map);
+        }
+    }
+    ucc_free(team->node_ids);
+}
+
+UCC_CLASS_INIT_FUNC(ucc_cl_hier_team_t, ucc_base_context_t *cl_context,
+                    const ucc_base_team_params_t *params)
+{
+    ucc_cl_hier_context_t     *ctx =
+        ucc_derived_of(cl_context, ucc_cl_hier_context_t);
+    ucc_cl_hier_sbgp_t        *sbgp;
+    struct ucc_team_team_desc *d;
+    int                        i, j, n_teams;
+    ucc_status_t               status;
+
+    UCC_CLASS_CALL_SUPER_INIT(ucc_cl_team_t, &ctx->super, params->team);
+    memset(self->sbgps, 0, sizeof(self->sbgps));
+    self->team_create_req = NULL;
+    self->node_ids        = NULL;
+    self->size            = params->size;
+    self->rank            = params->rank;
+    status = ucc_cl_hier_topo_init(self, cl_context->ucc_context,
+                                   params->team);
+    if (UCC_OK != status) {
+        goto err;
+    }
+    n_teams = 0;
+    for (i = 0; i < UCC_CL_HIER_SBGP_LAST; i++) {
+        if (UCC_CL_HIER_SBGP_ENABLED(self, i)) {
+            n_teams += ctx->n_tl_ctxs;
+        }
+    }
+    status = ucc_team_multiple_req_alloc(&self->team_create_req, n_teams);
+    if (UCC_OK != status) {
+        cl_error(cl_context->lib, "failed to allocate team req multiple");
+        goto err;
+    }
+    n_teams = 0;
+    for (i = 0; i < UCC_CL_HIER_SBGP_LAST; i++) {
+        sbgp = &self->sbgps[i];
+        if (sbgp->state != UCC_CL_HIER_SBGP_ENABLED) {
+            continue;
+        }
+        for (j = 0; j < ctx->n_tl_ctxs; j++) {
+            d = &self->team_create_req->descs[n_teams++];
+            memcpy(&d->param, params, sizeof(ucc_base_team_params_t));
+            d->ctx            = ctx->tl_ctxs[j];
+            d->param.scope    = UCC_CL_HIER;
+            d->param.scope_id = i;
+            d->param.rank     = sbgp->rank;
+            d->param.size     = sbgp->size;
+            d->param.map      = sbgp->map;
+        }
+    }
+    self->team_create_req->n_teams = n_teams;
+
+    status = ucc_tl_team_create_multiple(self->team_create_req);
+    if (status < 0) {
+        cl_error(cl_context->lib, "failed to post tl team create (%d)",
+                 status);
+        goto err_req;
+    }
+    cl_info(cl_context->lib, "posted cl team: %p", self);
+    return UCC_OK;
+err_req:
+    ucc_team_multiple_req_free(self->team_create_req);
+err:
+    ucc_cl_hier_sbgps_cleanup(self);
+    return status;
+}
+
+UCC_CLASS_CLEANUP_FUNC(ucc_cl_hier_team_t)
+{
+    cl_info(self->super.super.context->lib, "finalizing cl team: %p", self);
+}
+
+UCC_CLASS_DEFINE_DELETE_FUNC(ucc_cl_hier_team_t, ucc_base_team_t);
+UCC_CLASS_DEFINE(ucc_cl_hier_team_t, ucc_cl_team_t);
+
+ucc_status_t ucc_cl_hier_team_destroy(ucc_base_team_t *cl_team)
+{
+    ucc_cl_hier_team_t    *team   = ucc_derived_of(cl_team, ucc_cl_hier_team_t);
+    ucc_cl_hier_context_t *ctx    = UCC_CL_HIER_TEAM_CTX(team);
+    ucc_status_t           status = UCC_OK;
+    int                    i, j, n_teams;
+
+    if (NULL == team->team_create_req) {
+        n_teams = 0;
+        for (i = 0; i < UCC_CL_HIER_SBGP_LAST; i++) {
+            n_teams += team->sbgps[i].n_tl_teams;
+        }
+        status = ucc_team_multiple_req_alloc(&team->team_create_req, n_teams);
+        if (UCC_OK != status) {
+            cl_error(ctx->super.super.lib, "failed to allocate team req multiple");
+            return status;
+        }
+        team->team_create_req->n_teams = n_teams;
+        n_teams = 0;
+        for (i = 0; i < UCC_CL_HIER_SBGP_LAST; i++) {
+            for (j = 0; j < team->sbgps[i].n_tl_teams; j++) {
+                team->team_create_req->descs[n_teams++].team =
+                    team->sbgps[i].tl_teams[j];
+            }
+        }
+    }
+    status = ucc_tl_team_destroy_multiple(team->team_create_req);
+    if (UCC_INPROGRESS == status) {
+        return status;
+    }
+    for (i = 0; i < team->team_create_req->n_teams; i++) {
+        if (team->team_create_req->descs[i].status != UCC_OK) {
+            cl_error(ctx->super.super.lib, "tl team destroy failed (%d)",
+                     status);
+            status = team->team_create_req->descs[i].status;
+        }
+    }
+    ucc_team_multiple_req_free(team->team_create_req);
+    ucc_cl_hier_sbgps_cleanup(team);
+    UCC_CLASS_DELETE_FUNC_NAME(ucc_cl_hier_team_t)(cl_team);
+    return status;
+}
+
+static ucc_status_t ucc_cl_hier_sbgp_build_score_map(ucc_cl_hier_team_t *team,
+                                                     ucc_cl_hier_sbgp_type_t type)
+{
+    ucc_cl_hier_sbgp_t *sbgp = &team->sbgps[type];
+    ucc_base_lib_t     *lib  = UCC_CL_HIER_TEAM_LIB(team);
+    ucc_coll_score_t   *score, *score_next, *score_merge;
+    ucc_status_t        status;
+    int                 i;
+
+    if (0 == sbgp->n_tl_teams) {
+        cl_error(lib, "no tl teams were created for sbgp %s",
+                 ucc_cl_hier_sbgp_names[type]);
+        return UCC_ERR_NOT_FOUND;
+    }
+    status = UCC_TL_TEAM_IFACE(sbgp->tl_teams[0])
+                 ->team.get_scores(&sbgp->tl_teams[0]->super, &score);
+    if (UCC_OK != status) {
+        cl_error(lib, "failed to get tl %s scores",
+                 UCC_TL_TEAM_IFACE(sbgp->tl_teams[0])->super.name);
+        return status;
+    }
+    for (i = 1; i < sbgp->n_tl_teams; i++) {
+        status = UCC_TL_TEAM_IFACE(sbgp->tl_teams[i])
+                     ->team.get_scores(&sbgp->tl_teams[i]->super, &score_next);
+        if (UCC_OK != status) {
+            cl_error(lib, "failed to get tl %s scores",
+                     UCC_TL_TEAM_IFACE(sbgp->tl_teams[i])->super.name);
+            return status;
+        }
+        status = ucc_coll_score_merge(score, score_next, &score_merge, 1);
+        if (UCC_OK != status) {
+            cl_error(lib, "failed to merge scores");
+            return status;
+        }
+        score = score_merge;
+    }
+    status = ucc_coll_score_build_map(score, &sbgp->score_map);
+    if (UCC_OK != status) {
+        cl_error(lib, "failed to build score map");
+    }
+    return status;
+}
+
+ucc_status_t ucc_cl_hier_team_create_test(ucc_base_team_t *cl_team)
+{
+    ucc_cl_hier_team_t        *team =
+        ucc_derived_of(cl_team, ucc_cl_hier_team_t);
+    ucc_cl_hier_context_t     *ctx  = UCC_CL_HIER_TEAM_CTX(team);
+    struct ucc_team_team_desc *d;
+    ucc_cl_hier_sbgp_t        *sbgp;
+    ucc_status_t               status;
+    int                        i;
+
+    status = ucc_tl_team_create_multiple(team->team_create_req);
+    if (status != UCC_OK) {
+        return status;
+    }
+    for (i = 0; i < team->team_create_req->n_teams; i++) {
+        d    = &team->team_create_req->descs[i];
+        sbgp = &team->sbgps[d->param.scope_id];
+        if (d->status == UCC_OK) {
+            sbgp->tl_teams[sbgp->n_tl_teams++] = d->team;
+            cl_info(ctx->super.super.lib, "initialized tl %s team for sbgp %s",
+                    UCC_TL_CTX_IFACE(d->ctx)->super.name,
+                    ucc_cl_hier_sbgp_names[d->param.scope_id]);
+        } else {
+            cl_info(ctx->super.super.lib,
+                    "failed to create tl %s team for sbgp %s",
+                    UCC_TL_CTX_IFACE(d->ctx)->super.name,
+                    ucc_cl_hier_sbgp_names[d->param.scope_id]);
+        }
+    }
+    ucc_team_multiple_req_free(team->team_create_req);
+    team->team_create_req = NULL;
+    for (i = 0; i < UCC_CL_HIER_SBGP_LAST; i++) {
+        if (!UCC_CL_HIER_SBGP_ENABLED(team, i)) {
+            continue;
+        }
+        status = ucc_cl_hier_sbgp_build_score_map(team, i);
+        if (UCC_OK != status) {
+            return status;
+        }
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_cl_hier_team_get_scores(ucc_base_team_t   *cl_team,
+                                         ucc_coll_score_t **score_p)
+{
+    /* hierarchical algorithms are implemented for host memory only */
+    struct {
+        ucc_coll_type_t coll_type;
+        size_t          max_msg;
+    } ranges[] = {{UCC_COLL_TYPE_BARRIER, UCC_MSG_MAX},
+                  {UCC_COLL_TYPE_ALLREDUCE, UCC_CL_HIER_ALLREDUCE_MAX_MSG},
+                  {UCC_COLL_TYPE_BCAST, UCC_CL_HIER_BCAST_MAX_MSG}};
+    ucc_coll_score_t *score;
+    ucc_status_t      status;
+    int               i;
+
+    status = ucc_coll_score_alloc(&score);
+    if (UCC_OK != status) {
+        cl_error(cl_team->context->lib, "failed to alloc score");
+        return status;
+    }
+    for (i = 0; i < (int)ucs_static_array_size(ranges); i++) {
+        status = ucc_coll_score_add_range(
+            score, ranges[i].coll_type, UCC_MEMORY_TYPE_HOST, 0,
+            ranges[i].max_msg, UCC_CL_HIER_DEFAULT_SCORE,
+            ucc_cl_hier_coll_init, cl_team);
+        if (UCC_OK != status) {
+            cl_error(cl_team->context->lib, "failed to add score range");
+            ucc_coll_score_free(score);
+            return status;
+        }
+    }
+    *score_p = score;
+    return UCC_OK;
+}
@@ -10,6 +10,7 @@
 
 typedef enum {
     UCC_CL_BASIC,
+    UCC_CL_HIER,
     UCC_CL_ALL,
     UCC_CL_LAST
 } ucc_cl_type_t;
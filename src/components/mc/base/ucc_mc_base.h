@@ -17,6 +17,8 @@
 
 typedef struct ucc_mc_buffer_header ucc_mc_buffer_header_t;
 
+typedef struct ucc_mc_req ucc_mc_req_t;
+
 typedef struct ucc_mc_params ucc_mc_params_t;
 
 /**
@@ -91,6 +93,18 @@ typedef struct ucc_mc_ops {
     ucc_status_t (*memcpy)(void *dst, const void *src, size_t len,
                            ucc_memory_type_t dst_mem,
                            ucc_memory_type_t src_mem);
+    /* Optional non blocking versions of reduce_multi and memcpy: return
+       UCC_INPROGRESS and the request to test with req_test, or complete
+       the operation in place and return its status with NULL request */
+    ucc_status_t (*reduce_multi_nb)(const void *src1, const void *src2,
+                                    void *dst, size_t count, size_t size,
+                                    size_t stride, ucc_datatype_t dt,
+                                    ucc_reduction_op_t op,
+                                    ucc_mc_req_t **req);
+    ucc_status_t (*memcpy_nb)(void *dst, const void *src, size_t len,
+                              ucc_memory_type_t dst_mem,
+                              ucc_memory_type_t src_mem, ucc_mc_req_t **req);
+    ucc_status_t (*req_test)(ucc_mc_req_t *req);
  } ucc_mc_ops_t;
 
 typedef struct ucc_ee_ops {
@@ -8,17 +8,69 @@
 #include "reduce/mc_cpu_reduce.h"
 #include "utils/ucc_malloc.h"
 #include <sys/types.h>
+#include <unistd.h>
 
 static ucc_config_field_t ucc_mc_cpu_config_table[] = {
     {"", "", NULL, ucc_offsetof(ucc_mc_cpu_config_t, super),
      UCC_CONFIG_TYPE_TABLE(ucc_mc_config_table)},
 
-    {"MPOOL_ELEM_SIZE", "1Mb", "The size of each element in mc cpu mpool",
-     ucc_offsetof(ucc_mc_cpu_config_t, mpool_elem_size),
+    {"CACHE_MAX_SIZE", "64Mb",
+     "The max amount of memory kept in mc cpu scratch buffers cache, "
+     "0 - disables the cache",
+     ucc_offsetof(ucc_mc_cpu_config_t, cache_max_size),
      UCC_CONFIG_TYPE_MEMUNITS},
 
-    {"MPOOL_MAX_ELEMS", "8", "The max amount of elements in mc cpu mpool",
-     ucc_offsetof(ucc_mc_cpu_config_t, mpool_max_elems), UCC_CONFIG_TYPE_UINT},
+    {"CACHE_MAX_BUF_SIZE", "32Mb",
+     "The max size of the buffer served from mc cpu cache, the larger "
+     "buffers are allocated and released on every request",
+     ucc_offsetof(ucc_mc_cpu_config_t, cache_max_buf_size),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"CACHE_HUGE_PAGES", "n",
+     "Back mc cpu buffers larger than 2Mb with transparent huge pages",
+     ucc_offsetof(ucc_mc_cpu_config_t, cache_huge_pages),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"REDUCE_SIMD", "auto",
+     "Instruction set of the vectorized reduction kernels:\n"
+     "auto   - the widest one supported by the CPU\n"
+     "avx512, avx2, sse, neon - the given one\n"
+     "none   - compiler generated code only",
+     ucc_offsetof(ucc_mc_cpu_config_t, reduce_simd),
+     UCC_CONFIG_TYPE_ENUM(ucc_mc_cpu_simd_names)},
+
+    {"REDUCE_NT_THRESHOLD", "auto",
+     "Reduction results starting from this size are written with non "
+     "temporal stores, bypassing the cache. auto - size of the last level "
+     "cache, inf - never",
+     ucc_offsetof(ucc_mc_cpu_config_t, reduce_nt_threshold),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"REDUCE_HALF_ACC32", "n",
+     "Accumulate float16 and bfloat16 reductions of several sources in "
+     "float32 and round the result once. By default the result is rounded "
+     "after every source, as if the operation was done in the half type",
+     ucc_offsetof(ucc_mc_cpu_config_t, reduce_half_acc32),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"THREADS", "0",
+     "Number of helper threads executing the reductions and memory copies "
+     "above MC_CPU_THREADS_THRESHOLD in chunks. The non blocking operations "
+     "of the collectives return while the threads run. 0 - disabled",
+     ucc_offsetof(ucc_mc_cpu_config_t, threads),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"THREADS_THRESHOLD", "4Mb",
+     "Reductions and memory copies starting from this size of the result "
+     "are executed by the helper threads",
+     ucc_offsetof(ucc_mc_cpu_config_t, threads_threshold),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"THREADS_NUMA", "y",
+     "Bind the helper threads to the cores of the NUMA node of the thread "
+     "initializing mc cpu, other than its own core",
+     ucc_offsetof(ucc_mc_cpu_config_t, threads_numa),
+     UCC_CONFIG_TYPE_BOOL},
 
     {NULL}
 
@@ -26,133 +78,69 @@ static ucc_config_field_t ucc_mc_cpu_config_table[] = {
 
 static ucc_status_t ucc_mc_cpu_init(const ucc_mc_params_t *mc_params)
 {
+    long         llc_size;
+    ucc_status_t status;
+
     ucc_strncpy_safe(ucc_mc_cpu.super.config->log_component.name,
                      ucc_mc_cpu.super.super.name,
                      sizeof(ucc_mc_cpu.super.config->log_component.name));
     ucc_mc_cpu.thread_mode = mc_params->thread_mode;
-    // lock assures single mpool initiation when multiple threads concurrently execute
-    // different collective operations thus concurrently entering init function.
-    ucc_spinlock_init(&ucc_mc_cpu.mpool_init_spinlock, 0);
-    return UCC_OK;
-}
-
-static ucc_status_t ucc_mc_cpu_mem_alloc(ucc_mc_buffer_header_t **h_ptr,
-                                         size_t                   size)
-{
-    size_t        size_with_h = size + sizeof(ucc_mc_buffer_header_t);
-    ucc_mc_buffer_header_t *h =
-        (ucc_mc_buffer_header_t *)ucc_malloc(size_with_h, "mc cpu");
-    if (ucc_unlikely(!h)) {
-        mc_error(&ucc_mc_cpu.super, "failed to allocate %zd bytes",
-                 size_with_h);
-        return UCC_ERR_NO_MEMORY;
+    ucc_mc_cpu.simd        = ucc_mc_cpu_reduce_simd_init(
+        MC_CPU_CONFIG->reduce_simd, MC_CPU_CONFIG->reduce_half_acc32,
+        ucc_mc_cpu.reduce_simd);
+    ucc_mc_cpu.reduce_nt_threshold = MC_CPU_CONFIG->reduce_nt_threshold;
+    if (ucc_mc_cpu.reduce_nt_threshold == UCC_MEMUNITS_AUTO) {
+        llc_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        ucc_mc_cpu.reduce_nt_threshold = (llc_size > 0) ? llc_size :
+                                         UCC_MEMUNITS_INF;
     }
-    h->from_pool = 0;
-    h->addr      = PTR_OFFSET(h, sizeof(ucc_mc_buffer_header_t));
-    h->mt        = UCC_MEMORY_TYPE_HOST;
-    *h_ptr       = h;
-    mc_debug(&ucc_mc_cpu.super, "MC allocated %ld bytes with ucc_malloc", size);
-    return UCC_OK;
-}
-
-static ucc_status_t ucc_mc_cpu_mem_pool_alloc(ucc_mc_buffer_header_t **h_ptr,
-                                              size_t                   size)
-{
-    ucc_mc_buffer_header_t *h = NULL;
-    if (size <= MC_CPU_CONFIG->mpool_elem_size) {
-        h = (ucc_mc_buffer_header_t *)ucc_mpool_get(&ucc_mc_cpu.mpool);
+    mc_debug(&ucc_mc_cpu.super, "using %s reduction kernels, non temporal "
+             "stores threshold %zu", ucc_mc_cpu_simd_names[ucc_mc_cpu.simd],
+             ucc_mc_cpu.reduce_nt_threshold);
+    status = ucc_mc_cpu_cache_init(&ucc_mc_cpu.cache,
+                                   MC_CPU_CONFIG->cache_max_size,
+                                   MC_CPU_CONFIG->cache_max_buf_size,
+                                   MC_CPU_CONFIG->cache_huge_pages,
+                                   mc_params->thread_mode);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
     }
-    if (!h) {
-        // Slow path
-        return ucc_mc_cpu_mem_alloc(h_ptr, size);
+    status = ucc_mc_cpu_threads_init(&ucc_mc_cpu.threads,
+                                     MC_CPU_CONFIG->threads,
+                                     MC_CPU_CONFIG->threads_numa);
+    if (ucc_unlikely(status != UCC_OK)) {
+        ucc_mc_cpu_cache_cleanup(&ucc_mc_cpu.cache);
+        return status;
     }
-    mc_debug(&ucc_mc_cpu.super, "MC allocated %ld bytes from cpu mpool", size);
-    *h_ptr = h;
+    mc_debug(&ucc_mc_cpu.super, "%d helper threads, threshold %zu",
+             ucc_mc_cpu.threads.n_threads, MC_CPU_CONFIG->threads_threshold);
     return UCC_OK;
 }
 
-static ucc_status_t ucc_mc_cpu_chunk_alloc(ucc_mpool_t *mp, //NOLINT
-                                           size_t *size_p,
-                                           void **chunk_p)
+static ucc_status_t ucc_mc_cpu_mem_alloc(ucc_mc_buffer_header_t **h_ptr,
+                                         size_t                   size)
 {
-    *chunk_p = ucc_malloc(*size_p, "mc cpu");
-    if (!*chunk_p) {
-        mc_error(&ucc_mc_cpu.super, "failed to allocate %zd bytes", *size_p);
-        return UCC_ERR_NO_MEMORY;
+    ucc_status_t status;
+
+    status = ucc_mc_cpu_cache_get(&ucc_mc_cpu.cache, h_ptr, size);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
     }
+    mc_debug(&ucc_mc_cpu.super, "MC allocated %zd bytes%s", size,
+             (*h_ptr)->from_pool ? " from cpu cache" : "");
     return UCC_OK;
 }
 
-static void ucc_mc_cpu_chunk_init(ucc_mpool_t *mp, //NOLINT
-                                  void *obj, void *chunk) //NOLINT
-{
-    ucc_mc_buffer_header_t *h = (ucc_mc_buffer_header_t *)obj;
-    h->from_pool              = 1;
-    h->addr                   = PTR_OFFSET(h, sizeof(ucc_mc_buffer_header_t));
-    h->mt                     = UCC_MEMORY_TYPE_HOST;
-}
-
-static void ucc_mc_cpu_chunk_release(ucc_mpool_t *mp, void *chunk) //NOLINT
-{
-    ucc_free(chunk);
-}
-
-static ucc_mpool_ops_t ucc_mc_ops = {.chunk_alloc   = ucc_mc_cpu_chunk_alloc,
-                                     .chunk_release = ucc_mc_cpu_chunk_release,
-                                     .obj_init      = ucc_mc_cpu_chunk_init,
-                                     .obj_cleanup   = NULL};
-
 static ucc_status_t ucc_mc_cpu_mem_free(ucc_mc_buffer_header_t *h_ptr)
 {
-    ucc_free(h_ptr);
-    return UCC_OK;
-}
-
-static ucc_status_t ucc_mc_cpu_mem_pool_free(ucc_mc_buffer_header_t *h_ptr)
-{
-    if (!h_ptr->from_pool) {
-        return ucc_mc_cpu_mem_free(h_ptr);
-    }
-    ucc_mpool_put(h_ptr);
+    ucc_mc_cpu_cache_put(&ucc_mc_cpu.cache, h_ptr);
     return UCC_OK;
 }
 
 static ucc_status_t
-ucc_mc_cpu_mem_pool_alloc_with_init(ucc_mc_buffer_header_t **h_ptr, size_t size)
-{
-    // lock assures single mpool initiation when multiple threads concurrently
-    // execute different collective operations each entering init function.
-    ucc_spin_lock(&ucc_mc_cpu.mpool_init_spinlock);
-
-    if (MC_CPU_CONFIG->mpool_max_elems == 0) {
-        ucc_mc_cpu.super.ops.mem_alloc = ucc_mc_cpu_mem_alloc;
-        ucc_mc_cpu.super.ops.mem_free  = ucc_mc_cpu_mem_free;
-        ucc_spin_unlock(&ucc_mc_cpu.mpool_init_spinlock);
-        return ucc_mc_cpu_mem_alloc(h_ptr, size);
-    }
-
-    if (!ucc_mc_cpu.mpool_init_flag) {
-        ucc_status_t status = ucc_mpool_init(
-            &ucc_mc_cpu.mpool, 0,
-            sizeof(ucc_mc_buffer_header_t) + MC_CPU_CONFIG->mpool_elem_size, 0,
-            UCC_CACHE_LINE_SIZE, 1, MC_CPU_CONFIG->mpool_max_elems, &ucc_mc_ops,
-            ucc_mc_cpu.thread_mode, "mc cpu mpool buffers");
-        if (ucc_unlikely(status != UCC_OK)) {
-            ucc_spin_unlock(&ucc_mc_cpu.mpool_init_spinlock);
-            return status;
-        }
-        ucc_mc_cpu.super.ops.mem_alloc = ucc_mc_cpu_mem_pool_alloc;
-        ucc_mc_cpu.mpool_init_flag     = 1;
-    }
-    ucc_spin_unlock(&ucc_mc_cpu.mpool_init_spinlock);
-    return ucc_mc_cpu_mem_pool_alloc(h_ptr, size);
-}
-
-static ucc_status_t ucc_mc_cpu_reduce_multi(const void *src1, const void *src2,
-                                            void *dst, size_t size,
-                                            size_t count, size_t stride,
-                                            ucc_datatype_t     dt,
-                                            ucc_reduction_op_t op)
+ucc_mc_cpu_reduce_multi_scalar(const void *src1, const void *src2, void *dst,
+                               size_t size, size_t count, size_t stride,
+                               ucc_datatype_t dt, ucc_reduction_op_t op)
 {
     switch(dt) {
     case UCC_DT_INT8:
@@ -187,6 +175,31 @@ static ucc_status_t ucc_mc_cpu_reduce_multi(const void *src1, const void *src2,
         ucc_assert(8 == sizeof(double));
         return ucc_mc_cpu_reduce_multi_double(src1, src2, dst, size, count,
                                               stride, op);
+#ifdef __SIZEOF_INT128__
+    case UCC_DT_INT128:
+        return ucc_mc_cpu_reduce_multi_int128(src1, src2, dst, size, count,
+                                              stride, op);
+    case UCC_DT_UINT128:
+        return ucc_mc_cpu_reduce_multi_uint128(src1, src2, dst, size, count,
+                                               stride, op);
+#endif
+    case UCC_DT_FLOAT16:
+        return ucc_mc_cpu_reduce_multi_float16(
+            src1, src2, dst, size, count, stride, op,
+            MC_CPU_CONFIG->reduce_half_acc32);
+    case UCC_DT_BFLOAT16:
+        return ucc_mc_cpu_reduce_multi_bfloat16(
+            src1, src2, dst, size, count, stride, op,
+            MC_CPU_CONFIG->reduce_half_acc32);
+    case UCC_DT_FLOAT32_INT32:
+        return ucc_mc_cpu_reduce_multi_float_int(src1, src2, dst, size, count,
+                                                 stride, op);
+    case UCC_DT_FLOAT64_INT32:
+        return ucc_mc_cpu_reduce_multi_double_int(src1, src2, dst, size,
+                                                  count, stride, op);
+    case UCC_DT_INT32_INT32:
+        return ucc_mc_cpu_reduce_multi_int_int(src1, src2, dst, size, count,
+                                               stride, op);
     default:
         mc_error(&ucc_mc_cpu.super, "unsupported reduction type (%d)", dt);
         return UCC_ERR_NOT_SUPPORTED;
@@ -194,6 +207,136 @@ static ucc_status_t ucc_mc_cpu_reduce_multi(const void *src1, const void *src2,
     return UCC_OK;
 }
 
+/* nt - non temporal stores of dst in the vector kernels */
+static ucc_status_t
+ucc_mc_cpu_reduce_multi_nt(const void *src1, const void *src2, void *dst,
+                           size_t size, size_t count, size_t stride,
+                           ucc_datatype_t dt, ucc_reduction_op_t op, int nt)
+{
+    size_t                 dt_size = ucc_dt_size(dt);
+    ucc_mc_cpu_reduce_fn_t simd_fn;
+    size_t                 tile, offset;
+    ucc_status_t           status;
+
+    if (dt < UCC_MC_CPU_REDUCE_N_DT) {
+        simd_fn = ucc_mc_cpu.reduce_simd[dt][ucc_ilog2(op)];
+        if (simd_fn) {
+            return simd_fn(src1, src2, dst, size, count, stride, nt);
+        }
+    }
+    if (size <= UCC_MC_CPU_REDUCE_SINGLE_PASS_MAX || dt_size == 0) {
+        return ucc_mc_cpu_reduce_multi_scalar(src1, src2, dst, size, count,
+                                              stride, dt, op);
+    }
+    /* scalar kernels reduce at most 3 sources per pass over dst: run them
+       on L1 sized tiles of dst so that the next pass finds it in cache */
+    tile = UCC_MC_CPU_REDUCE_TILE_SIZE / dt_size;
+    for (offset = 0; offset < count; offset += tile) {
+        status = ucc_mc_cpu_reduce_multi_scalar(
+            PTR_OFFSET(src1, offset * dt_size),
+            PTR_OFFSET(src2, offset * dt_size),
+            PTR_OFFSET(dst, offset * dt_size), size,
+            ucc_min(tile, count - offset), stride, dt, op);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+    }
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_mc_cpu_reduce_chunk(ucc_mc_cpu_threads_req_t *req,
+                                            size_t offset, size_t count)
+{
+    size_t bytes = offset * req->dt_size;
+
+    return ucc_mc_cpu_reduce_multi_nt(PTR_OFFSET(req->src1, bytes),
+                                      PTR_OFFSET(req->src2, bytes),
+                                      PTR_OFFSET(req->dst, bytes), req->size,
+                                      count, req->stride, req->dt, req->op,
+                                      req->nt);
+}
+
+static ucc_status_t ucc_mc_cpu_memcpy_chunk(ucc_mc_cpu_threads_req_t *req,
+                                            size_t offset, size_t count)
+{
+    memcpy(PTR_OFFSET(req->dst, offset), PTR_OFFSET(req->src1, offset),
+           count);
+    return UCC_OK;
+}
+
+static inline int ucc_mc_cpu_use_threads(size_t bytes)
+{
+    return (ucc_mc_cpu.threads.n_threads > 0) && (bytes > 0) &&
+           (bytes >= MC_CPU_CONFIG->threads_threshold);
+}
+
+static void ucc_mc_cpu_reduce_req_init(ucc_mc_cpu_threads_req_t *req,
+                                       const void *src1, const void *src2,
+                                       void *dst, size_t size, size_t count,
+                                       size_t stride, ucc_datatype_t dt,
+                                       ucc_reduction_op_t op)
+{
+    req->chunk_fn = ucc_mc_cpu_reduce_chunk;
+    req->src1     = src1;
+    req->src2     = src2;
+    req->dst      = dst;
+    req->size     = size;
+    req->count    = count;
+    req->stride   = stride;
+    req->dt       = dt;
+    req->dt_size  = ucc_dt_size(dt);
+    req->op       = op;
+    req->nt       = count * req->dt_size >= ucc_mc_cpu.reduce_nt_threshold;
+}
+
+static ucc_status_t ucc_mc_cpu_reduce_multi(const void *src1, const void *src2,
+                                            void *dst, size_t size,
+                                            size_t count, size_t stride,
+                                            ucc_datatype_t     dt,
+                                            ucc_reduction_op_t op)
+{
+    size_t                   bytes = count * ucc_dt_size(dt);
+    ucc_mc_cpu_threads_req_t req;
+
+    if (ucc_mc_cpu_use_threads(bytes)) {
+        ucc_mc_cpu_reduce_req_init(&req, src1, src2, dst, size, count, stride,
+                                   dt, op);
+        ucc_mc_cpu_threads_post(&ucc_mc_cpu.threads, &req);
+        return ucc_mc_cpu_threads_wait(&ucc_mc_cpu.threads, &req);
+    }
+    return ucc_mc_cpu_reduce_multi_nt(src1, src2, dst, size, count, stride,
+                                      dt, op,
+                                      bytes >= ucc_mc_cpu.reduce_nt_threshold);
+}
+
+static ucc_status_t
+ucc_mc_cpu_reduce_multi_nb(const void *src1, const void *src2, void *dst,
+                           size_t size, size_t count, size_t stride,
+                           ucc_datatype_t dt, ucc_reduction_op_t op,
+                           ucc_mc_req_t **req_p)
+{
+    size_t                    bytes = count * ucc_dt_size(dt);
+    ucc_mc_cpu_threads_req_t *req;
+
+    *req_p = NULL;
+    if (!ucc_mc_cpu_use_threads(bytes)) {
+        return ucc_mc_cpu_reduce_multi_nt(
+            src1, src2, dst, size, count, stride, dt, op,
+            bytes >= ucc_mc_cpu.reduce_nt_threshold);
+    }
+    req = ucc_malloc(sizeof(*req), "mc_cpu_req");
+    if (ucc_unlikely(!req)) {
+        mc_error(&ucc_mc_cpu.super, "failed to allocate %zd bytes",
+                 sizeof(*req));
+        return UCC_ERR_NO_MEMORY;
+    }
+    ucc_mc_cpu_reduce_req_init(req, src1, src2, dst, size, count, stride, dt,
+                               op);
+    ucc_mc_cpu_threads_post(&ucc_mc_cpu.threads, req);
+    *req_p = &req->super;
+    return UCC_INPROGRESS;
+}
+
 static ucc_status_t ucc_mc_cpu_reduce(const void *src1, const void *src2,
                                       void *dst, size_t count,
                                       ucc_datatype_t dt, ucc_reduction_op_t op)
@@ -201,16 +344,73 @@ static ucc_status_t ucc_mc_cpu_reduce(const void *src1, const void *src2,
     return ucc_mc_cpu_reduce_multi(src1, src2, dst, 1, count, 0, dt, op);
 }
 
+static void ucc_mc_cpu_memcpy_req_init(ucc_mc_cpu_threads_req_t *req,
+                                       void *dst, const void *src, size_t len)
+{
+    req->chunk_fn = ucc_mc_cpu_memcpy_chunk;
+    req->src1     = src;
+    req->dst      = dst;
+    req->count    = len;
+    req->dt_size  = 1;
+}
+
 static ucc_status_t ucc_mc_cpu_memcpy(void *dst, const void *src, size_t len,
                                       ucc_memory_type_t dst_mem, //NOLINT
                                       ucc_memory_type_t src_mem) //NOLINT
 {
+    ucc_mc_cpu_threads_req_t req;
+
     ucc_assert((dst_mem == UCC_MEMORY_TYPE_HOST) &&
                (src_mem == UCC_MEMORY_TYPE_HOST));
+    if (ucc_mc_cpu_use_threads(len)) {
+        ucc_mc_cpu_memcpy_req_init(&req, dst, src, len);
+        ucc_mc_cpu_threads_post(&ucc_mc_cpu.threads, &req);
+        return ucc_mc_cpu_threads_wait(&ucc_mc_cpu.threads, &req);
+    }
     memcpy(dst, src, len);
     return UCC_OK;
 }
 
+static ucc_status_t ucc_mc_cpu_memcpy_nb(void *dst, const void *src,
+                                         size_t len,
+                                         ucc_memory_type_t dst_mem, //NOLINT
+                                         ucc_memory_type_t src_mem, //NOLINT
+                                         ucc_mc_req_t    **req_p)
+{
+    ucc_mc_cpu_threads_req_t *req;
+
+    ucc_assert((dst_mem == UCC_MEMORY_TYPE_HOST) &&
+               (src_mem == UCC_MEMORY_TYPE_HOST));
+    *req_p = NULL;
+    if (!ucc_mc_cpu_use_threads(len)) {
+        memcpy(dst, src, len);
+        return UCC_OK;
+    }
+    req = ucc_malloc(sizeof(*req), "mc_cpu_req");
+    if (ucc_unlikely(!req)) {
+        mc_error(&ucc_mc_cpu.super, "failed to allocate %zd bytes",
+                 sizeof(*req));
+        return UCC_ERR_NO_MEMORY;
+    }
+    ucc_mc_cpu_memcpy_req_init(req, dst, src, len);
+    ucc_mc_cpu_threads_post(&ucc_mc_cpu.threads, req);
+    *req_p = &req->super;
+    return UCC_INPROGRESS;
+}
+
+static ucc_status_t ucc_mc_cpu_req_test(ucc_mc_req_t *req)
+{
+    ucc_mc_cpu_threads_req_t *r = ucc_derived_of(req,
+                                                 ucc_mc_cpu_threads_req_t);
+    ucc_status_t              status;
+
+    status = ucc_mc_cpu_threads_req_test(r);
+    if (status != UCC_INPROGRESS) {
+        ucc_free(r);
+    }
+    return status;
+}
+
 static ucc_status_t ucc_mc_cpu_mem_query(const void *ptr, //NOLINT
                                          ucc_mem_attr_t *mem_attr) //NOLINT
 {
@@ -261,28 +461,28 @@ ucc_status_t ucc_ee_cpu_event_test(void *event) //NOLINT
 
 static ucc_status_t ucc_mc_cpu_finalize()
 {
-    if (ucc_mc_cpu.mpool_init_flag) {
-        ucc_mpool_cleanup(&ucc_mc_cpu.mpool, 1);
-        ucc_mc_cpu.mpool_init_flag     = 0;
-        ucc_mc_cpu.super.ops.mem_alloc = ucc_mc_cpu_mem_pool_alloc_with_init;
-    }
-    ucc_spinlock_destroy(&ucc_mc_cpu.mpool_init_spinlock);
+    ucc_mc_cpu_threads_cleanup(&ucc_mc_cpu.threads);
+    ucc_mc_cpu_cache_print_stats(&ucc_mc_cpu.cache);
+    ucc_mc_cpu_cache_cleanup(&ucc_mc_cpu.cache);
     return UCC_OK;
 }
 
 ucc_mc_cpu_t ucc_mc_cpu = {
-    .super.super.name       = "cpu mc",
-    .super.ref_cnt          = 0,
-    .super.type             = UCC_MEMORY_TYPE_HOST,
-    .super.ee_type          = UCC_EE_CPU_THREAD,
-    .super.init             = ucc_mc_cpu_init,
-    .super.finalize         = ucc_mc_cpu_finalize,
-    .super.ops.mem_query    = ucc_mc_cpu_mem_query,
-    .super.ops.mem_alloc    = ucc_mc_cpu_mem_pool_alloc_with_init,
-    .super.ops.mem_free     = ucc_mc_cpu_mem_pool_free,
-    .super.ops.reduce       = ucc_mc_cpu_reduce,
-    .super.ops.reduce_multi = ucc_mc_cpu_reduce_multi,
-    .super.ops.memcpy       = ucc_mc_cpu_memcpy,
+    .super.super.name          = "cpu mc",
+    .super.ref_cnt             = 0,
+    .super.type                = UCC_MEMORY_TYPE_HOST,
+    .super.ee_type             = UCC_EE_CPU_THREAD,
+    .super.init                = ucc_mc_cpu_init,
+    .super.finalize            = ucc_mc_cpu_finalize,
+    .super.ops.mem_query       = ucc_mc_cpu_mem_query,
+    .super.ops.mem_alloc       = ucc_mc_cpu_mem_alloc,
+    .super.ops.mem_free        = ucc_mc_cpu_mem_free,
+    .super.ops.reduce          = ucc_mc_cpu_reduce,
+    .super.ops.reduce_multi    = ucc_mc_cpu_reduce_multi,
+    .super.ops.memcpy          = ucc_mc_cpu_memcpy,
+    .super.ops.reduce_multi_nb = ucc_mc_cpu_reduce_multi_nb,
+    .super.ops.memcpy_nb       = ucc_mc_cpu_memcpy_nb,
+    .super.ops.req_test        = ucc_mc_cpu_req_test,
     .super.config_table =
         {
             .name   = "CPU memory component",
@@ -297,7 +497,6 @@ ucc_mc_cpu_t ucc_mc_cpu = {
     .super.ee_ops.ee_destroy_event = ucc_ee_cpu_destroy_event,
     .super.ee_ops.ee_event_post    = ucc_ee_cpu_event_post,
     .super.ee_ops.ee_event_test    = ucc_ee_cpu_event_test,
-    .mpool_init_flag               = 0,
 };
 
 UCC_CONFIG_REGISTER_TABLE_ENTRY(&ucc_mc_cpu.super.config_table,
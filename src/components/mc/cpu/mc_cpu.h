@@ -9,19 +9,31 @@
 
 #include "components/mc/base/ucc_mc_base.h"
 #include "components/mc/ucc_mc_log.h"
+#include "mc_cpu_cache.h"
+#include "mc_cpu_threads.h"
+#include "reduce/mc_cpu_reduce_simd.h"
 
 typedef struct ucc_mc_cpu_config {
-    ucc_mc_config_t super;
-    size_t          mpool_elem_size;
-    int             mpool_max_elems;
+    ucc_mc_config_t   super;
+    size_t            cache_max_size;
+    size_t            cache_max_buf_size;
+    int               cache_huge_pages;
+    ucc_mc_cpu_simd_t reduce_simd;
+    size_t            reduce_nt_threshold;
+    int               reduce_half_acc32;
+    unsigned          threads;
+    size_t            threads_threshold;
+    int               threads_numa;
 } ucc_mc_cpu_config_t;
 
 typedef struct ucc_mc_cpu {
-    ucc_mc_base_t     super;
-    ucc_mpool_t       mpool;
-    int               mpool_init_flag;
-    ucc_spinlock_t    mpool_init_spinlock;
-    ucc_thread_mode_t thread_mode;
+    ucc_mc_base_t             super;
+    ucc_mc_cpu_cache_t        cache;
+    ucc_thread_mode_t         thread_mode;
+    ucc_mc_cpu_simd_t         simd;
+    ucc_mc_cpu_reduce_table_t reduce_simd;
+    size_t                    reduce_nt_threshold;
+    ucc_mc_cpu_threads_t      threads;
 } ucc_mc_cpu_t;
 
 extern ucc_mc_cpu_t ucc_mc_cpu;
@@ -0,0 +1,196 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "mc_cpu_cache.h"
+#include "mc_cpu.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_math.h"
+#include <sys/mman.h>
+
+/* keeps the user buffer cache line aligned */
+#define UCC_MC_CPU_CACHE_HDR_SIZE                                              \
+    ucc_align_up(sizeof(ucc_mc_cpu_cache_buf_t), UCC_CACHE_LINE_SIZE)
+
+static inline int ucc_mc_cpu_cache_bin(size_t size)
+{
+    if (size <= UCC_BIT(UCC_MC_CPU_CACHE_MIN_SHIFT)) {
+        return UCC_MC_CPU_CACHE_MIN_SHIFT;
+    }
+    return ucc_ilog2(size - 1) + 1;
+}
+
+static inline void ucc_mc_cpu_cache_lock(ucc_mc_cpu_cache_t *cache)
+{
+    if (cache->mt) {
+        ucc_spin_lock(&cache->lock);
+    }
+}
+
+static inline void ucc_mc_cpu_cache_unlock(ucc_mc_cpu_cache_t *cache)
+{
+    if (cache->mt) {
+        ucc_spin_unlock(&cache->lock);
+    }
+}
+
+static ucc_status_t ucc_mc_cpu_cache_buf_alloc(ucc_mc_cpu_cache_t      *cache,
+                                               size_t                   size,
+                                               ucc_mc_cpu_cache_buf_t **buf_p)
+{
+    size_t                  total = UCC_MC_CPU_CACHE_HDR_SIZE + size;
+    size_t                  align = UCC_CACHE_LINE_SIZE;
+    ucc_mc_cpu_cache_buf_t *buf;
+    int                     huge;
+
+    huge = cache->huge_pages && (total >= UCC_MC_CPU_HUGE_PAGE_SIZE);
+    if (huge) {
+        align = UCC_MC_CPU_HUGE_PAGE_SIZE;
+    }
+    if (0 != posix_memalign((void **)&buf, align, total)) {
+        mc_error(&ucc_mc_cpu.super, "failed to allocate %zd bytes", total);
+        return UCC_ERR_NO_MEMORY;
+    }
+#ifdef MADV_HUGEPAGE
+    if (huge && 0 != madvise(buf, total & ~(UCC_MC_CPU_HUGE_PAGE_SIZE - 1),
+                             MADV_HUGEPAGE)) {
+        mc_debug(&ucc_mc_cpu.super, "madvise(MADV_HUGEPAGE) failed for %zd "
+                 "bytes", total);
+    }
+#endif
+    buf->super.mt   = UCC_MEMORY_TYPE_HOST;
+    buf->super.addr = PTR_OFFSET(buf, UCC_MC_CPU_CACHE_HDR_SIZE);
+    buf->next       = NULL;
+    *buf_p          = buf;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_mc_cpu_cache_init(ucc_mc_cpu_cache_t *cache, size_t max_size,
+                                   size_t max_buf_size, int huge_pages,
+                                   ucc_thread_mode_t tm)
+{
+    memset(cache, 0, sizeof(*cache));
+    cache->mt           = (tm == UCC_THREAD_MULTIPLE);
+    cache->huge_pages   = huge_pages;
+    cache->max_size     = max_size;
+    cache->max_buf_size = ucc_min(max_buf_size,
+                                  UCC_BIT(UCC_MC_CPU_CACHE_MAX_BINS - 2));
+    ucc_spinlock_init(&cache->lock, 0);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_mc_cpu_cache_get(ucc_mc_cpu_cache_t      *cache,
+                                  ucc_mc_buffer_header_t **h_ptr, size_t size)
+{
+    ucc_mc_cpu_cache_buf_t *buf = NULL;
+    ucc_mc_cpu_cache_bin_t *bin;
+    ucc_status_t            status;
+    int                     b;
+
+    if (size > cache->max_buf_size || cache->max_size == 0) {
+        ucc_mc_cpu_cache_lock(cache);
+        cache->n_uncached++;
+        ucc_mc_cpu_cache_unlock(cache);
+        status = ucc_mc_cpu_cache_buf_alloc(cache, size, &buf);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+        buf->super.from_pool = 0;
+        *h_ptr               = &buf->super;
+        return UCC_OK;
+    }
+    b   = ucc_mc_cpu_cache_bin(size);
+    bin = &cache->bins[b];
+    ucc_mc_cpu_cache_lock(cache);
+    if (bin->free_list) {
+        buf            = bin->free_list;
+        bin->free_list = buf->next;
+        bin->n_free--;
+        bin->n_hits++;
+        cache->held -= UCC_BIT(b);
+    } else {
+        bin->n_misses++;
+    }
+    ucc_mc_cpu_cache_unlock(cache);
+    if (!buf) {
+        status = ucc_mc_cpu_cache_buf_alloc(cache, UCC_BIT(b), &buf);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+        buf->super.from_pool = 1;
+        buf->bin             = b;
+    }
+    *h_ptr = &buf->super;
+    return UCC_OK;
+}
+
+void ucc_mc_cpu_cache_put(ucc_mc_cpu_cache_t *cache, ucc_mc_buffer_header_t *h)
+{
+    ucc_mc_cpu_cache_buf_t *buf = ucc_derived_of(h, ucc_mc_cpu_cache_buf_t);
+    ucc_mc_cpu_cache_bin_t *bin;
+
+    if (h->from_pool) {
+        bin = &cache->bins[buf->bin];
+        ucc_mc_cpu_cache_lock(cache);
+        if (cache->held + UCC_BIT(buf->bin) <= cache->max_size) {
+            buf->next      = bin->free_list;
+            bin->free_list = buf;
+            bin->n_free++;
+            cache->held    += UCC_BIT(buf->bin);
+            cache->max_held = ucc_max(cache->max_held, cache->held);
+            ucc_mc_cpu_cache_unlock(cache);
+            return;
+        }
+        bin->n_drops++;
+        ucc_mc_cpu_cache_unlock(cache);
+    }
+    ucc_free(buf);
+}
+
+void ucc_mc_cpu_cache_print_stats(ucc_mc_cpu_cache_t *cache)
+{
+    uint64_t                hits   = 0;
+    uint64_t                misses = 0;
+    ucc_mc_cpu_cache_bin_t *bin;
+    int                     b;
+
+    for (b = 0; b < UCC_MC_CPU_CACHE_MAX_BINS; b++) {
+        bin = &cache->bins[b];
+        if (bin->n_hits + bin->n_misses == 0) {
+            continue;
+        }
+        hits   += bin->n_hits;
+        misses += bin->n_misses;
+        mc_info(&ucc_mc_cpu.super, "cache size class %zu: hits %lu, "
+                "misses %lu, hit rate %.1f%%, drops %lu, held buffers %lu",
+                (size_t)UCC_BIT(b), bin->n_hits, bin->n_misses,
+                100.0 * bin->n_hits / (bin->n_hits + bin->n_misses),
+                bin->n_drops, bin->n_free);
+    }
+    if (hits + misses + cache->n_uncached == 0) {
+        return;
+    }
+    mc_info(&ucc_mc_cpu.super, "cache: hit rate %.1f%%, held %zu bytes, "
+            "max held %zu bytes, limit %zu bytes, uncached allocations %lu",
+            (hits + misses) ? 100.0 * hits / (hits + misses) : 0.0,
+            cache->held, cache->max_held, cache->max_size, cache->n_uncached);
+}
+
+void ucc_mc_cpu_cache_cleanup(ucc_mc_cpu_cache_t *cache)
+{
+    ucc_mc_cpu_cache_buf_t *buf;
+    int                     b;
+
+    for (b = 0; b < UCC_MC_CPU_CACHE_MAX_BINS; b++) {
+        while (cache->bins[b].free_list) {
+            buf                      = cache->bins[b].free_list;
+            cache->bins[b].free_list = buf->next;
+            ucc_free(buf);
+        }
+        cache->bins[b].n_free = 0;
+    }
+    cache->held = 0;
+    ucc_spinlock_destroy(&cache->lock);
+}
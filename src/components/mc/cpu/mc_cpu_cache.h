@@ -0,0 +1,63 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_MC_CPU_CACHE_H_
+#define UCC_MC_CPU_CACHE_H_
+
+#include "config.h"
+#include "core/ucc_mc.h"
+#include "utils/ucc_spinlock.h"
+
+/* Scratch buffers cache of mc cpu: the requested size is rounded up to a
+   power of 2 and the released buffers are kept in the free list of their
+   size class. The bytes kept in the free lists are limited by max_size,
+   the buffers above max_buf_size are not cached. */
+
+#define UCC_MC_CPU_CACHE_MIN_SHIFT 12 /* smallest size class is 4Kb */
+#define UCC_MC_CPU_CACHE_MAX_BINS  64
+#define UCC_MC_CPU_HUGE_PAGE_SIZE  (2 * 1024 * 1024)
+
+typedef struct ucc_mc_cpu_cache_buf {
+    ucc_mc_buffer_header_t       super;
+    struct ucc_mc_cpu_cache_buf *next;
+    int                          bin;
+} ucc_mc_cpu_cache_buf_t;
+
+typedef struct ucc_mc_cpu_cache_bin {
+    ucc_mc_cpu_cache_buf_t *free_list;
+    uint64_t                n_free;
+    uint64_t                n_hits;
+    uint64_t                n_misses;
+    uint64_t                n_drops; /* released: cache is full */
+} ucc_mc_cpu_cache_bin_t;
+
+typedef struct ucc_mc_cpu_cache {
+    ucc_spinlock_t         lock;
+    int                    mt;
+    int                    huge_pages;
+    size_t                 max_size;
+    size_t                 max_buf_size;
+    size_t                 held;
+    size_t                 max_held;
+    uint64_t               n_uncached;
+    ucc_mc_cpu_cache_bin_t bins[UCC_MC_CPU_CACHE_MAX_BINS];
+} ucc_mc_cpu_cache_t;
+
+ucc_status_t ucc_mc_cpu_cache_init(ucc_mc_cpu_cache_t *cache, size_t max_size,
+                                   size_t max_buf_size, int huge_pages,
+                                   ucc_thread_mode_t tm);
+
+ucc_status_t ucc_mc_cpu_cache_get(ucc_mc_cpu_cache_t      *cache,
+                                  ucc_mc_buffer_header_t **h_ptr, size_t size);
+
+void ucc_mc_cpu_cache_put(ucc_mc_cpu_cache_t *cache, ucc_mc_buffer_header_t *h);
+
+/* prints per size class statistics with log level info */
+void ucc_mc_cpu_cache_print_stats(ucc_mc_cpu_cache_t *cache);
+
+void ucc_mc_cpu_cache_cleanup(ucc_mc_cpu_cache_t *cache);
+
+#endif
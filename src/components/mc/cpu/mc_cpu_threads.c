@@ -0,0 +1,242 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "mc_cpu_threads.h"
+#include "mc_cpu.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_math.h"
+#include <sched.h>
+#include <stdio.h>
+
+static void ucc_mc_cpu_threads_exec(ucc_mc_cpu_threads_req_t *req,
+                                    uint32_t                  chunk)
+{
+    size_t       offset = chunk * req->chunk;
+    ucc_status_t status;
+
+    status = req->chunk_fn(req, offset, ucc_min(req->chunk,
+                                                req->count - offset));
+    if (ucc_unlikely(status != UCC_OK)) {
+        req->status = status;
+    }
+    /* req can be released by the poster right after the last chunk */
+    ucc_atomic_add32(&req->n_done, 1);
+}
+
+/* takes the next chunk of the request at the head of the queue, called
+   with the pool lock held */
+static inline uint32_t ucc_mc_cpu_threads_take(ucc_mc_cpu_threads_req_t *req)
+{
+    uint32_t chunk = req->next_chunk++;
+
+    if (req->next_chunk == req->n_chunks) {
+        ucc_list_del(&req->list_elem);
+    }
+    return chunk;
+}
+
+static void *ucc_mc_cpu_threads_worker(void *arg)
+{
+    ucc_mc_cpu_threads_t     *pool = arg;
+    ucc_mc_cpu_threads_req_t *req;
+    uint32_t                  chunk;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (ucc_list_is_empty(&pool->queue) && !pool->stop) {
+            pthread_cond_wait(&pool->cond, &pool->lock);
+        }
+        if (pool->stop) {
+            break;
+        }
+        req   = ucc_list_head(&pool->queue, ucc_mc_cpu_threads_req_t,
+                              list_elem);
+        chunk = ucc_mc_cpu_threads_take(req);
+        pthread_mutex_unlock(&pool->lock);
+        ucc_mc_cpu_threads_exec(req, chunk);
+        pthread_mutex_lock(&pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/* cpulist format of sysfs: "0-3,8,10-11" */
+static int ucc_mc_cpu_threads_node_cpus(int node, cpu_set_t *cpus)
+{
+    char  path[64], buf[4096];
+    char *p, *end;
+    long  first, last;
+    FILE *f;
+
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+             node);
+    f = fopen(path, "r");
+    if (!f) {
+        return 0;
+    }
+    p = fgets(buf, sizeof(buf), f);
+    fclose(f);
+    if (!p) {
+        return 0;
+    }
+    CPU_ZERO(cpus);
+    while (*p && *p != '\n') {
+        first = strtol(p, &end, 10);
+        if (end == p) {
+            break;
+        }
+        last = first;
+        if (*end == '-') {
+            p    = end + 1;
+            last = strtol(p, &end, 10);
+        }
+        for (; first <= last && first < CPU_SETSIZE; first++) {
+            CPU_SET(first, cpus);
+        }
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return 1;
+}
+
+/* cores of the NUMA node of the calling thread allowed for the process,
+   without the core of the calling thread if there are others */
+static int ucc_mc_cpu_threads_numa_cpus(cpu_set_t *cpus)
+{
+    int       cpu = sched_getcpu();
+    cpu_set_t allowed, node_cpus;
+    int       node;
+
+    if (cpu < 0 || 0 != sched_getaffinity(0, sizeof(allowed), &allowed)) {
+        return 0;
+    }
+    for (node = 0; ucc_mc_cpu_threads_node_cpus(node, &node_cpus); node++) {
+        if (!CPU_ISSET(cpu, &node_cpus)) {
+            continue;
+        }
+        CPU_AND(cpus, &node_cpus, &allowed);
+        if (CPU_COUNT(cpus) > 1) {
+            CPU_CLR(cpu, cpus);
+        }
+        mc_debug(&ucc_mc_cpu.super, "helper threads are bound to %d cores "
+                 "of NUMA node %d", CPU_COUNT(cpus), node);
+        return CPU_COUNT(cpus) > 0;
+    }
+    return 0;
+}
+
+ucc_status_t ucc_mc_cpu_threads_init(ucc_mc_cpu_threads_t *pool,
+                                     int n_threads, int numa)
+{
+    cpu_set_t      cpus, thread_cpu;
+    pthread_attr_t attr;
+    int            i, cpu, bind;
+
+    memset(pool, 0, sizeof(*pool));
+    ucc_list_head_init(&pool->queue);
+    if (n_threads == 0) {
+        return UCC_OK;
+    }
+    pool->threads = ucc_calloc(n_threads, sizeof(pthread_t), "threads");
+    if (!pool->threads) {
+        mc_error(&ucc_mc_cpu.super, "failed to allocate %zd bytes",
+                 n_threads * sizeof(pthread_t));
+        return UCC_ERR_NO_MEMORY;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+    bind = numa && ucc_mc_cpu_threads_numa_cpus(&cpus);
+    if (numa && !bind) {
+        mc_debug(&ucc_mc_cpu.super, "failed to detect the NUMA node, helper "
+                 "threads are not bound");
+    }
+    cpu = -1;
+    for (i = 0; i < n_threads; i++) {
+        pthread_attr_init(&attr);
+        if (bind) {
+            /* round robin over the cores of the node */
+            do {
+                cpu = (cpu + 1) % CPU_SETSIZE;
+            } while (!CPU_ISSET(cpu, &cpus));
+            CPU_ZERO(&thread_cpu);
+            CPU_SET(cpu, &thread_cpu);
+            pthread_attr_setaffinity_np(&attr, sizeof(thread_cpu),
+                                        &thread_cpu);
+        }
+        if (0 != pthread_create(&pool->threads[i], &attr,
+                                ucc_mc_cpu_threads_worker, pool)) {
+            mc_error(&ucc_mc_cpu.super, "failed to create helper thread");
+            pthread_attr_destroy(&attr);
+            ucc_mc_cpu_threads_cleanup(pool);
+            return UCC_ERR_NO_RESOURCE;
+        }
+        pthread_attr_destroy(&attr);
+        pool->n_threads++;
+    }
+    return UCC_OK;
+}
+
+void ucc_mc_cpu_threads_post(ucc_mc_cpu_threads_t     *pool,
+                             ucc_mc_cpu_threads_req_t *req)
+{
+    size_t bytes = req->count * req->dt_size;
+    size_t chunk;
+
+    chunk = (bytes + pool->n_threads * UCC_MC_CPU_THREADS_CHUNKS_PER_THREAD -
+             1) / (pool->n_threads * UCC_MC_CPU_THREADS_CHUNKS_PER_THREAD);
+    chunk = ucc_align_up(ucc_max(chunk, UCC_MC_CPU_THREADS_MIN_CHUNK),
+                         UCC_MC_CPU_THREADS_CHUNK_ALIGN);
+    req->super.mt   = UCC_MEMORY_TYPE_HOST;
+    req->chunk      = chunk / req->dt_size;
+    req->n_chunks   = (req->count + req->chunk - 1) / req->chunk;
+    req->next_chunk = 0;
+    req->n_done     = 0;
+    req->status     = UCC_OK;
+    pthread_mutex_lock(&pool->lock);
+    ucc_list_add_tail(&pool->queue, &req->list_elem);
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+ucc_status_t ucc_mc_cpu_threads_wait(ucc_mc_cpu_threads_t     *pool,
+                                     ucc_mc_cpu_threads_req_t *req)
+{
+    ucc_status_t status;
+    uint32_t     chunk;
+
+    pthread_mutex_lock(&pool->lock);
+    while (req->next_chunk < req->n_chunks) {
+        chunk = ucc_mc_cpu_threads_take(req);
+        pthread_mutex_unlock(&pool->lock);
+        ucc_mc_cpu_threads_exec(req, chunk);
+        pthread_mutex_lock(&pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    while (UCC_INPROGRESS == (status = ucc_mc_cpu_threads_req_test(req))) {
+        sched_yield();
+    }
+    return status;
+}
+
+void ucc_mc_cpu_threads_cleanup(ucc_mc_cpu_threads_t *pool)
+{
+    int i;
+
+    if (!pool->threads) {
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
+    for (i = 0; i < pool->n_threads; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->cond);
+    ucc_free(pool->threads);
+    pool->threads   = NULL;
+    pool->n_threads = 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_MC_CPU_THREADS_H_
+#define UCC_MC_CPU_THREADS_H_
+
+#include "config.h"
+#include "core/ucc_mc.h"
+#include "utils/ucc_list.h"
+#include "utils/ucc_atomic.h"
+#include <pthread.h>
+
+/* Helper threads of mc cpu: the large reductions and copies are split in
+   chunks and the chunks are executed by the pool threads. The poster of
+   the request either tests it (non blocking operations) or executes the
+   chunks not taken by the pool threads yet and waits for the rest. */
+
+#define UCC_MC_CPU_THREADS_MIN_CHUNK   (256 * 1024)
+#define UCC_MC_CPU_THREADS_CHUNK_ALIGN 4096
+/* more chunks than threads: a thread delayed by the OS doesn't delay the
+   whole request */
+#define UCC_MC_CPU_THREADS_CHUNKS_PER_THREAD 4
+
+typedef struct ucc_mc_cpu_threads_req ucc_mc_cpu_threads_req_t;
+
+/* executes the elements [offset, offset + count) of the request */
+typedef ucc_status_t (*ucc_mc_cpu_threads_chunk_fn_t)(
+    ucc_mc_cpu_threads_req_t *req, size_t offset, size_t count);
+
+struct ucc_mc_cpu_threads_req {
+    ucc_mc_req_t                  super;
+    ucc_list_link_t               list_elem;
+    ucc_mc_cpu_threads_chunk_fn_t chunk_fn;
+    size_t                        count; /* elements of dst */
+    size_t                        chunk; /* elements per chunk */
+    uint32_t                      n_chunks;
+    uint32_t                      next_chunk; /* protected by the pool lock */
+    volatile uint32_t             n_done;
+    ucc_status_t                  status;
+    const void                   *src1;
+    const void                   *src2;
+    void                         *dst;
+    size_t                        size;
+    size_t                        stride;
+    size_t                        dt_size;
+    ucc_datatype_t                dt;
+    ucc_reduction_op_t            op;
+    int                           nt;
+};
+
+typedef struct ucc_mc_cpu_threads {
+    int             n_threads;
+    pthread_t      *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    ucc_list_link_t queue;
+    int             stop;
+} ucc_mc_cpu_threads_t;
+
+/* numa - bind the threads to the cores of the NUMA node of the calling
+   thread, other than its own core */
+ucc_status_t ucc_mc_cpu_threads_init(ucc_mc_cpu_threads_t *pool,
+                                     int n_threads, int numa);
+
+/* splits the request (count, dt_size, chunk_fn and the arguments are set by
+   the caller) in chunks and queues it */
+void ucc_mc_cpu_threads_post(ucc_mc_cpu_threads_t     *pool,
+                             ucc_mc_cpu_threads_req_t *req);
+
+static inline ucc_status_t
+ucc_mc_cpu_threads_req_test(ucc_mc_cpu_threads_req_t *req)
+{
+    if (req->n_done != req->n_chunks) {
+        return UCC_INPROGRESS;
+    }
+    ucc_memory_cpu_load_fence();
+    return req->status;
+}
+
+/* the calling thread executes the chunks of the request not taken by the
+   pool threads and waits for the rest */
+ucc_status_t ucc_mc_cpu_threads_wait(ucc_mc_cpu_threads_t     *pool,
+                                     ucc_mc_cpu_threads_req_t *req);
+
+void ucc_mc_cpu_threads_cleanup(ucc_mc_cpu_threads_t *pool);
+
+#endif
@@ -8,6 +8,80 @@
 #define UCC_MC_CPU_REDUCE_H_
 
 #include "utils/ucc_math.h"
+
+/* size of the dst tile reduced by the scalar kernels when the number of
+   sources needs several passes */
+#define UCC_MC_CPU_REDUCE_TILE_SIZE       8192
+#define UCC_MC_CPU_REDUCE_SINGLE_PASS_MAX 7
+
+/* Software conversions of float16 and bfloat16, round to nearest even as
+   done by the hardware ones (NaN payload is truncated and quieted) */
+static inline float ucc_mc_cpu_float16_to_float(uint16_t h)
+{
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exp  = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    union {
+        uint32_t u;
+        float    f;
+    } r;
+
+    if (exp == 0x1f) {
+        r.u = sign | 0x7f800000 | (mant << 13);
+    } else if (exp == 0) {
+        r.f = (float)mant * 0x1p-24f; /* subnormal or zero */
+        r.u |= sign;
+    } else {
+        r.u = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    }
+    return r.f;
+}
+
+static inline uint16_t ucc_mc_cpu_float_to_float16(float f)
+{
+    union {
+        uint32_t u;
+        float    f;
+    } v = {.f = f};
+    uint32_t sign = (v.u >> 16) & 0x8000;
+    uint16_t h;
+
+    v.u &= 0x7fffffff;
+    if (v.u >= 0x47800000) { /* 2^16: inf after rounding, inf or NaN */
+        h = (v.u > 0x7f800000) ? (0x7e00 | ((v.u >> 13) & 0x3ff)) : 0x7c00;
+    } else if (v.u < 0x38800000) { /* 2^-14: subnormal result */
+        v.f += 0.5f; /* aligns the mantissa, the FPU rounds */
+        h = v.u - 0x3f000000;
+    } else {
+        v.u += ((uint32_t)(15 - 127) << 23) + 0xfff + ((v.u >> 13) & 1);
+        h = v.u >> 13;
+    }
+    return sign | h;
+}
+
+static inline float ucc_mc_cpu_bfloat16_to_float(uint16_t h)
+{
+    union {
+        uint32_t u;
+        float    f;
+    } r = {.u = (uint32_t)h << 16};
+
+    return r.f;
+}
+
+static inline uint16_t ucc_mc_cpu_float_to_bfloat16(float f)
+{
+    union {
+        uint32_t u;
+        float    f;
+    } v = {.f = f};
+
+    if ((v.u & 0x7fffffff) > 0x7f800000) {
+        return (v.u >> 16) | 0x40;
+    }
+    return (v.u + 0x7fff + ((v.u >> 16) & 1)) >> 16;
+}
+
 #define OP_1(_s1, _s2, _i, _sc, _OP) _OP(_s1[_i], _s2[_i])
 #define OP_2(_s1, _s2, _i, _sc, _OP)                                           \
     _OP((OP_1(_s1, _s2, _i, _sc, _OP)), _s2[_i + 1 * _sc])
@@ -176,4 +250,38 @@ REDUCE_FN_DECLARE(uint32);
 REDUCE_FN_DECLARE(uint64);
 REDUCE_FN_DECLARE(float);
 REDUCE_FN_DECLARE(double);
+#ifdef __SIZEOF_INT128__
+REDUCE_FN_DECLARE(int128);
+REDUCE_FN_DECLARE(uint128);
+#endif
+
+/* value-index pairs of MAXLOC and MINLOC, layout of UCC_DT_FLOAT32_INT32,
+   UCC_DT_FLOAT64_INT32 and UCC_DT_INT32_INT32 */
+typedef struct ucc_mc_cpu_float_int {
+    float   value;
+    int32_t index;
+} ucc_mc_cpu_float_int_t;
+
+typedef struct ucc_mc_cpu_double_int {
+    double  value;
+    int32_t index;
+} ucc_mc_cpu_double_int_t;
+
+typedef struct ucc_mc_cpu_int_int {
+    int32_t value;
+    int32_t index;
+} ucc_mc_cpu_int_int_t;
+
+REDUCE_FN_DECLARE(float_int);
+REDUCE_FN_DECLARE(double_int);
+REDUCE_FN_DECLARE(int_int);
+
+/* acc32 - keep the float32 accumulator over all the sources, otherwise it is
+   rounded to the datatype after every source */
+#define REDUCE_HALF_FN_DECLARE(_type)                                          \
+    ucc_status_t ucc_mc_cpu_reduce_multi_##_type(                              \
+        const void *src1, const void *src2, void *dst, size_t size,            \
+        size_t count, size_t stride, ucc_reduction_op_t op, int acc32)
+REDUCE_HALF_FN_DECLARE(float16);
+REDUCE_HALF_FN_DECLARE(bfloat16);
 #endif
@@ -0,0 +1,77 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+#include "mc_cpu.h"
+#include "reduce/mc_cpu_reduce.h"
+
+/* The operation is done in float32 and the result is rounded to the half
+   type: float32 has more than twice the bits of mantissa, so this is the
+   correctly rounded result of the operation on the half values */
+#define DO_HALF_REDUCE_WITH_OP(_to_float, _from_float, _OP)                    \
+    do {                                                                       \
+        for (i = 0; i < count; i++) {                                          \
+            r = _to_float(s1[i]);                                              \
+            for (j = 0; j < size; j++) {                                       \
+                r = _OP(r, _to_float(s2[i + j * sc]));                         \
+                if (!acc32 && j + 1 < size) {                                  \
+                    r = _to_float(_from_float(r));                             \
+                }                                                              \
+            }                                                                  \
+            d[i] = _from_float(r);                                             \
+        }                                                                      \
+    } while (0)
+
+#define DO_DT_REDUCE_HALF(_dt, _to_float, _from_float)                         \
+    do {                                                                       \
+        const uint16_t *s1 = (const uint16_t *)src1;                           \
+        const uint16_t *s2 = (const uint16_t *)src2;                           \
+        uint16_t       *d  = (uint16_t *)dst;                                  \
+        size_t          sc = stride / sizeof(uint16_t);                        \
+        size_t          i, j;                                                  \
+        float           r;                                                     \
+                                                                               \
+        switch (op) {                                                          \
+        case UCC_OP_MAX:                                                       \
+            DO_HALF_REDUCE_WITH_OP(_to_float, _from_float, DO_OP_MAX);         \
+            break;                                                             \
+        case UCC_OP_MIN:                                                       \
+            DO_HALF_REDUCE_WITH_OP(_to_float, _from_float, DO_OP_MIN);         \
+            break;                                                             \
+        case UCC_OP_SUM:                                                       \
+            DO_HALF_REDUCE_WITH_OP(_to_float, _from_float, DO_OP_SUM);         \
+            break;                                                             \
+        case UCC_OP_PROD:                                                      \
+            DO_HALF_REDUCE_WITH_OP(_to_float, _from_float, DO_OP_PROD);        \
+            break;                                                             \
+        default:                                                               \
+            mc_error(&ucc_mc_cpu.super,                                        \
+                     _dt " dtype does not support "                            \
+                     "requested reduce op: %d",                                \
+                     op);                                                      \
+            return UCC_ERR_NOT_SUPPORTED;                                      \
+        }                                                                      \
+    } while (0)
+
+ucc_status_t ucc_mc_cpu_reduce_multi_float16(const void *src1,
+                                             const void *src2, void *dst,
+                                             size_t size, size_t count,
+                                             size_t stride,
+                                             ucc_reduction_op_t op, int acc32)
+{
+    DO_DT_REDUCE_HALF("float16", ucc_mc_cpu_float16_to_float,
+                      ucc_mc_cpu_float_to_float16);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_mc_cpu_reduce_multi_bfloat16(const void *src1,
+                                              const void *src2, void *dst,
+                                              size_t size, size_t count,
+                                              size_t stride,
+                                              ucc_reduction_op_t op, int acc32)
+{
+    DO_DT_REDUCE_HALF("bfloat16", ucc_mc_cpu_bfloat16_to_float,
+                      ucc_mc_cpu_float_to_bfloat16);
+    return UCC_OK;
+}
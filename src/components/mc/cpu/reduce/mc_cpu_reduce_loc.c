@@ -0,0 +1,71 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+#include "mc_cpu.h"
+#include "reduce/mc_cpu_reduce.h"
+
+/* Replaces the pair if the source value is better, on equal values the
+   smaller index is kept (same as MPI_MAXLOC and MPI_MINLOC) */
+#define DO_LOC_REDUCE_WITH_OP(_CMP)                                            \
+    do {                                                                       \
+        for (i = 0; i < count; i++) {                                          \
+            r = s1[i];                                                         \
+            for (j = 0; j < size; j++) {                                       \
+                v = s2[i + j * sc];                                            \
+                if (_CMP(v.value, r.value) ||                                  \
+                    (v.value == r.value && v.index < r.index)) {               \
+                    r = v;                                                     \
+                }                                                              \
+            }                                                                  \
+            d[i] = r;                                                          \
+        }                                                                      \
+    } while (0)
+
+#define DO_LOC_CMP_MAX(_a, _b) ((_a) > (_b))
+#define DO_LOC_CMP_MIN(_a, _b) ((_a) < (_b))
+
+#define DO_DT_REDUCE_LOC(_type, _dt)                                           \
+    do {                                                                       \
+        const _type *s1 = (const _type *)src1;                                 \
+        const _type *s2 = (const _type *)src2;                                 \
+        _type       *d  = (_type *)dst;                                        \
+        size_t       sc = stride / sizeof(_type);                              \
+        size_t       i, j;                                                     \
+        _type        r, v;                                                     \
+                                                                               \
+        ucc_assert((stride % sizeof(_type)) == 0);                             \
+        switch (op) {                                                          \
+        case UCC_OP_MAXLOC:                                                    \
+            DO_LOC_REDUCE_WITH_OP(DO_LOC_CMP_MAX);                             \
+            break;                                                             \
+        case UCC_OP_MINLOC:                                                    \
+            DO_LOC_REDUCE_WITH_OP(DO_LOC_CMP_MIN);                             \
+            break;                                                             \
+        default:                                                               \
+            mc_error(&ucc_mc_cpu.super,                                        \
+                     _dt " dtype does not support "                            \
+                     "requested reduce op: %d",                                \
+                     op);                                                      \
+            return UCC_ERR_NOT_SUPPORTED;                                      \
+        }                                                                      \
+    } while (0)
+
+REDUCE_FN_DECLARE(float_int)
+{
+    DO_DT_REDUCE_LOC(ucc_mc_cpu_float_int_t, "float32_int32");
+    return UCC_OK;
+}
+
+REDUCE_FN_DECLARE(double_int)
+{
+    DO_DT_REDUCE_LOC(ucc_mc_cpu_double_int_t, "float64_int32");
+    return UCC_OK;
+}
+
+REDUCE_FN_DECLARE(int_int)
+{
+    DO_DT_REDUCE_LOC(ucc_mc_cpu_int_int_t, "int32_int32");
+    return UCC_OK;
+}
@@ -0,0 +1,754 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "mc_cpu.h"
+#include "reduce/mc_cpu_reduce.h"
+#include "reduce/mc_cpu_reduce_simd.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+const char *ucc_mc_cpu_simd_names[] = {
+    [UCC_MC_CPU_SIMD_AUTO]   = "auto",
+    [UCC_MC_CPU_SIMD_NONE]   = "none",
+    [UCC_MC_CPU_SIMD_SSE]    = "sse",
+    [UCC_MC_CPU_SIMD_AVX2]   = "avx2",
+    [UCC_MC_CPU_SIMD_AVX512] = "avx512",
+    [UCC_MC_CPU_SIMD_NEON]   = "neon",
+    [UCC_MC_CPU_SIMD_LAST]   = NULL
+};
+
+/* The kernel reads all the size sources of one vector and stores the result
+   once. The x86 kernels are compiled for their instruction set with the
+   target attribute whatever the build flags are, they are called only if
+   the CPU supports it. As for the scalar kernels, d can only be equal to
+   src1 or to the first block of src2 when they overlap. */
+#define UCC_MC_CPU_SIMD_KERNEL(_isa, _attr, _dt, _op, _type, _vec, _ld, _st,  \
+                               _stnt, _vop, _sop)                              \
+    static _attr ucc_status_t ucc_mc_cpu_reduce_##_isa##_##_dt##_##_op(        \
+        const void *src1, const void *src2, void *dst, size_t size,            \
+        size_t count, size_t stride, int nt)                                   \
+    {                                                                          \
+        const _type *s1   = (const _type *)src1;                               \
+        const _type *s2   = (const _type *)src2;                               \
+        _type       *d    = (_type *)dst;                                      \
+        size_t       sc   = stride / sizeof(_type);                            \
+        size_t       vlen = sizeof(_vec) / sizeof(_type);                      \
+        const _type *s;                                                        \
+        size_t       i, j;                                                     \
+        _vec         v0, v1, v2, v3;                                           \
+        _type        r;                                                        \
+                                                                               \
+        nt = nt && !((uintptr_t)d % sizeof(_vec));                             \
+        for (i = 0; i + 4 * vlen <= count; i += 4 * vlen) {                    \
+            v0 = _ld(&s1[i]);                                                  \
+            v1 = _ld(&s1[i + vlen]);                                           \
+            v2 = _ld(&s1[i + 2 * vlen]);                                       \
+            v3 = _ld(&s1[i + 3 * vlen]);                                       \
+            for (j = 0; j < size; j++) {                                       \
+                s  = &s2[i + j * sc];                                          \
+                v0 = _vop(v0, _ld(s));                                         \
+                v1 = _vop(v1, _ld(s + vlen));                                  \
+                v2 = _vop(v2, _ld(s + 2 * vlen));                              \
+                v3 = _vop(v3, _ld(s + 3 * vlen));                              \
+            }                                                                  \
+            if (nt) {                                                          \
+                _stnt(&d[i], v0);                                              \
+                _stnt(&d[i + vlen], v1);                                       \
+                _stnt(&d[i + 2 * vlen], v2);                                   \
+                _stnt(&d[i + 3 * vlen], v3);                                   \
+            } else {                                                           \
+                _st(&d[i], v0);                                                \
+                _st(&d[i + vlen], v1);                                         \
+                _st(&d[i + 2 * vlen], v2);                                     \
+                _st(&d[i + 3 * vlen], v3);                                     \
+            }                                                                  \
+        }                                                                      \
+        if (nt) {                                                              \
+            UCC_MC_CPU_SIMD_FENCE_##_isa();                                    \
+        }                                                                      \
+        for (; i + vlen <= count; i += vlen) {                                 \
+            v0 = _ld(&s1[i]);                                                  \
+            for (j = 0; j < size; j++) {                                       \
+                v0 = _vop(v0, _ld(&s2[i + j * sc]));                           \
+            }                                                                  \
+            _st(&d[i], v0);                                                    \
+        }                                                                      \
+        for (; i < count; i++) {                                               \
+            r = s1[i];                                                         \
+            for (j = 0; j < size; j++) {                                       \
+                r = _sop(r, s2[i + j * sc]);                                   \
+            }                                                                  \
+            d[i] = r;                                                          \
+        }                                                                      \
+        return UCC_OK;                                                         \
+    }
+
+#define UCC_MC_CPU_SIMD_ARITH(_isa, _attr, _dt, _type, _vec, _ld, _st, _stnt, \
+                              _add, _max, _min)                                \
+    UCC_MC_CPU_SIMD_KERNEL(_isa, _attr, _dt, sum, _type, _vec, _ld, _st,       \
+                           _stnt, _add, DO_OP_SUM)                             \
+    UCC_MC_CPU_SIMD_KERNEL(_isa, _attr, _dt, max, _type, _vec, _ld, _st,       \
+                           _stnt, _max, DO_OP_MAX)                             \
+    UCC_MC_CPU_SIMD_KERNEL(_isa, _attr, _dt, min, _type, _vec, _ld, _st,       \
+                           _stnt, _min, DO_OP_MIN)
+
+#define UCC_MC_CPU_SIMD_BITWISE(_isa, _attr, _dt, _type, _vec, _ld, _st,      \
+                                _stnt, _and, _or, _xor)                        \
+    UCC_MC_CPU_SIMD_KERNEL(_isa, _attr, _dt, band, _type, _vec, _ld, _st,      \
+                           _stnt, _and, DO_OP_BAND)                            \
+    UCC_MC_CPU_SIMD_KERNEL(_isa, _attr, _dt, bor, _type, _vec, _ld, _st,       \
+                           _stnt, _or, DO_OP_BOR)                              \
+    UCC_MC_CPU_SIMD_KERNEL(_isa, _attr, _dt, bxor, _type, _vec, _ld, _st,      \
+                           _stnt, _xor, DO_OP_BXOR)
+
+/* float16 and bfloat16: every vector of the sources is converted to float32
+   by _pfx##_LD_##_dt, the accumulator is rounded to the datatype after
+   every source by _pfx##_RND_##_dt unless _acc32 (the last rounding is done
+   by the conversion back in _pfx##_ST_##_dt). The scalar tail uses the
+   software conversions */
+#define UCC_MC_CPU_SIMD_HALF_KERNEL(_isa, _attr, _pfx, _dt, _op, _vec, _vop,   \
+                                    _sop, _acc32)                              \
+    static _attr ucc_status_t ucc_mc_cpu_reduce_##_isa##_##_dt##_##_op(        \
+        const void *src1, const void *src2, void *dst, size_t size,            \
+        size_t count, size_t stride, int nt)                                   \
+    {                                                                          \
+        const uint16_t *s1   = (const uint16_t *)src1;                         \
+        const uint16_t *s2   = (const uint16_t *)src2;                         \
+        uint16_t       *d    = (uint16_t *)dst;                                \
+        size_t          sc   = stride / sizeof(uint16_t);                      \
+        size_t          vlen = sizeof(_vec) / sizeof(float);                   \
+        const uint16_t *s;                                                     \
+        size_t          i, j;                                                  \
+        _vec            v0, v1, v2, v3;                                        \
+        float           r;                                                     \
+                                                                               \
+        nt = nt && !((uintptr_t)d % (vlen * sizeof(uint16_t)));                \
+        for (i = 0; i + 4 * vlen <= count; i += 4 * vlen) {                    \
+            v0 = _pfx##_LD_##_dt(&s1[i]);                                      \
+            v1 = _pfx##_LD_##_dt(&s1[i + vlen]);                               \
+            v2 = _pfx##_LD_##_dt(&s1[i + 2 * vlen]);                           \
+            v3 = _pfx##_LD_##_dt(&s1[i + 3 * vlen]);                           \
+            for (j = 0; j < size; j++) {                                       \
+                s  = &s2[i + j * sc];                                          \
+                v0 = _vop(v0, _pfx##_LD_##_dt(s));                             \
+                v1 = _vop(v1, _pfx##_LD_##_dt(s + vlen));                      \
+                v2 = _vop(v2, _pfx##_LD_##_dt(s + 2 * vlen));                  \
+                v3 = _vop(v3, _pfx##_LD_##_dt(s + 3 * vlen));                  \
+                if (!(_acc32) && j + 1 < size) {                               \
+                    v0 = _pfx##_RND_##_dt(v0);                                 \
+                    v1 = _pfx##_RND_##_dt(v1);                                 \
+                    v2 = _pfx##_RND_##_dt(v2);                                 \
+                    v3 = _pfx##_RND_##_dt(v3);                                 \
+                }                                                              \
+            }                                                                  \
+            if (nt) {                                                          \
+                _pfx##_STNT_##_dt(&d[i], v0);                                  \
+                _pfx##_STNT_##_dt(&d[i + vlen], v1);                           \
+                _pfx##_STNT_##_dt(&d[i + 2 * vlen], v2);                       \
+                _pfx##_STNT_##_dt(&d[i + 3 * vlen], v3);                       \
+            } else {                                                           \
+                _pfx##_ST_##_dt(&d[i], v0);                                    \
+                _pfx##_ST_##_dt(&d[i + vlen], v1);                             \
+                _pfx##_ST_##_dt(&d[i + 2 * vlen], v2);                         \
+                _pfx##_ST_##_dt(&d[i + 3 * vlen], v3);                         \
+            }                                                                  \
+        }                                                                      \
+        if (nt) {                                                              \
+            UCC_MC_CPU_SIMD_FENCE_##_isa();                                    \
+        }                                                                      \
+        for (; i + vlen <= count; i += vlen) {                                 \
+            v0 = _pfx##_LD_##_dt(&s1[i]);                                      \
+            for (j = 0; j < size; j++) {                                       \
+                v0 = _vop(v0, _pfx##_LD_##_dt(&s2[i + j * sc]));               \
+                if (!(_acc32) && j + 1 < size) {                               \
+                    v0 = _pfx##_RND_##_dt(v0);                                 \
+                }                                                              \
+            }                                                                  \
+            _pfx##_ST_##_dt(&d[i], v0);                                        \
+        }                                                                      \
+        for (; i < count; i++) {                                               \
+            r = ucc_mc_cpu_##_dt##_to_float(s1[i]);                            \
+            for (j = 0; j < size; j++) {                                       \
+                r = _sop(r, ucc_mc_cpu_##_dt##_to_float(s2[i + j * sc]));      \
+                if (!(_acc32) && j + 1 < size) {                               \
+                    r = ucc_mc_cpu_##_dt##_to_float(                           \
+                        ucc_mc_cpu_float_to_##_dt(r));                         \
+                }                                                              \
+            }                                                                  \
+            d[i] = ucc_mc_cpu_float_to_##_dt(r);                               \
+        }                                                                      \
+        return UCC_OK;                                                         \
+    }
+
+/* min and max results are exact, they need no rounding */
+#define UCC_MC_CPU_SIMD_HALF(_isa, _attr, _pfx, _dt, _vec, _add, _mul, _max,  \
+                             _min)                                             \
+    UCC_MC_CPU_SIMD_HALF_KERNEL(_isa, _attr, _pfx, _dt, sum, _vec, _add,       \
+                                DO_OP_SUM, 0)                                  \
+    UCC_MC_CPU_SIMD_HALF_KERNEL(_isa, _attr, _pfx, _dt, sum_acc32, _vec, _add, \
+                                DO_OP_SUM, 1)                                  \
+    UCC_MC_CPU_SIMD_HALF_KERNEL(_isa, _attr, _pfx, _dt, prod, _vec, _mul,      \
+                                DO_OP_PROD, 0)                                 \
+    UCC_MC_CPU_SIMD_HALF_KERNEL(_isa, _attr, _pfx, _dt, prod_acc32, _vec,      \
+                                _mul, DO_OP_PROD, 1)                           \
+    UCC_MC_CPU_SIMD_HALF_KERNEL(_isa, _attr, _pfx, _dt, max, _vec, _max,       \
+                                DO_OP_MAX, 1)                                  \
+    UCC_MC_CPU_SIMD_HALF_KERNEL(_isa, _attr, _pfx, _dt, min, _vec, _min,       \
+                                DO_OP_MIN, 1)
+
+/* the first instruction set setting a kernel wins: the tables are filled
+   starting from the widest vectors */
+#define UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, _OP, _op)                  \
+    do {                                                                       \
+        ucc_mc_cpu_reduce_fn_t *_fn =                                          \
+            &_table[UCC_DT_##_DT][ucc_ilog2(UCC_OP_##_OP)];                    \
+        if (!*_fn) {                                                           \
+            *_fn = ucc_mc_cpu_reduce_##_isa##_##_dt##_##_op;                   \
+        }                                                                      \
+    } while (0)
+
+#define UCC_MC_CPU_SIMD_SET_ARITH(_table, _isa, _DT, _dt)                      \
+    UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, SUM, sum);                     \
+    UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, MAX, max);                     \
+    UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, MIN, min)
+
+#define UCC_MC_CPU_SIMD_SET_BITWISE(_table, _isa, _DT, _dt)                    \
+    UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, BAND, band);                   \
+    UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, BOR, bor);                     \
+    UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, BXOR, bxor)
+
+#define UCC_MC_CPU_SIMD_SET_HALF(_table, _isa, _DT, _dt, _acc32)               \
+    do {                                                                       \
+        UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, MAX, max);                 \
+        UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, MIN, min);                 \
+        if (_acc32) {                                                          \
+            UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, SUM, sum_acc32);       \
+            UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, PROD, prod_acc32);     \
+        } else {                                                               \
+            UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, SUM, sum);             \
+            UCC_MC_CPU_SIMD_SET(_table, _isa, _DT, _dt, PROD, prod);           \
+        }                                                                      \
+    } while (0)
+
+#if defined(__x86_64__)
+
+#define UCC_MC_CPU_SIMD_FENCE_sse()    _mm_sfence()
+#define UCC_MC_CPU_SIMD_FENCE_avx2()   _mm_sfence()
+#define UCC_MC_CPU_SIMD_FENCE_avx512() _mm_sfence()
+
+/* SSE 4.1 */
+#define UCC_SIMD_ATTR_SSE      __attribute__((target("sse4.1")))
+#define SSE_LD_ps(_p)          _mm_loadu_ps((const float *)(_p))
+#define SSE_ST_ps(_p, _v)      _mm_storeu_ps((float *)(_p), _v)
+#define SSE_STNT_ps(_p, _v)    _mm_stream_ps((float *)(_p), _v)
+#define SSE_LD_pd(_p)          _mm_loadu_pd((const double *)(_p))
+#define SSE_ST_pd(_p, _v)      _mm_storeu_pd((double *)(_p), _v)
+#define SSE_STNT_pd(_p, _v)    _mm_stream_pd((double *)(_p), _v)
+#define SSE_LD_si(_p)          _mm_loadu_si128((const __m128i *)(_p))
+#define SSE_ST_si(_p, _v)      _mm_storeu_si128((__m128i *)(_p), _v)
+#define SSE_STNT_si(_p, _v)    _mm_stream_si128((__m128i *)(_p), _v)
+
+#define SSE_FP(_dt, _type, _vec, _sfx)                                         \
+    UCC_MC_CPU_SIMD_ARITH(sse, UCC_SIMD_ATTR_SSE, _dt, _type, _vec,            \
+                          SSE_LD_##_sfx, SSE_ST_##_sfx, SSE_STNT_##_sfx,       \
+                          _mm_add_##_sfx, _mm_max_##_sfx, _mm_min_##_sfx)      \
+    UCC_MC_CPU_SIMD_KERNEL(sse, UCC_SIMD_ATTR_SSE, _dt, prod, _type, _vec,     \
+                           SSE_LD_##_sfx, SSE_ST_##_sfx, SSE_STNT_##_sfx,      \
+                           _mm_mul_##_sfx, DO_OP_PROD)
+
+#define SSE_KERNEL(_dt, _op, _type, _vop, _sop)                                \
+    UCC_MC_CPU_SIMD_KERNEL(sse, UCC_SIMD_ATTR_SSE, _dt, _op, _type, __m128i,   \
+                           SSE_LD_si, SSE_ST_si, SSE_STNT_si, _vop, _sop)
+
+#define SSE_BITWISE(_dt, _type)                                                \
+    UCC_MC_CPU_SIMD_BITWISE(sse, UCC_SIMD_ATTR_SSE, _dt, _type, __m128i,       \
+                            SSE_LD_si, SSE_ST_si, SSE_STNT_si, _mm_and_si128,  \
+                            _mm_or_si128, _mm_xor_si128)
+
+#define SSE_INT(_dt, _type, _add, _max, _min)                                  \
+    UCC_MC_CPU_SIMD_ARITH(sse, UCC_SIMD_ATTR_SSE, _dt, _type, __m128i,         \
+                          SSE_LD_si, SSE_ST_si, SSE_STNT_si, _add, _max, _min) \
+    SSE_BITWISE(_dt, _type)
+
+SSE_FP(float, float, __m128, ps)
+SSE_FP(double, double, __m128d, pd)
+SSE_INT(int8, int8_t, _mm_add_epi8, _mm_max_epi8, _mm_min_epi8)
+SSE_INT(uint8, uint8_t, _mm_add_epi8, _mm_max_epu8, _mm_min_epu8)
+SSE_INT(int16, int16_t, _mm_add_epi16, _mm_max_epi16, _mm_min_epi16)
+SSE_INT(uint16, uint16_t, _mm_add_epi16, _mm_max_epu16, _mm_min_epu16)
+SSE_INT(int32, int32_t, _mm_add_epi32, _mm_max_epi32, _mm_min_epi32)
+SSE_INT(uint32, uint32_t, _mm_add_epi32, _mm_max_epu32, _mm_min_epu32)
+SSE_KERNEL(int32, prod, int32_t, _mm_mullo_epi32, DO_OP_PROD)
+SSE_KERNEL(uint32, prod, uint32_t, _mm_mullo_epi32, DO_OP_PROD)
+SSE_KERNEL(int64, sum, int64_t, _mm_add_epi64, DO_OP_SUM)
+SSE_KERNEL(uint64, sum, uint64_t, _mm_add_epi64, DO_OP_SUM)
+SSE_BITWISE(int64, int64_t)
+SSE_BITWISE(uint64, uint64_t)
+
+/* AVX2 */
+#define UCC_SIMD_ATTR_AVX2     __attribute__((target("avx2")))
+#define AVX2_LD_ps(_p)         _mm256_loadu_ps((const float *)(_p))
+#define AVX2_ST_ps(_p, _v)     _mm256_storeu_ps((float *)(_p), _v)
+#define AVX2_STNT_ps(_p, _v)   _mm256_stream_ps((float *)(_p), _v)
+#define AVX2_LD_pd(_p)         _mm256_loadu_pd((const double *)(_p))
+#define AVX2_ST_pd(_p, _v)     _mm256_storeu_pd((double *)(_p), _v)
+#define AVX2_STNT_pd(_p, _v)   _mm256_stream_pd((double *)(_p), _v)
+#define AVX2_LD_si(_p)         _mm256_loadu_si256((const __m256i *)(_p))
+#define AVX2_ST_si(_p, _v)     _mm256_storeu_si256((__m256i *)(_p), _v)
+#define AVX2_STNT_si(_p, _v)   _mm256_stream_si256((__m256i *)(_p), _v)
+
+#define AVX2_FP(_dt, _type, _vec, _sfx)                                        \
+    UCC_MC_CPU_SIMD_ARITH(avx2, UCC_SIMD_ATTR_AVX2, _dt, _type, _vec,          \
+                          AVX2_LD_##_sfx, AVX2_ST_##_sfx, AVX2_STNT_##_sfx,    \
+                          _mm256_add_##_sfx, _mm256_max_##_sfx,                \
+                          _mm256_min_##_sfx)                                   \
+    UCC_MC_CPU_SIMD_KERNEL(avx2, UCC_SIMD_ATTR_AVX2, _dt, prod, _type, _vec,   \
+                           AVX2_LD_##_sfx, AVX2_ST_##_sfx, AVX2_STNT_##_sfx,   \
+                           _mm256_mul_##_sfx, DO_OP_PROD)
+
+#define AVX2_KERNEL(_dt, _op, _type, _vop, _sop)                               \
+    UCC_MC_CPU_SIMD_KERNEL(avx2, UCC_SIMD_ATTR_AVX2, _dt, _op, _type, __m256i, \
+                           AVX2_LD_si, AVX2_ST_si, AVX2_STNT_si, _vop, _sop)
+
+#define AVX2_BITWISE(_dt, _type)                                               \
+    UCC_MC_CPU_SIMD_BITWISE(avx2, UCC_SIMD_ATTR_AVX2, _dt, _type, __m256i,     \
+                            AVX2_LD_si, AVX2_ST_si, AVX2_STNT_si,              \
+                            _mm256_and_si256, _mm256_or_si256,                 \
+                            _mm256_xor_si256)
+
+#define AVX2_INT(_dt, _type, _add, _max, _min)                                 \
+    UCC_MC_CPU_SIMD_ARITH(avx2, UCC_SIMD_ATTR_AVX2, _dt, _type, __m256i,       \
+                          AVX2_LD_si, AVX2_ST_si, AVX2_STNT_si, _add, _max,    \
+                          _min)                                                \
+    AVX2_BITWISE(_dt, _type)
+
+AVX2_FP(float, float, __m256, ps)
+AVX2_FP(double, double, __m256d, pd)
+AVX2_INT(int8, int8_t, _mm256_add_epi8, _mm256_max_epi8, _mm256_min_epi8)
+AVX2_INT(uint8, uint8_t, _mm256_add_epi8, _mm256_max_epu8, _mm256_min_epu8)
+AVX2_INT(int16, int16_t, _mm256_add_epi16, _mm256_max_epi16, _mm256_min_epi16)
+AVX2_INT(uint16, uint16_t, _mm256_add_epi16, _mm256_max_epu16,
+         _mm256_min_epu16)
+AVX2_INT(int32, int32_t, _mm256_add_epi32, _mm256_max_epi32, _mm256_min_epi32)
+AVX2_INT(uint32, uint32_t, _mm256_add_epi32, _mm256_max_epu32,
+         _mm256_min_epu32)
+AVX2_KERNEL(int32, prod, int32_t, _mm256_mullo_epi32, DO_OP_PROD)
+AVX2_KERNEL(uint32, prod, uint32_t, _mm256_mullo_epi32, DO_OP_PROD)
+AVX2_KERNEL(int64, sum, int64_t, _mm256_add_epi64, DO_OP_SUM)
+AVX2_KERNEL(uint64, sum, uint64_t, _mm256_add_epi64, DO_OP_SUM)
+AVX2_BITWISE(int64, int64_t)
+AVX2_BITWISE(uint64, uint64_t)
+
+/* float16 needs F16C, bfloat16 is converted with integer instructions */
+#define UCC_SIMD_ATTR_F16C     __attribute__((target("avx2,f16c")))
+#define UCC_SIMD_FROUND        (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define AVX2_CVT_float16(_v)   _mm256_cvtps_ph(_v, UCC_SIMD_FROUND)
+#define AVX2_LD_float16(_p)    _mm256_cvtph_ps(SSE_LD_si(_p))
+#define AVX2_ST_float16(_p, _v)   SSE_ST_si(_p, AVX2_CVT_float16(_v))
+#define AVX2_STNT_float16(_p, _v) SSE_STNT_si(_p, AVX2_CVT_float16(_v))
+#define AVX2_RND_float16(_v)   _mm256_cvtph_ps(AVX2_CVT_float16(_v))
+
+/* rounds to nearest even keeping the result in the upper 16 bits, NaNs are
+   quieted */
+static inline UCC_SIMD_ATTR_AVX2 __m256i
+ucc_mc_cpu_avx2_round_bfloat16(__m256 v)
+{
+    __m256i u   = _mm256_castps_si256(v);
+    __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(u, 16),
+                                   _mm256_set1_epi32(1));
+    __m256i r   = _mm256_add_epi32(u, _mm256_add_epi32(
+                                          lsb, _mm256_set1_epi32(0x7fff)));
+    __m256  nan = _mm256_cmp_ps(v, v, _CMP_UNORD_Q);
+
+    r = _mm256_blendv_epi8(r, _mm256_or_si256(u, _mm256_set1_epi32(0x400000)),
+                           _mm256_castps_si256(nan));
+    return _mm256_and_si256(r, _mm256_set1_epi32((int)0xffff0000));
+}
+
+static inline UCC_SIMD_ATTR_AVX2 __m128i ucc_mc_cpu_avx2_cvt_bfloat16(__m256 v)
+{
+    __m256i r = _mm256_srli_epi32(ucc_mc_cpu_avx2_round_bfloat16(v), 16);
+
+    r = _mm256_packus_epi32(r, r); /* packs within 128 bit lanes */
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(r, 0x08));
+}
+
+#define AVX2_LD_bfloat16(_p)                                                   \
+    _mm256_castsi256_ps(                                                       \
+        _mm256_slli_epi32(_mm256_cvtepu16_epi32(SSE_LD_si(_p)), 16))
+#define AVX2_ST_bfloat16(_p, _v)                                               \
+    SSE_ST_si(_p, ucc_mc_cpu_avx2_cvt_bfloat16(_v))
+#define AVX2_STNT_bfloat16(_p, _v)                                             \
+    SSE_STNT_si(_p, ucc_mc_cpu_avx2_cvt_bfloat16(_v))
+#define AVX2_RND_bfloat16(_v)                                                  \
+    _mm256_castsi256_ps(ucc_mc_cpu_avx2_round_bfloat16(_v))
+
+UCC_MC_CPU_SIMD_HALF(avx2, UCC_SIMD_ATTR_F16C, AVX2, float16, __m256,
+                     _mm256_add_ps, _mm256_mul_ps, _mm256_max_ps,
+                     _mm256_min_ps)
+UCC_MC_CPU_SIMD_HALF(avx2, UCC_SIMD_ATTR_AVX2, AVX2, bfloat16, __m256,
+                     _mm256_add_ps, _mm256_mul_ps, _mm256_max_ps,
+                     _mm256_min_ps)
+
+/* AVX-512F: 8 and 16 bit integers need AVX-512BW, AVX2 kernels are used */
+#define UCC_SIMD_ATTR_AVX512   __attribute__((target("avx512f")))
+#define AVX512_LD_ps(_p)       _mm512_loadu_ps((const void *)(_p))
+#define AVX512_ST_ps(_p, _v)   _mm512_storeu_ps((void *)(_p), _v)
+#define AVX512_STNT_ps(_p, _v) _mm512_stream_ps((void *)(_p), _v)
+#define AVX512_LD_pd(_p)       _mm512_loadu_pd((const void *)(_p))
+#define AVX512_ST_pd(_p, _v)   _mm512_storeu_pd((void *)(_p), _v)
+#define AVX512_STNT_pd(_p, _v) _mm512_stream_pd((void *)(_p), _v)
+#define AVX512_LD_si(_p)       _mm512_loadu_si512((const void *)(_p))
+#define AVX512_ST_si(_p, _v)   _mm512_storeu_si512((void *)(_p), _v)
+#define AVX512_STNT_si(_p, _v) _mm512_stream_si512((void *)(_p), _v)
+
+#define AVX512_FP(_dt, _type, _vec, _sfx)                                      \
+    UCC_MC_CPU_SIMD_ARITH(avx512, UCC_SIMD_ATTR_AVX512, _dt, _type, _vec,      \
+                          AVX512_LD_##_sfx, AVX512_ST_##_sfx,                  \
+                          AVX512_STNT_##_sfx, _mm512_add_##_sfx,               \
+                          _mm512_max_##_sfx, _mm512_min_##_sfx)                \
+    UCC_MC_CPU_SIMD_KERNEL(avx512, UCC_SIMD_ATTR_AVX512, _dt, prod, _type,     \
+                           _vec, AVX512_LD_##_sfx, AVX512_ST_##_sfx,           \
+                           AVX512_STNT_##_sfx, _mm512_mul_##_sfx, DO_OP_PROD)
+
+#define AVX512_KERNEL(_dt, _op, _type, _vop, _sop)                             \
+    UCC_MC_CPU_SIMD_KERNEL(avx512, UCC_SIMD_ATTR_AVX512, _dt, _op, _type,      \
+                           __m512i, AVX512_LD_si, AVX512_ST_si,                \
+                           AVX512_STNT_si, _vop, _sop)
+
+#define AVX512_INT(_dt, _type, _add, _max, _min)                               \
+    UCC_MC_CPU_SIMD_ARITH(avx512, UCC_SIMD_ATTR_AVX512, _dt, _type, __m512i,   \
+                          AVX512_LD_si, AVX512_ST_si, AVX512_STNT_si, _add,    \
+                          _max, _min)                                          \
+    UCC_MC_CPU_SIMD_BITWISE(avx512, UCC_SIMD_ATTR_AVX512, _dt, _type, __m512i, \
+                            AVX512_LD_si, AVX512_ST_si, AVX512_STNT_si,        \
+                            _mm512_and_si512, _mm512_or_si512,                 \
+                            _mm512_xor_si512)
+
+AVX512_FP(float, float, __m512, ps)
+AVX512_FP(double, double, __m512d, pd)
+AVX512_INT(int32, int32_t, _mm512_add_epi32, _mm512_max_epi32,
+           _mm512_min_epi32)
+AVX512_INT(uint32, uint32_t, _mm512_add_epi32, _mm512_max_epu32,
+           _mm512_min_epu32)
+AVX512_INT(int64, int64_t, _mm512_add_epi64, _mm512_max_epi64,
+           _mm512_min_epi64)
+AVX512_INT(uint64, uint64_t, _mm512_add_epi64, _mm512_max_epu64,
+           _mm512_min_epu64)
+AVX512_KERNEL(int32, prod, int32_t, _mm512_mullo_epi32, DO_OP_PROD)
+AVX512_KERNEL(uint32, prod, uint32_t, _mm512_mullo_epi32, DO_OP_PROD)
+
+#define AVX512_CVT_float16(_v)      _mm512_cvtps_ph(_v, UCC_SIMD_FROUND)
+#define AVX512_LD_float16(_p)       _mm512_cvtph_ps(AVX2_LD_si(_p))
+#define AVX512_ST_float16(_p, _v)   AVX2_ST_si(_p, AVX512_CVT_float16(_v))
+#define AVX512_STNT_float16(_p, _v) AVX2_STNT_si(_p, AVX512_CVT_float16(_v))
+#define AVX512_RND_float16(_v)      _mm512_cvtph_ps(AVX512_CVT_float16(_v))
+
+static inline UCC_SIMD_ATTR_AVX512 __m512i
+ucc_mc_cpu_avx512_round_bfloat16(__m512 v)
+{
+    __m512i   u   = _mm512_castps_si512(v);
+    __m512i   lsb = _mm512_and_si512(_mm512_srli_epi32(u, 16),
+                                     _mm512_set1_epi32(1));
+    __m512i   r   = _mm512_add_epi32(u, _mm512_add_epi32(
+                                            lsb, _mm512_set1_epi32(0x7fff)));
+    __mmask16 nan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+
+    r = _mm512_mask_or_epi32(r, nan, u, _mm512_set1_epi32(0x400000));
+    return _mm512_and_si512(r, _mm512_set1_epi32((int)0xffff0000));
+}
+
+#define AVX512_EXT_bfloat16(_v)                                                \
+    _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_v), 16))
+#define AVX512_CVT_bfloat16(_v)                                                \
+    _mm512_cvtepi32_epi16(                                                     \
+        _mm512_srli_epi32(ucc_mc_cpu_avx512_round_bfloat16(_v), 16))
+#define AVX512_LD_bfloat16(_p)      AVX512_EXT_bfloat16(AVX2_LD_si(_p))
+#define AVX512_ST_bfloat16(_p, _v)  AVX2_ST_si(_p, AVX512_CVT_bfloat16(_v))
+#define AVX512_STNT_bfloat16(_p, _v)                                           \
+    AVX2_STNT_si(_p, AVX512_CVT_bfloat16(_v))
+#define AVX512_RND_bfloat16(_v)                                                \
+    _mm512_castsi512_ps(ucc_mc_cpu_avx512_round_bfloat16(_v))
+
+UCC_MC_CPU_SIMD_HALF(avx512, UCC_SIMD_ATTR_AVX512, AVX512, float16, __m512,
+                     _mm512_add_ps, _mm512_mul_ps, _mm512_max_ps,
+                     _mm512_min_ps)
+UCC_MC_CPU_SIMD_HALF(avx512, UCC_SIMD_ATTR_AVX512, AVX512, bfloat16, __m512,
+                     _mm512_add_ps, _mm512_mul_ps, _mm512_max_ps,
+                     _mm512_min_ps)
+
+#if (defined(__clang__) && (__clang_major__ >= 11)) ||                         \
+    (!defined(__clang__) && (__GNUC__ >= 10))
+#define UCC_MC_CPU_SIMD_HAVE_BF16 1
+#define UCC_SIMD_ATTR_AVX512BF16 __attribute__((target("avx512f,avx512bf16")))
+#define UCC_MC_CPU_SIMD_FENCE_avx512bf16() _mm_sfence()
+
+/* AVX-512 BF16 conversion: same rounding, but vcvtneps2bf16 flushes
+   denormals to zero. The vectors with a denormal are converted with integer
+   instructions, so that the result is the one of the other kernels */
+static inline UCC_SIMD_ATTR_AVX512BF16 __m256i
+ucc_mc_cpu_avx512bf16_cvt_bfloat16(__m512 v)
+{
+    __m512i   u      = _mm512_castps_si512(v);
+    __mmask16 denorm = _mm512_testn_epi32_mask(u, _mm512_set1_epi32(
+                                                      0x7f800000)) &
+                       _mm512_test_epi32_mask(u, _mm512_set1_epi32(0x7fffff));
+
+    if (ucc_unlikely(denorm)) {
+        return AVX512_CVT_bfloat16(v);
+    }
+    return (__m256i)_mm512_cvtneps_pbh(v);
+}
+
+#define AVX512BF16_CVT_bfloat16(_v) ucc_mc_cpu_avx512bf16_cvt_bfloat16(_v)
+#define AVX512BF16_LD_bfloat16(_p)       AVX512_LD_bfloat16(_p)
+#define AVX512BF16_ST_bfloat16(_p, _v)                                         \
+    AVX2_ST_si(_p, AVX512BF16_CVT_bfloat16(_v))
+#define AVX512BF16_STNT_bfloat16(_p, _v)                                       \
+    AVX2_STNT_si(_p, AVX512BF16_CVT_bfloat16(_v))
+#define AVX512BF16_RND_bfloat16(_v)                                            \
+    AVX512_EXT_bfloat16(AVX512BF16_CVT_bfloat16(_v))
+
+UCC_MC_CPU_SIMD_HALF(avx512bf16, UCC_SIMD_ATTR_AVX512BF16, AVX512BF16,
+                     bfloat16, __m512, _mm512_add_ps, _mm512_mul_ps,
+                     _mm512_max_ps, _mm512_min_ps)
+#endif
+
+#define UCC_MC_CPU_SIMD_SET_INT(_table, _isa, _DT, _dt)                        \
+    UCC_MC_CPU_SIMD_SET_ARITH(_table, _isa, _DT, _dt);                         \
+    UCC_MC_CPU_SIMD_SET_BITWISE(_table, _isa, _DT, _dt)
+
+static void ucc_mc_cpu_reduce_sse_init(ucc_mc_cpu_reduce_table_t t)
+{
+    UCC_MC_CPU_SIMD_SET_ARITH(t, sse, FLOAT32, float);
+    UCC_MC_CPU_SIMD_SET(t, sse, FLOAT32, float, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_ARITH(t, sse, FLOAT64, double);
+    UCC_MC_CPU_SIMD_SET(t, sse, FLOAT64, double, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_INT(t, sse, INT8, int8);
+    UCC_MC_CPU_SIMD_SET_INT(t, sse, UINT8, uint8);
+    UCC_MC_CPU_SIMD_SET_INT(t, sse, INT16, int16);
+    UCC_MC_CPU_SIMD_SET_INT(t, sse, UINT16, uint16);
+    UCC_MC_CPU_SIMD_SET_INT(t, sse, INT32, int32);
+    UCC_MC_CPU_SIMD_SET_INT(t, sse, UINT32, uint32);
+    UCC_MC_CPU_SIMD_SET(t, sse, INT32, int32, PROD, prod);
+    UCC_MC_CPU_SIMD_SET(t, sse, UINT32, uint32, PROD, prod);
+    UCC_MC_CPU_SIMD_SET(t, sse, INT64, int64, SUM, sum);
+    UCC_MC_CPU_SIMD_SET(t, sse, UINT64, uint64, SUM, sum);
+    UCC_MC_CPU_SIMD_SET_BITWISE(t, sse, INT64, int64);
+    UCC_MC_CPU_SIMD_SET_BITWISE(t, sse, UINT64, uint64);
+}
+
+static void ucc_mc_cpu_reduce_avx2_init(ucc_mc_cpu_reduce_table_t t,
+                                        int half_acc32)
+{
+    if (__builtin_cpu_supports("f16c")) {
+        UCC_MC_CPU_SIMD_SET_HALF(t, avx2, FLOAT16, float16, half_acc32);
+    }
+    UCC_MC_CPU_SIMD_SET_HALF(t, avx2, BFLOAT16, bfloat16, half_acc32);
+    UCC_MC_CPU_SIMD_SET_ARITH(t, avx2, FLOAT32, float);
+    UCC_MC_CPU_SIMD_SET(t, avx2, FLOAT32, float, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_ARITH(t, avx2, FLOAT64, double);
+    UCC_MC_CPU_SIMD_SET(t, avx2, FLOAT64, double, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx2, INT8, int8);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx2, UINT8, uint8);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx2, INT16, int16);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx2, UINT16, uint16);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx2, INT32, int32);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx2, UINT32, uint32);
+    UCC_MC_CPU_SIMD_SET(t, avx2, INT32, int32, PROD, prod);
+    UCC_MC_CPU_SIMD_SET(t, avx2, UINT32, uint32, PROD, prod);
+    UCC_MC_CPU_SIMD_SET(t, avx2, INT64, int64, SUM, sum);
+    UCC_MC_CPU_SIMD_SET(t, avx2, UINT64, uint64, SUM, sum);
+    UCC_MC_CPU_SIMD_SET_BITWISE(t, avx2, INT64, int64);
+    UCC_MC_CPU_SIMD_SET_BITWISE(t, avx2, UINT64, uint64);
+}
+
+static void ucc_mc_cpu_reduce_avx512_init(ucc_mc_cpu_reduce_table_t t,
+                                          int half_acc32)
+{
+#ifdef UCC_MC_CPU_SIMD_HAVE_BF16
+    if (__builtin_cpu_supports("avx512bf16")) {
+        UCC_MC_CPU_SIMD_SET_HALF(t, avx512bf16, BFLOAT16, bfloat16,
+                                 half_acc32);
+    }
+#endif
+    UCC_MC_CPU_SIMD_SET_HALF(t, avx512, FLOAT16, float16, half_acc32);
+    UCC_MC_CPU_SIMD_SET_HALF(t, avx512, BFLOAT16, bfloat16, half_acc32);
+    UCC_MC_CPU_SIMD_SET_ARITH(t, avx512, FLOAT32, float);
+    UCC_MC_CPU_SIMD_SET(t, avx512, FLOAT32, float, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_ARITH(t, avx512, FLOAT64, double);
+    UCC_MC_CPU_SIMD_SET(t, avx512, FLOAT64, double, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx512, INT32, int32);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx512, UINT32, uint32);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx512, INT64, int64);
+    UCC_MC_CPU_SIMD_SET_INT(t, avx512, UINT64, uint64);
+    UCC_MC_CPU_SIMD_SET(t, avx512, INT32, int32, PROD, prod);
+    UCC_MC_CPU_SIMD_SET(t, avx512, UINT32, uint32, PROD, prod);
+}
+
+#elif defined(__aarch64__)
+
+/* no non-temporal store intrinsics: regular stores are used */
+#define UCC_SIMD_ATTR_NEON
+#define UCC_MC_CPU_SIMD_FENCE_neon()
+
+#define NEON_KERNEL(_dt, _op, _type, _vec, _sfx, _vop, _sop)                   \
+    UCC_MC_CPU_SIMD_KERNEL(neon, UCC_SIMD_ATTR_NEON, _dt, _op, _type, _vec,    \
+                           vld1q_##_sfx, vst1q_##_sfx, vst1q_##_sfx,           \
+                           _vop##_##_sfx, _sop)
+
+#define NEON_BITWISE(_dt, _type, _vec, _sfx)                                   \
+    NEON_KERNEL(_dt, band, _type, _vec, _sfx, vandq, DO_OP_BAND)               \
+    NEON_KERNEL(_dt, bor, _type, _vec, _sfx, vorrq, DO_OP_BOR)                 \
+    NEON_KERNEL(_dt, bxor, _type, _vec, _sfx, veorq, DO_OP_BXOR)
+
+#define NEON_ARITH(_dt, _type, _vec, _sfx)                                     \
+    NEON_KERNEL(_dt, sum, _type, _vec, _sfx, vaddq, DO_OP_SUM)                 \
+    NEON_KERNEL(_dt, prod, _type, _vec, _sfx, vmulq, DO_OP_PROD)               \
+    NEON_KERNEL(_dt, max, _type, _vec, _sfx, vmaxq, DO_OP_MAX)                 \
+    NEON_KERNEL(_dt, min, _type, _vec, _sfx, vminq, DO_OP_MIN)
+
+NEON_ARITH(float, float, float32x4_t, f32)
+NEON_ARITH(double, double, float64x2_t, f64)
+NEON_ARITH(int8, int8_t, int8x16_t, s8)
+NEON_ARITH(uint8, uint8_t, uint8x16_t, u8)
+NEON_ARITH(int16, int16_t, int16x8_t, s16)
+NEON_ARITH(uint16, uint16_t, uint16x8_t, u16)
+NEON_ARITH(int32, int32_t, int32x4_t, s32)
+NEON_ARITH(uint32, uint32_t, uint32x4_t, u32)
+NEON_BITWISE(int8, int8_t, int8x16_t, s8)
+NEON_BITWISE(uint8, uint8_t, uint8x16_t, u8)
+NEON_BITWISE(int16, int16_t, int16x8_t, s16)
+NEON_BITWISE(uint16, uint16_t, uint16x8_t, u16)
+NEON_BITWISE(int32, int32_t, int32x4_t, s32)
+NEON_BITWISE(uint32, uint32_t, uint32x4_t, u32)
+NEON_KERNEL(int64, sum, int64_t, int64x2_t, s64, vaddq, DO_OP_SUM)
+NEON_KERNEL(uint64, sum, uint64_t, uint64x2_t, u64, vaddq, DO_OP_SUM)
+NEON_BITWISE(int64, int64_t, int64x2_t, s64)
+NEON_BITWISE(uint64, uint64_t, uint64x2_t, u64)
+
+#define NEON_LD_u16(_p)          vld1_u16((const uint16_t *)(_p))
+#define NEON_ST_u16(_p, _v)      vst1_u16((uint16_t *)(_p), _v)
+#define NEON_CVT_float16(_v)     vreinterpret_u16_f16(vcvt_f16_f32(_v))
+#define NEON_LD_float16(_p)                                                    \
+    vcvt_f32_f16(vreinterpret_f16_u16(NEON_LD_u16(_p)))
+#define NEON_ST_float16(_p, _v)   NEON_ST_u16(_p, NEON_CVT_float16(_v))
+#define NEON_STNT_float16(_p, _v) NEON_ST_float16(_p, _v)
+#define NEON_RND_float16(_v)      vcvt_f32_f16(vcvt_f16_f32(_v))
+
+/* rounds to nearest even keeping the result in the upper 16 bits, NaNs are
+   quieted */
+static inline uint32x4_t ucc_mc_cpu_neon_round_bfloat16(float32x4_t v)
+{
+    uint32x4_t u   = vreinterpretq_u32_f32(v);
+    uint32x4_t lsb = vandq_u32(vshrq_n_u32(u, 16), vdupq_n_u32(1));
+    uint32x4_t r   = vaddq_u32(u, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));
+
+    r = vbslq_u32(vceqq_f32(v, v), r, vorrq_u32(u, vdupq_n_u32(0x400000)));
+    return vandq_u32(r, vdupq_n_u32(0xffff0000));
+}
+
+#define NEON_LD_bfloat16(_p)                                                   \
+    vreinterpretq_f32_u32(vshll_n_u16(NEON_LD_u16(_p), 16))
+#define NEON_ST_bfloat16(_p, _v)                                               \
+    NEON_ST_u16(_p, vshrn_n_u32(ucc_mc_cpu_neon_round_bfloat16(_v), 16))
+#define NEON_STNT_bfloat16(_p, _v) NEON_ST_bfloat16(_p, _v)
+#define NEON_RND_bfloat16(_v)                                                  \
+    vreinterpretq_f32_u32(ucc_mc_cpu_neon_round_bfloat16(_v))
+
+UCC_MC_CPU_SIMD_HALF(neon, UCC_SIMD_ATTR_NEON, NEON, float16, float32x4_t,
+                     vaddq_f32, vmulq_f32, vmaxq_f32, vminq_f32)
+UCC_MC_CPU_SIMD_HALF(neon, UCC_SIMD_ATTR_NEON, NEON, bfloat16, float32x4_t,
+                     vaddq_f32, vmulq_f32, vmaxq_f32, vminq_f32)
+
+#define UCC_MC_CPU_SIMD_SET_NEON_INT(_table, _DT, _dt)                         \
+    UCC_MC_CPU_SIMD_SET_ARITH(_table, neon, _DT, _dt);                         \
+    UCC_MC_CPU_SIMD_SET(_table, neon, _DT, _dt, PROD, prod);                   \
+    UCC_MC_CPU_SIMD_SET_BITWISE(_table, neon, _DT, _dt)
+
+static void ucc_mc_cpu_reduce_neon_init(ucc_mc_cpu_reduce_table_t t,
+                                        int half_acc32)
+{
+    UCC_MC_CPU_SIMD_SET_HALF(t, neon, FLOAT16, float16, half_acc32);
+    UCC_MC_CPU_SIMD_SET_HALF(t, neon, BFLOAT16, bfloat16, half_acc32);
+    UCC_MC_CPU_SIMD_SET_ARITH(t, neon, FLOAT32, float);
+    UCC_MC_CPU_SIMD_SET(t, neon, FLOAT32, float, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_ARITH(t, neon, FLOAT64, double);
+    UCC_MC_CPU_SIMD_SET(t, neon, FLOAT64, double, PROD, prod);
+    UCC_MC_CPU_SIMD_SET_NEON_INT(t, INT8, int8);
+    UCC_MC_CPU_SIMD_SET_NEON_INT(t, UINT8, uint8);
+    UCC_MC_CPU_SIMD_SET_NEON_INT(t, INT16, int16);
+    UCC_MC_CPU_SIMD_SET_NEON_INT(t, UINT16, uint16);
+    UCC_MC_CPU_SIMD_SET_NEON_INT(t, INT32, int32);
+    UCC_MC_CPU_SIMD_SET_NEON_INT(t, UINT32, uint32);
+    UCC_MC_CPU_SIMD_SET(t, neon, INT64, int64, SUM, sum);
+    UCC_MC_CPU_SIMD_SET(t, neon, UINT64, uint64, SUM, sum);
+    UCC_MC_CPU_SIMD_SET_BITWISE(t, neon, INT64, int64);
+    UCC_MC_CPU_SIMD_SET_BITWISE(t, neon, UINT64, uint64);
+}
+
+#endif
+
+static ucc_mc_cpu_simd_t ucc_mc_cpu_simd_supported(void)
+{
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return UCC_MC_CPU_SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return UCC_MC_CPU_SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return UCC_MC_CPU_SIMD_SSE;
+    }
+#elif defined(__aarch64__)
+    return UCC_MC_CPU_SIMD_NEON;
+#endif
+    return UCC_MC_CPU_SIMD_NONE;
+}
+
+ucc_mc_cpu_simd_t
+ucc_mc_cpu_reduce_simd_init(ucc_mc_cpu_simd_t simd, int half_acc32,
+                            ucc_mc_cpu_reduce_table_t table)
+{
+    ucc_mc_cpu_simd_t supported = ucc_mc_cpu_simd_supported();
+
+    memset(table, 0, sizeof(ucc_mc_cpu_reduce_table_t));
+    if (simd == UCC_MC_CPU_SIMD_AUTO) {
+        simd = supported;
+    } else if (simd != UCC_MC_CPU_SIMD_NONE &&
+               (simd > supported || ((simd == UCC_MC_CPU_SIMD_NEON) !=
+                                     (supported == UCC_MC_CPU_SIMD_NEON)))) {
+        mc_warn(&ucc_mc_cpu.super, "%s reduction kernels are not supported "
+                "by the CPU, using %s", ucc_mc_cpu_simd_names[simd],
+                ucc_mc_cpu_simd_names[supported]);
+        simd = supported;
+    }
+    switch (simd) {
+#if defined(__x86_64__)
+    case UCC_MC_CPU_SIMD_AVX512:
+        ucc_mc_cpu_reduce_avx512_init(table, half_acc32);
+        /* fall through */
+    case UCC_MC_CPU_SIMD_AVX2:
+        ucc_mc_cpu_reduce_avx2_init(table, half_acc32);
+        /* fall through */
+    case UCC_MC_CPU_SIMD_SSE:
+        ucc_mc_cpu_reduce_sse_init(table);
+        break;
+#elif defined(__aarch64__)
+    case UCC_MC_CPU_SIMD_NEON:
+        ucc_mc_cpu_reduce_neon_init(table, half_acc32);
+        break;
+#endif
+    default:
+        break;
+    }
+    return simd;
+}
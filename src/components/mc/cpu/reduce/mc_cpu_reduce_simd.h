@@ -0,0 +1,47 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_MC_CPU_REDUCE_SIMD_H_
+#define UCC_MC_CPU_REDUCE_SIMD_H_
+
+#include "config.h"
+#include "utils/ucc_math.h"
+
+typedef enum ucc_mc_cpu_simd {
+    UCC_MC_CPU_SIMD_AUTO,
+    UCC_MC_CPU_SIMD_NONE,
+    UCC_MC_CPU_SIMD_SSE,
+    UCC_MC_CPU_SIMD_AVX2,
+    UCC_MC_CPU_SIMD_AVX512,
+    UCC_MC_CPU_SIMD_NEON,
+    UCC_MC_CPU_SIMD_LAST
+} ucc_mc_cpu_simd_t;
+
+extern const char *ucc_mc_cpu_simd_names[];
+
+#define UCC_MC_CPU_REDUCE_N_DT  UCC_DT_LAST
+#define UCC_MC_CPU_REDUCE_N_OPS 13 /* ucc_ilog2(UCC_OP_MINLOC) + 1 */
+
+/* same arguments as reduce_multi of the given datatype and op, nt - use
+   non temporal stores for dst */
+typedef ucc_status_t (*ucc_mc_cpu_reduce_fn_t)(const void *src1,
+                                               const void *src2, void *dst,
+                                               size_t size, size_t count,
+                                               size_t stride, int nt);
+
+typedef ucc_mc_cpu_reduce_fn_t
+    ucc_mc_cpu_reduce_table_t[UCC_MC_CPU_REDUCE_N_DT][UCC_MC_CPU_REDUCE_N_OPS];
+
+/* Fills the table with the vectorized kernels of the requested instruction
+   set (or of the best one supported by the CPU if simd is AUTO), the pairs
+   of datatype and op without a kernel are left NULL. half_acc32 selects the
+   float16 and bfloat16 kernels accumulating in float32. Returns the selected
+   instruction set */
+ucc_mc_cpu_simd_t
+ucc_mc_cpu_reduce_simd_init(ucc_mc_cpu_simd_t simd, int half_acc32,
+                            ucc_mc_cpu_reduce_table_t table);
+
+#endif
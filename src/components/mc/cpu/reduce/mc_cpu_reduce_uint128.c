@@ -0,0 +1,16 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+#include "mc_cpu.h"
+#include "reduce/mc_cpu_reduce.h"
+
+#ifdef __SIZEOF_INT128__
+REDUCE_FN_DECLARE(uint128)
+{
+    DO_DT_REDUCE_INT(unsigned __int128, op, src1, src2, dst, size, count,
+                     stride);
+    return UCC_OK;
+}
+#endif
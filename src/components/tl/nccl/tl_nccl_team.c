@@ -18,6 +18,12 @@ UCC_CLASS_INIT_FUNC(ucc_tl_nccl_team_t, ucc_base_context_t *tl_context,
     ucc_status_t status;
 
     UCC_CLASS_CALL_SUPER_INIT(ucc_tl_team_t, &ctx->super, params->team);
+    if (params->size != params->params.oob.participants) {
+        /* nccl bootstrap goes over the core team oob */
+        tl_debug(ctx->super.super.lib,
+                 "teams over a subset of core team are not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
     self->oob       = params->params.oob;
     self->size      = self->oob.participants;
     self->rank      = params->rank;
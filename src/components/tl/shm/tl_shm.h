@@ -0,0 +1,114 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TL_SHM_H_
+#define UCC_TL_SHM_H_
+
+#include "components/tl/ucc_tl.h"
+#include "components/tl/ucc_tl_log.h"
+#include "utils/ucc_mpool.h"
+
+#ifndef UCC_TL_SHM_DEFAULT_SCORE
+#define UCC_TL_SHM_DEFAULT_SCORE 20
+#endif
+
+#define UCC_TL_SHM_SEG_READY  0x53484d52454459ULL
+#define UCC_TL_SHM_NAME_LEN   64
+
+typedef struct ucc_tl_shm_iface {
+    ucc_tl_iface_t super;
+} ucc_tl_shm_iface_t;
+
+extern ucc_tl_shm_iface_t ucc_tl_shm;
+
+typedef struct ucc_tl_shm_lib_config {
+    ucc_tl_lib_config_t super;
+    size_t              slot_size;
+} ucc_tl_shm_lib_config_t;
+
+typedef struct ucc_tl_shm_context_config {
+    ucc_tl_context_config_t super;
+} ucc_tl_shm_context_config_t;
+
+typedef struct ucc_tl_shm_lib {
+    ucc_tl_lib_t            super;
+    ucc_tl_shm_lib_config_t cfg;
+} ucc_tl_shm_lib_t;
+UCC_CLASS_DECLARE(ucc_tl_shm_lib_t, const ucc_base_lib_params_t *,
+                  const ucc_base_config_t *);
+
+typedef struct ucc_tl_shm_context {
+    ucc_tl_context_t            super;
+    ucc_tl_shm_context_config_t cfg;
+    ucc_mpool_t                 req_mp;
+    uint64_t                    nonce; /* published in the context address */
+} ucc_tl_shm_context_t;
+UCC_CLASS_DECLARE(ucc_tl_shm_context_t, const ucc_base_context_params_t *,
+                  const ucc_base_config_t *);
+
+/* Segment header, written by team rank 0 only. nonce is the one of the
+   rank 0 context: a segment left by a crashed process with the same name
+   has a different one */
+typedef struct ucc_tl_shm_seg_header {
+    volatile uint64_t ready;
+    volatile uint64_t nonce;
+    volatile uint32_t n_attached;
+} ucc_tl_shm_seg_header_t;
+
+/* Per rank control line. Every field is written by the owner rank only
+   and holds the sequence number of the last collective that reached the
+   corresponding step:
+   arrive  - the rank entered the collective, its data slot is filled;
+   release - (root only) the result is available / everybody arrived;
+   ack     - the rank is done reading the data of the root */
+typedef struct ucc_tl_shm_ctrl {
+    volatile uint64_t arrive;
+    volatile uint64_t release;
+    volatile uint64_t ack;
+} ucc_tl_shm_ctrl_t;
+
+/* Segment layout:
+   | header | ctrl 0 | .. | ctrl N-1 | slot 0 | .. | slot N-1 |
+   every element starts at the cache line boundary */
+typedef struct ucc_tl_shm_team {
+    ucc_tl_team_t  super;
+    ucc_rank_t     rank;
+    ucc_rank_t     size;
+    ucc_ep_map_t   map; /* team rank -> core team rank */
+    char           seg_name[UCC_TL_SHM_NAME_LEN];
+    int            seg_fd;
+    void          *seg;
+    size_t         seg_size;
+    size_t         ctrl_stride;
+    size_t         slot_stride;
+    size_t         slot_size;
+    int            attached;
+    uint64_t       nonce; /* of the rank 0 context */
+    uint64_t       seq_num;  /* seq of the last started collective */
+    uint64_t       seq_done; /* seq of the last completed collective */
+} ucc_tl_shm_team_t;
+UCC_CLASS_DECLARE(ucc_tl_shm_team_t, ucc_base_context_t *,
+                  const ucc_base_team_params_t *);
+
+#define UCC_TL_SHM_SUPPORTED_COLLS                                             \
+    (UCC_COLL_TYPE_BARRIER | UCC_COLL_TYPE_FANIN | UCC_COLL_TYPE_FANOUT |      \
+     UCC_COLL_TYPE_BCAST | UCC_COLL_TYPE_ALLREDUCE)
+
+#define UCC_TL_SHM_TEAM_LIB(_team)                                             \
+    (ucc_derived_of((_team)->super.super.context->lib, ucc_tl_shm_lib_t))
+
+#define UCC_TL_SHM_SEG_HEADER(_team)                                           \
+    ((ucc_tl_shm_seg_header_t *)(_team)->seg)
+
+#define UCC_TL_SHM_CTRL(_team, _rank)                                          \
+    ((ucc_tl_shm_ctrl_t *)PTR_OFFSET((_team)->seg,                            \
+                                     ((_rank) + 1) * (_team)->ctrl_stride))
+
+#define UCC_TL_SHM_SLOT(_team, _rank)                                          \
+    PTR_OFFSET((_team)->seg, ((_team)->size + 1) * (_team)->ctrl_stride +     \
+                                 (_rank) * (_team)->slot_stride)
+
+#endif
@@ -0,0 +1,369 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_shm_coll.h"
+#include "core/ucc_mc.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_atomic.h"
+#include "utils/ucc_coll_utils.h"
+
+/* All the algorithms are flat: the root (rank 0 for barrier and allreduce)
+   polls the ctrl lines of the other ranks and they poll the ctrl line of
+   the root. Every rank writes its own ctrl line and its own data slot only.
+   A slot is rewritten by its owner only after the owner has completed the
+   previous collective, and an owner completes a collective only after all
+   the readers of its slot are done, so collectives of a team are
+   progressed strictly in the order they were started. */
+
+enum {
+    UCC_TL_SHM_PHASE_POST,
+    UCC_TL_SHM_PHASE_WAIT_ARRIVE,
+    UCC_TL_SHM_PHASE_WAIT_RELEASE,
+    UCC_TL_SHM_PHASE_WAIT_ACK
+};
+
+#define UCC_TL_SHM_CTRL_FIELD(_team, _rank, _field_offset)                     \
+    (*(volatile uint64_t *)PTR_OFFSET(UCC_TL_SHM_CTRL(_team, _rank),           \
+                                      _field_offset))
+
+/* Returns 1 when all the ranks but the root have set the ctrl field to the
+   seq number of the task. The position is saved in the task so that the
+   ranks which already reached the step are not polled again. */
+static inline int ucc_tl_shm_peers_reached(ucc_tl_shm_task_t *task,
+                                           size_t             field_offset)
+{
+    ucc_tl_shm_team_t *team = task->team;
+
+    for (; task->peer < team->size; task->peer++) {
+        if (task->peer == task->root) {
+            continue;
+        }
+        if (UCC_TL_SHM_CTRL_FIELD(team, task->peer, field_offset) <
+            task->seq_num) {
+            return 0;
+        }
+    }
+    task->peer = 0;
+    ucc_memory_cpu_load_fence();
+    return 1;
+}
+
+static inline int ucc_tl_shm_root_reached(ucc_tl_shm_task_t *task)
+{
+    if (UCC_TL_SHM_CTRL(task->team, task->root)->release < task->seq_num) {
+        return 0;
+    }
+    ucc_memory_cpu_load_fence();
+    return 1;
+}
+
+static inline void ucc_tl_shm_task_done(ucc_tl_shm_task_t *task)
+{
+    task->team->seq_done     = task->seq_num;
+    task->super.super.status = UCC_OK;
+}
+
+static ucc_status_t ucc_tl_shm_coll_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = task->team;
+
+    task->seq_num            = ++team->seq_num;
+    task->phase              = UCC_TL_SHM_PHASE_POST;
+    task->peer               = 0;
+    task->super.super.status = UCC_INPROGRESS;
+    ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_tl_shm_coll_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+
+    tl_info(UCC_TL_TEAM_LIB(task->team), "finalizing coll task %p", task);
+    ucc_mpool_put(task);
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_tl_shm_barrier_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = task->team;
+
+    if (team->seq_done + 1 != task->seq_num) {
+        return UCC_INPROGRESS;
+    }
+    switch (task->phase) {
+    case UCC_TL_SHM_PHASE_POST:
+        if (team->rank == task->root) {
+            task->phase = UCC_TL_SHM_PHASE_WAIT_ARRIVE;
+        } else {
+            UCC_TL_SHM_CTRL(team, team->rank)->arrive = task->seq_num;
+            task->phase = UCC_TL_SHM_PHASE_WAIT_RELEASE;
+        }
+        return ucc_tl_shm_barrier_progress(coll_task);
+    case UCC_TL_SHM_PHASE_WAIT_ARRIVE:
+        if (!ucc_tl_shm_peers_reached(task,
+                                      ucc_offsetof(ucc_tl_shm_ctrl_t, arrive))) {
+            return UCC_INPROGRESS;
+        }
+        UCC_TL_SHM_CTRL(team, team->rank)->release = task->seq_num;
+        break;
+    case UCC_TL_SHM_PHASE_WAIT_RELEASE:
+        if (!ucc_tl_shm_root_reached(task)) {
+            return UCC_INPROGRESS;
+        }
+        break;
+    }
+    ucc_tl_shm_task_done(task);
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_tl_shm_fanin_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = task->team;
+
+    if (team->seq_done + 1 != task->seq_num) {
+        return UCC_INPROGRESS;
+    }
+    if (team->rank != task->root) {
+        UCC_TL_SHM_CTRL(team, team->rank)->arrive = task->seq_num;
+    } else if (!ucc_tl_shm_peers_reached(
+                   task, ucc_offsetof(ucc_tl_shm_ctrl_t, arrive))) {
+        return UCC_INPROGRESS;
+    }
+    ucc_tl_shm_task_done(task);
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_tl_shm_fanout_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = task->team;
+
+    if (team->seq_done + 1 != task->seq_num) {
+        return UCC_INPROGRESS;
+    }
+    if (team->rank == task->root) {
+        UCC_TL_SHM_CTRL(team, team->rank)->release = task->seq_num;
+    } else if (!ucc_tl_shm_root_reached(task)) {
+        return UCC_INPROGRESS;
+    }
+    ucc_tl_shm_task_done(task);
+    return UCC_OK;
+}
+
+/* root: copy to the own slot -> release -> wait for all acks
+   others: wait for release -> copy from the root slot -> ack */
+static ucc_status_t ucc_tl_shm_bcast_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team = task->team;
+    void              *buf  = task->args.src.info.buffer;
+
+    if (team->seq_done + 1 != task->seq_num) {
+        return UCC_INPROGRESS;
+    }
+    if (team->rank == task->root) {
+        if (task->phase == UCC_TL_SHM_PHASE_POST) {
+            memcpy(UCC_TL_SHM_SLOT(team, team->rank), buf, task->data_size);
+            ucc_memory_cpu_store_fence();
+            UCC_TL_SHM_CTRL(team, team->rank)->release = task->seq_num;
+            task->phase = UCC_TL_SHM_PHASE_WAIT_ACK;
+        }
+        if (!ucc_tl_shm_peers_reached(task,
+                                      ucc_offsetof(ucc_tl_shm_ctrl_t, ack))) {
+            return UCC_INPROGRESS;
+        }
+    } else {
+        if (!ucc_tl_shm_root_reached(task)) {
+            return UCC_INPROGRESS;
+        }
+        memcpy(buf, UCC_TL_SHM_SLOT(team, task->root), task->data_size);
+        ucc_memory_cpu_fence();
+        UCC_TL_SHM_CTRL(team, team->rank)->ack = task->seq_num;
+    }
+    ucc_tl_shm_task_done(task);
+    return UCC_OK;
+}
+
+/* all: copy src to the own slot -> arrive
+   rank 0: wait for all arrives -> reduce all slots into slot 0 -> release ->
+           wait for all acks
+   others: wait for release -> copy the result from slot 0 -> ack */
+static ucc_status_t ucc_tl_shm_allreduce_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_shm_task_t *task  = ucc_derived_of(coll_task, ucc_tl_shm_task_t);
+    ucc_tl_shm_team_t *team  = task->team;
+    void              *dst   = task->args.dst.info.buffer;
+    void              *src   = UCC_IS_INPLACE(task->args)
+                                   ? dst : task->args.src.info.buffer;
+    void              *slot0 = UCC_TL_SHM_SLOT(team, 0);
+    ucc_status_t       status;
+
+    if (team->seq_done + 1 != task->seq_num) {
+        return UCC_INPROGRESS;
+    }
+    switch (task->phase) {
+    case UCC_TL_SHM_PHASE_POST:
+        memcpy(UCC_TL_SHM_SLOT(team, team->rank), src, task->data_size);
+        ucc_memory_cpu_store_fence();
+        UCC_TL_SHM_CTRL(team, team->rank)->arrive = task->seq_num;
+        task->phase = (team->rank == task->root) ? UCC_TL_SHM_PHASE_WAIT_ARRIVE
+                                                 : UCC_TL_SHM_PHASE_WAIT_RELEASE;
+        return ucc_tl_shm_allreduce_progress(coll_task);
+    case UCC_TL_SHM_PHASE_WAIT_ARRIVE:
+        if (!ucc_tl_shm_peers_reached(task,
+                                      ucc_offsetof(ucc_tl_shm_ctrl_t, arrive))) {
+            return UCC_INPROGRESS;
+        }
+        if (team->size > 1) {
+            status = ucc_dt_reduce_multi(
+                slot0, UCC_TL_SHM_SLOT(team, 1), slot0, team->size - 1,
+                task->args.dst.info.count, team->slot_stride,
+                task->args.dst.info.datatype, UCC_MEMORY_TYPE_HOST,
+                &task->args);
+            if (ucc_unlikely(UCC_OK != status)) {
+                tl_error(UCC_TL_TEAM_LIB(team),
+                         "failed to perform dt reduction");
+                task->super.super.status = status;
+                return status;
+            }
+        }
+        memcpy(dst, slot0, task->data_size);
+        ucc_memory_cpu_store_fence();
+        UCC_TL_SHM_CTRL(team, team->rank)->release = task->seq_num;
+        task->phase = UCC_TL_SHM_PHASE_WAIT_ACK;
+        /* fall through */
+    case UCC_TL_SHM_PHASE_WAIT_ACK:
+        if (!ucc_tl_shm_peers_reached(task,
+                                      ucc_offsetof(ucc_tl_shm_ctrl_t, ack))) {
+            return UCC_INPROGRESS;
+        }
+        break;
+    case UCC_TL_SHM_PHASE_WAIT_RELEASE:
+        if (!ucc_tl_shm_root_reached(task)) {
+            return UCC_INPROGRESS;
+        }
+        memcpy(dst, slot0, task->data_size);
+        ucc_memory_cpu_fence();
+        UCC_TL_SHM_CTRL(team, team->rank)->ack = task->seq_num;
+        break;
+    }
+    ucc_tl_shm_task_done(task);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_barrier_init(ucc_tl_shm_task_t *task)
+{
+    task->root           = 0;
+    task->super.progress = ucc_tl_shm_barrier_progress;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_fanin_init(ucc_tl_shm_task_t *task)
+{
+    task->root           = task->args.root;
+    task->super.progress = ucc_tl_shm_fanin_progress;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_fanout_init(ucc_tl_shm_task_t *task)
+{
+    task->root           = task->args.root;
+    task->super.progress = ucc_tl_shm_fanout_progress;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_bcast_init(ucc_tl_shm_task_t *task)
+{
+    ucc_coll_args_t *args = &task->args;
+
+    if (args->src.info.mem_type != UCC_MEMORY_TYPE_HOST) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task->data_size = args->src.info.count *
+                      ucc_dt_size(args->src.info.datatype);
+    if (task->data_size > task->team->slot_size) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task->root           = args->root;
+    task->super.progress = ucc_tl_shm_bcast_progress;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_allreduce_init(ucc_tl_shm_task_t *task)
+{
+    ucc_coll_args_t *args = &task->args;
+
+    if ((args->dst.info.mem_type != UCC_MEMORY_TYPE_HOST) ||
+        (!UCC_IS_INPLACE(*args) &&
+         args->src.info.mem_type != UCC_MEMORY_TYPE_HOST)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task->data_size = args->dst.info.count *
+                      ucc_dt_size(args->dst.info.datatype);
+    if (task->data_size > task->team->slot_size) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task->root           = 0;
+    task->super.progress = ucc_tl_shm_allreduce_progress;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_coll_init(ucc_base_coll_args_t *coll_args,
+                                  ucc_base_team_t      *team,
+                                  ucc_coll_task_t     **task_h)
+{
+    ucc_tl_shm_team_t    *shm_team = ucc_derived_of(team, ucc_tl_shm_team_t);
+    ucc_tl_shm_context_t *shm_ctx  = ucc_derived_of(team->context,
+                                                    ucc_tl_shm_context_t);
+    ucc_tl_shm_task_t    *task;
+    ucc_status_t          status;
+
+    task = ucc_mpool_get(&shm_ctx->req_mp);
+    if (ucc_unlikely(!task)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    ucc_coll_task_init(&task->super);
+    memcpy(&task->args, &coll_args->args, sizeof(ucc_coll_args_t));
+    task->team           = shm_team;
+    task->super.post     = ucc_tl_shm_coll_start;
+    task->super.finalize = ucc_tl_shm_coll_finalize;
+    switch (coll_args->args.coll_type) {
+    case UCC_COLL_TYPE_BARRIER:
+        status = ucc_tl_shm_barrier_init(task);
+        break;
+    case UCC_COLL_TYPE_FANIN:
+        status = ucc_tl_shm_fanin_init(task);
+        break;
+    case UCC_COLL_TYPE_FANOUT:
+        status = ucc_tl_shm_fanout_init(task);
+        break;
+    case UCC_COLL_TYPE_BCAST:
+        status = ucc_tl_shm_bcast_init(task);
+        break;
+    case UCC_COLL_TYPE_ALLREDUCE:
+        status = ucc_tl_shm_allreduce_init(task);
+        break;
+    default:
+        tl_error(UCC_TL_TEAM_LIB(shm_team),
+                 "collective %d is not supported by shm tl",
+                 coll_args->args.coll_type);
+        status = UCC_ERR_NOT_SUPPORTED;
+    }
+    if (ucc_unlikely(status != UCC_OK)) {
+        goto free_task;
+    }
+    tl_info(UCC_TL_TEAM_LIB(shm_team), "init coll task %p", task);
+    *task_h = &task->super;
+    return status;
+
+free_task:
+    ucc_mpool_put(task);
+    return status;
+}
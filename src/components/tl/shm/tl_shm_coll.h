@@ -0,0 +1,37 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TL_SHM_COLL_H_
+#define UCC_TL_SHM_COLL_H_
+
+#include "tl_shm.h"
+
+typedef struct ucc_tl_shm_task {
+    ucc_coll_task_t    super;
+    ucc_tl_shm_team_t *team;
+    ucc_coll_args_t    args;
+    uint64_t           seq_num;
+    int                phase;
+    ucc_rank_t         root;
+    ucc_rank_t         peer; /* next rank to poll */
+    size_t             data_size;
+} ucc_tl_shm_task_t;
+
+ucc_status_t ucc_tl_shm_coll_init(ucc_base_coll_args_t *coll_args,
+                                  ucc_base_team_t      *team,
+                                  ucc_coll_task_t     **task);
+
+ucc_status_t ucc_tl_shm_barrier_init(ucc_tl_shm_task_t *task);
+
+ucc_status_t ucc_tl_shm_fanin_init(ucc_tl_shm_task_t *task);
+
+ucc_status_t ucc_tl_shm_fanout_init(ucc_tl_shm_task_t *task);
+
+ucc_status_t ucc_tl_shm_bcast_init(ucc_tl_shm_task_t *task);
+
+ucc_status_t ucc_tl_shm_allreduce_init(ucc_tl_shm_task_t *task);
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_shm.h"
+#include "tl_shm_coll.h"
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+
+static ucc_mpool_ops_t ucc_tl_shm_req_mpool_ops = {
+    .chunk_alloc   = ucc_mpool_hugetlb_malloc,
+    .chunk_release = ucc_mpool_hugetlb_free,
+    .obj_init      = NULL,
+    .obj_cleanup   = NULL
+};
+
+UCC_CLASS_INIT_FUNC(ucc_tl_shm_context_t,
+                    const ucc_base_context_params_t *params,
+                    const ucc_base_config_t *config)
+{
+    ucc_tl_shm_context_config_t *tl_shm_config =
+        ucc_derived_of(config, ucc_tl_shm_context_config_t);
+    struct timespec              ts;
+    ucc_status_t                 status;
+
+    UCC_CLASS_CALL_SUPER_INIT(ucc_tl_context_t, tl_shm_config->super.tl_lib,
+                              params->context);
+    memcpy(&self->cfg, tl_shm_config, sizeof(*tl_shm_config));
+    status = ucc_mpool_init(&self->req_mp, 0, sizeof(ucc_tl_shm_task_t), 0,
+                            UCC_CACHE_LINE_SIZE, 8, UINT_MAX,
+                            &ucc_tl_shm_req_mpool_ops, params->thread_mode,
+                            "tl_shm_req_mp");
+    if (status != UCC_OK) {
+        tl_error(self->super.super.lib,
+                 "failed to initialize tl_shm_req mpool");
+        return status;
+    }
+    /* identifies the shm segments created by this context */
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    self->nonce = ((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec) ^
+                  ((uint64_t)getpid() << 40);
+    tl_info(self->super.super.lib, "initialized tl context: %p", self);
+    return UCC_OK;
+}
+
+UCC_CLASS_CLEANUP_FUNC(ucc_tl_shm_context_t)
+{
+    tl_info(self->super.super.lib, "finalizing tl context: %p", self);
+    ucc_mpool_cleanup(&self->req_mp, 1);
+}
+
+UCC_CLASS_DEFINE(ucc_tl_shm_context_t, ucc_tl_context_t);
+
+ucc_status_t
+ucc_tl_shm_get_context_attr(const ucc_base_context_t *context,
+                            ucc_base_ctx_attr_t      *attr)
+{
+    ucc_tl_shm_context_t *ctx = ucc_derived_of(context, ucc_tl_shm_context_t);
+
+    if (attr->attr.mask & UCC_CONTEXT_ATTR_FIELD_CTX_ADDR_LEN) {
+        attr->attr.ctx_addr_len = sizeof(ctx->nonce);
+    }
+    if (attr->attr.mask & UCC_CONTEXT_ATTR_FIELD_CTX_ADDR) {
+        memcpy(attr->attr.ctx_addr, &ctx->nonce, sizeof(ctx->nonce));
+    }
+    return UCC_OK;
+}
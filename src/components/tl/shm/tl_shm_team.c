@@ -0,0 +1,285 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_shm.h"
+#include "tl_shm_coll.h"
+#include "core/ucc_team.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_atomic.h"
+#include "coll_score/ucc_coll_score.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+/* Rank 0 of the team creates and initializes the segment, the other ranks
+   poll for it in create_test. The segment name is derived from the
+   identity of the rank 0 context (pid + context seq number) and the team
+   id/scope, so it is known to all the ranks without an oob exchange. The
+   nonce of the rank 0 context (context address) tells the segment of this
+   team from a leftover of a crashed process with the same name. */
+static ucc_status_t ucc_tl_shm_seg_create(ucc_tl_shm_team_t *team)
+{
+    ucc_tl_shm_seg_header_t *header;
+    ucc_status_t             status;
+    int                      fd;
+
+    /* remove a leftover of a crashed process with the same pid, if any */
+    shm_unlink(team->seg_name);
+    fd = shm_open(team->seg_name, O_CREAT | O_EXCL | O_RDWR,
+                  S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        tl_error(UCC_TL_TEAM_LIB(team), "shm_open %s failed: %s",
+                 team->seg_name, strerror(errno));
+        return UCC_ERR_NO_RESOURCE;
+    }
+    if (0 != ftruncate(fd, team->seg_size)) {
+        tl_error(UCC_TL_TEAM_LIB(team), "ftruncate %s to %zd failed: %s",
+                 team->seg_name, team->seg_size, strerror(errno));
+        status = UCC_ERR_NO_RESOURCE;
+        goto err_unlink;
+    }
+    team->seg = mmap(NULL, team->seg_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+    if (team->seg == MAP_FAILED) {
+        tl_error(UCC_TL_TEAM_LIB(team), "mmap %s of %zd bytes failed: %s",
+                 team->seg_name, team->seg_size, strerror(errno));
+        team->seg = NULL;
+        status    = UCC_ERR_NO_MEMORY;
+        goto err_unlink;
+    }
+    close(fd);
+    /* ftruncate zeroes the segment: all the ctrl flags are 0 */
+    header             = UCC_TL_SHM_SEG_HEADER(team);
+    header->n_attached = 0;
+    header->nonce      = team->nonce;
+    ucc_memory_cpu_store_fence();
+    header->ready      = UCC_TL_SHM_SEG_READY;
+    team->attached     = 1;
+    return UCC_OK;
+
+err_unlink:
+    close(fd);
+    shm_unlink(team->seg_name);
+    return status;
+}
+
+/* drops the segment opened by a non root rank: it is either not created by
+   rank 0 yet or it is a stale one that rank 0 unlinks and creates again */
+static ucc_status_t ucc_tl_shm_seg_retry(ucc_tl_shm_team_t *team)
+{
+    if (team->seg) {
+        munmap(team->seg, team->seg_size);
+        team->seg = NULL;
+    }
+    close(team->seg_fd);
+    team->seg_fd = -1;
+    return UCC_INPROGRESS;
+}
+
+static ucc_status_t ucc_tl_shm_seg_attach(ucc_tl_shm_team_t *team)
+{
+    ucc_tl_shm_seg_header_t *header;
+    struct stat              st;
+
+    if (team->seg_fd < 0) {
+        team->seg_fd = shm_open(team->seg_name, O_RDWR, 0);
+        if (team->seg_fd < 0) {
+            if (errno == ENOENT) {
+                return UCC_INPROGRESS;
+            }
+            tl_error(UCC_TL_TEAM_LIB(team), "shm_open %s failed: %s",
+                     team->seg_name, strerror(errno));
+            return UCC_ERR_NO_RESOURCE;
+        }
+    }
+    if (!team->seg) {
+        if (0 != fstat(team->seg_fd, &st)) {
+            tl_error(UCC_TL_TEAM_LIB(team), "fstat %s failed: %s",
+                     team->seg_name, strerror(errno));
+            return UCC_ERR_NO_RESOURCE;
+        }
+        if ((size_t)st.st_size != team->seg_size) {
+            /* rank 0 did not truncate the segment yet */
+            return ucc_tl_shm_seg_retry(team);
+        }
+        team->seg = mmap(NULL, team->seg_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, team->seg_fd, 0);
+        if (team->seg == MAP_FAILED) {
+            tl_error(UCC_TL_TEAM_LIB(team), "mmap %s of %zd bytes failed: %s",
+                     team->seg_name, team->seg_size, strerror(errno));
+            team->seg = NULL;
+            return UCC_ERR_NO_MEMORY;
+        }
+    }
+    header = UCC_TL_SHM_SEG_HEADER(team);
+    if (header->ready != UCC_TL_SHM_SEG_READY) {
+        return ucc_tl_shm_seg_retry(team);
+    }
+    ucc_memory_cpu_load_fence();
+    if (header->nonce != team->nonce) {
+        tl_debug(UCC_TL_TEAM_LIB(team), "stale segment %s", team->seg_name);
+        return ucc_tl_shm_seg_retry(team);
+    }
+    close(team->seg_fd);
+    team->seg_fd   = -1;
+    team->attached = 1;
+    ucc_atomic_add32(&header->n_attached, 1);
+    return UCC_OK;
+}
+
+UCC_CLASS_INIT_FUNC(ucc_tl_shm_team_t, ucc_base_context_t *tl_context,
+                    const ucc_base_team_params_t *params)
+{
+    ucc_tl_shm_context_t      *ctx =
+        ucc_derived_of(tl_context, ucc_tl_shm_context_t);
+    ucc_tl_shm_lib_t          *lib =
+        ucc_derived_of(tl_context->lib, ucc_tl_shm_lib_t);
+    ucc_context_t             *core_ctx  = tl_context->ucc_context;
+    ucc_context_addr_header_t *h0;
+    ucc_host_id_t              host_hash;
+    ucc_rank_t                 r;
+
+    UCC_CLASS_CALL_SUPER_INIT(ucc_tl_team_t, &ctx->super, params->team);
+    self->size     = params->size;
+    self->rank     = params->rank;
+    self->map      = params->map;
+    self->seg      = NULL;
+    self->seg_fd   = -1;
+    self->attached = 0;
+    self->seq_num  = 0;
+    self->seq_done = 0;
+
+    h0        = ucc_get_team_ep_header(core_ctx, params->team,
+                                       ucc_ep_map_eval(self->map, 0));
+    host_hash = h0->ctx_id.pi.host_hash;
+    for (r = 1; r < self->size; r++) {
+        if (ucc_get_team_ep_header(core_ctx, params->team,
+                                   ucc_ep_map_eval(self->map, r))
+                ->ctx_id.pi.host_hash != host_hash) {
+            tl_debug(tl_context->lib, "team spans multiple nodes");
+            return UCC_ERR_NOT_SUPPORTED;
+        }
+    }
+
+    self->nonce = *(uint64_t *)ucc_get_team_ep_addr(
+        core_ctx, params->team, ucc_ep_map_eval(self->map, 0),
+        ucc_tl_shm.super.super.id);
+
+    self->slot_size   = lib->cfg.slot_size;
+    self->ctrl_stride = ucc_align_up(sizeof(ucc_tl_shm_ctrl_t),
+                                     UCC_CACHE_LINE_SIZE);
+    self->slot_stride = ucc_align_up(self->slot_size, UCC_CACHE_LINE_SIZE);
+    self->seg_size    = (self->size + 1) * self->ctrl_stride +
+                        self->size * self->slot_stride;
+    ucc_snprintf_safe(self->seg_name, sizeof(self->seg_name),
+                      "/ucc_shm_%d_%u_%u_%d_%d", (int)h0->ctx_id.pi.pid,
+                      h0->ctx_id.seq_num, (unsigned)params->id, params->scope,
+                      params->scope_id);
+    if (self->rank == 0) {
+        return ucc_tl_shm_seg_create(self);
+    }
+    return UCC_OK;
+}
+
+UCC_CLASS_CLEANUP_FUNC(ucc_tl_shm_team_t)
+{
+    tl_info(self->super.super.context->lib, "finalizing tl team: %p", self);
+    if (self->seg_fd >= 0) {
+        close(self->seg_fd);
+    }
+    if (self->seg) {
+        munmap(self->seg, self->seg_size);
+    }
+    if (self->rank == 0 && self->seg_name[0] != '\0') {
+        /* team is destroyed before all the ranks attached */
+        shm_unlink(self->seg_name);
+    }
+}
+
+UCC_CLASS_DEFINE_DELETE_FUNC(ucc_tl_shm_team_t, ucc_base_team_t);
+UCC_CLASS_DEFINE(ucc_tl_shm_team_t, ucc_tl_team_t);
+
+ucc_status_t ucc_tl_shm_team_destroy(ucc_base_team_t *tl_team)
+{
+    UCC_CLASS_DELETE_FUNC_NAME(ucc_tl_shm_team_t)(tl_team);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_team_create_test(ucc_base_team_t *tl_team)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_status_t       status;
+
+    if (!team->attached) {
+        status = ucc_tl_shm_seg_attach(team);
+        if (UCC_OK != status) {
+            return status;
+        }
+    }
+    if (team->rank == 0 && team->seg_name[0] != '\0') {
+        if (UCC_TL_SHM_SEG_HEADER(team)->n_attached < team->size - 1) {
+            return UCC_INPROGRESS;
+        }
+        /* everybody has the segment mapped: remove the name so that the
+           segment is released once the last rank unmaps it */
+        shm_unlink(team->seg_name);
+        team->seg_name[0] = '\0';
+    }
+    tl_info(tl_team->context->lib, "initialized tl team: %p", team);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_shm_team_get_scores(ucc_base_team_t   *tl_team,
+                                        ucc_coll_score_t **score_p)
+{
+    ucc_tl_shm_team_t *team = ucc_derived_of(tl_team, ucc_tl_shm_team_t);
+    ucc_tl_shm_lib_t  *lib  = UCC_TL_SHM_TEAM_LIB(team);
+    ucc_memory_type_t  mt   = UCC_MEMORY_TYPE_HOST;
+    ucc_coll_score_t  *score;
+    ucc_status_t       status;
+
+    /* Synchronization only collectives do not depend on the message size,
+       bcast and allreduce are limited by the size of the data slot */
+    status = ucc_coll_score_build_default(
+        tl_team, UCC_TL_SHM_DEFAULT_SCORE, ucc_tl_shm_coll_init,
+        UCC_COLL_TYPE_BARRIER | UCC_COLL_TYPE_FANIN | UCC_COLL_TYPE_FANOUT,
+        &mt, 1, &score);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_BCAST, mt, 0,
+                                      team->slot_size + 1,
+                                      UCC_TL_SHM_DEFAULT_SCORE,
+                                      ucc_tl_shm_coll_init, tl_team);
+    if (ucc_unlikely(UCC_OK != status)) {
+        goto err;
+    }
+    status = ucc_coll_score_add_range(score, UCC_COLL_TYPE_ALLREDUCE, mt, 0,
+                                      team->slot_size + 1,
+                                      UCC_TL_SHM_DEFAULT_SCORE,
+                                      ucc_tl_shm_coll_init, tl_team);
+    if (ucc_unlikely(UCC_OK != status)) {
+        goto err;
+    }
+    if (strlen(lib->super.super.score_str) > 0) {
+        status = ucc_coll_score_update_from_str(
+            lib->super.super.score_str, score, team->size,
+            ucc_tl_shm_coll_init, &team->super.super,
+            UCC_TL_SHM_DEFAULT_SCORE, NULL);
+        /* If INVALID_PARAM - User provided incorrect input - try to proceed */
+        if ((status < 0) && (status != UCC_ERR_INVALID_PARAM) &&
+            (status != UCC_ERR_NOT_SUPPORTED)) {
+            goto err;
+        }
+    }
+    *score_p = score;
+    return UCC_OK;
+err:
+    ucc_coll_score_free(score);
+    return status;
+}
@@ -7,18 +7,53 @@
 #include "tl_ucp.h"
 #include "allgather.h"
 
+ucc_base_coll_alg_info_t
+    ucc_tl_ucp_allgather_algs[UCC_TL_UCP_ALLGATHER_ALG_LAST + 1] = {
+        [UCC_TL_UCP_ALLGATHER_ALG_RING] =
+            {.id   = UCC_TL_UCP_ALLGATHER_ALG_RING,
+             .name = "ring",
+             .desc = "ring allgather (bw oriented alg)"},
+        [UCC_TL_UCP_ALLGATHER_ALG_BRUCK] =
+            {.id   = UCC_TL_UCP_ALLGATHER_ALG_BRUCK,
+             .name = "bruck",
+             .desc = "bruck allgather with log2 number of steps for any team "
+                     "size (latency oriented alg)"},
+        [UCC_TL_UCP_ALLGATHER_ALG_RECURSIVE_DOUBLING] =
+            {.id   = UCC_TL_UCP_ALLGATHER_ALG_RECURSIVE_DOUBLING,
+             .name = "recursive_doubling",
+             .desc = "recursive doubling allgather for power of 2 team size, "
+                     "bruck otherwise (latency oriented alg)"},
+        [UCC_TL_UCP_ALLGATHER_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
 ucc_status_t ucc_tl_ucp_allgather_ring_start(ucc_coll_task_t *task);
 ucc_status_t ucc_tl_ucp_allgather_ring_progress(ucc_coll_task_t *task);
 
 ucc_status_t ucc_tl_ucp_allgather_init(ucc_tl_ucp_task_t *task)
 {
-    if ((task->args.src.info.datatype == UCC_DT_USERDEFINED) ||
-        (task->args.dst.info.datatype == UCC_DT_USERDEFINED)) {
-        tl_error(UCC_TL_TEAM_LIB(task->team),
-                 "user defined datatype is not supported");
-        return UCC_ERR_NOT_SUPPORTED;
+    ucc_status_t status;
+
+    ALLGATHER_TASK_CHECK(task->args, task->team);
+    task->super.post           = ucc_tl_ucp_allgather_ring_start;
+    task->super.progress       = ucc_tl_ucp_allgather_ring_progress;
+    task->allgather_ring.count = task->args.dst.info.count * task->team->size;
+    status                     = UCC_OK;
+out:
+    return status;
+}
+
+ucc_status_t ucc_tl_ucp_allgather_ring_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t *     team,
+                                            ucc_coll_task_t **    task_h)
+{
+    ucc_tl_ucp_task_t *task = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_status_t       status;
+
+    status = ucc_tl_ucp_allgather_init(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        return status;
     }
-    task->super.post     = ucc_tl_ucp_allgather_ring_start;
-    task->super.progress = ucc_tl_ucp_allgather_ring_progress;
+    *task_h = &task->super;
     return UCC_OK;
 }
@@ -8,8 +8,57 @@
 #include "../tl_ucp.h"
 #include "../tl_ucp_coll.h"
 
+enum {
+    UCC_TL_UCP_ALLGATHER_ALG_RING,
+    UCC_TL_UCP_ALLGATHER_ALG_BRUCK,
+    UCC_TL_UCP_ALLGATHER_ALG_RECURSIVE_DOUBLING,
+    UCC_TL_UCP_ALLGATHER_ALG_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+             ucc_tl_ucp_allgather_algs[UCC_TL_UCP_ALLGATHER_ALG_LAST + 1];
+
+#define UCC_TL_UCP_ALLGATHER_DEFAULT_ALG_SELECT_STR                            \
+    "allgather:0-4k:@recursive_doubling#allgather:4k-inf:@ring"
+
+#define ALLGATHER_TASK_CHECK(_args, _team)                                     \
+    do {                                                                       \
+        if (((_args).src.info.datatype == UCC_DT_USERDEFINED) ||               \
+            ((_args).dst.info.datatype == UCC_DT_USERDEFINED)) {               \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "user defined datatype is not supported");                \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
+static inline int ucc_tl_ucp_allgather_alg_from_str(const char *str)
+{
+    int i;
+    for (i = 0; i < UCC_TL_UCP_ALLGATHER_ALG_LAST; i++) {
+        if (0 == strcasecmp(str, ucc_tl_ucp_allgather_algs[i].name)) {
+            break;
+        }
+    }
+    return i;
+}
+
 ucc_status_t ucc_tl_ucp_allgather_init(ucc_tl_ucp_task_t *task);
 
+ucc_status_t ucc_tl_ucp_allgather_ring_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t *     team,
+                                            ucc_coll_task_t **    task_h);
+
+ucc_status_t ucc_tl_ucp_allgather_bruck_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t *     team,
+                                             ucc_coll_task_t **    task_h);
+
+/* Falls back to bruck if team size is not power of 2 */
+ucc_status_t
+ucc_tl_ucp_allgather_recursive_doubling_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t *     team,
+                                             ucc_coll_task_t **    task_h);
+
 /* Uses allgather_kn_radix from config */
 ucc_status_t ucc_tl_ucp_allgather_knomial_init(ucc_base_coll_args_t *coll_args,
                                                ucc_base_team_t *     team,
@@ -19,4 +68,11 @@ ucc_status_t ucc_tl_ucp_allgather_knomial_init(ucc_base_coll_args_t *coll_args,
 ucc_status_t ucc_tl_ucp_allgather_knomial_init_r(
     ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
     ucc_coll_task_t **task_h, ucc_kn_radix_t radix);
+
+/* Internal interface to ring allgather: dst.info.count is the total count
+   of the dst buffer which is split into team size blocks (possibly uneven,
+   see ucc_buffer_block_count). Used as the 2nd phase of ring allreduce. */
+ucc_status_t ucc_tl_ucp_allgather_ring_init_blocks(
+    ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
+    ucc_coll_task_t **task_h);
 #endif
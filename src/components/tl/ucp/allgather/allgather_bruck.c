@@ -0,0 +1,152 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "allgather.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "core/ucc_mc.h"
+
+/* Bruck allgather
+   1. Works for any team size in ceil(log2(size)) steps.
+   2. Scratch block j holds the data of rank (rank + j) % size. At the step
+      with distance "dist" the rank sends its first min(dist, size - dist)
+      blocks to rank - dist and receives the same number of blocks from
+      rank + dist into the scratch at block "dist".
+   3. After the last step the scratch is rotated by "rank" blocks into dst.
+   4. Targets small messages (latency oriented): the total amount of sent
+      data is the same as for ring but with log number of steps, at the cost
+      of a scratch of the size of dst and the final local copy. */
+ucc_status_t ucc_tl_ucp_allgather_bruck_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    ucc_rank_t         rank      = team->rank;
+    ucc_rank_t         size      = team->size;
+    void              *rbuf      = task->args.dst.info.buffer;
+    ucc_memory_type_t  rmem      = task->args.dst.info.mem_type;
+    size_t             data_size = task->args.dst.info.count *
+                       ucc_dt_size(task->args.dst.info.datatype);
+    void              *scratch   = task->allgather_bruck.scratch;
+    ucc_rank_t         dist      = task->allgather_bruck.dist;
+    ucc_rank_t         n_blocks;
+    ucc_status_t       status;
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    while (dist < size) {
+        n_blocks = ucc_min(dist, size - dist);
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(scratch, n_blocks * data_size, rmem,
+                                         (rank - dist + size) % size, team,
+                                         task),
+                      task, out);
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(PTR_OFFSET(scratch, dist * data_size),
+                                         n_blocks * data_size, rmem,
+                                         (rank + dist) % size, team, task),
+                      task, out);
+        dist *= 2;
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            task->allgather_bruck.dist = dist;
+            return task->super.super.status;
+        }
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+
+    /* local rotation: scratch block j goes to dst block (rank + j) % size */
+    status = ucc_mc_memcpy(PTR_OFFSET(rbuf, rank * data_size), scratch,
+                           (size - rank) * data_size, rmem, rmem);
+    if (ucc_unlikely(UCC_OK != status)) {
+        task->super.super.status = status;
+        goto out;
+    }
+    if (rank > 0) {
+        status = ucc_mc_memcpy(rbuf,
+                               PTR_OFFSET(scratch, (size - rank) * data_size),
+                               rank * data_size, rmem, rmem);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            goto out;
+        }
+    }
+    task->super.super.status = UCC_OK;
+out:
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allgather_bruck_done", 0);
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_allgather_bruck_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    size_t             data_size = task->args.dst.info.count *
+                       ucc_dt_size(task->args.dst.info.datatype);
+    void              *sbuf      = task->args.src.info.buffer;
+    ucc_memory_type_t  smem      = task->args.src.info.mem_type;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allgather_bruck_start", 0);
+    ucc_tl_ucp_task_reset(task);
+    task->allgather_bruck.dist = 1;
+    if (UCC_IS_INPLACE(task->args)) {
+        sbuf = PTR_OFFSET(task->args.dst.info.buffer, team->rank * data_size);
+        smem = task->args.dst.info.mem_type;
+    }
+    status = ucc_mc_memcpy(task->allgather_bruck.scratch, sbuf, data_size,
+                           task->args.dst.info.mem_type, smem);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+
+    status = ucc_tl_ucp_allgather_bruck_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_allgather_bruck_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    ucc_mc_free(task->allgather_bruck.scratch_mc_header);
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_allgather_bruck_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t      *team,
+                                             ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    size_t             count   = coll_args->args.dst.info.count;
+    size_t             dt_size = ucc_dt_size(coll_args->args.dst.info.datatype);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    ALLGATHER_TASK_CHECK(coll_args->args, tl_team);
+    task                 = ucc_tl_ucp_init_task(coll_args, team);
+    task->super.post     = ucc_tl_ucp_allgather_bruck_start;
+    task->super.progress = ucc_tl_ucp_allgather_bruck_progress;
+    task->super.finalize = ucc_tl_ucp_allgather_bruck_finalize;
+
+    status = ucc_mc_alloc(&task->allgather_bruck.scratch_mc_header,
+                          count * dt_size * tl_team->size,
+                          coll_args->args.dst.info.mem_type);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team), "failed to allocate scratch buffer");
+        ucc_tl_ucp_put_task(task);
+        goto out;
+    }
+    task->allgather_bruck.scratch =
+        task->allgather_bruck.scratch_mc_header->addr;
+    *task_h = &task->super;
+out:
+    return status;
+}
@@ -64,7 +64,7 @@ UCC_KN_PHASE_EXTRA:
         local_seg_offset = ucc_sra_kn_compute_seg_offset(
             block_count, step_radix, local_seg_index);
 
-        sbuf = task->args.src.info.buffer;
+        sbuf = task->allgather_kn.sbuf;
         rbuf = PTR_OFFSET(sbuf, -local_seg_offset * dt_size);
         for (loop_step = 1; loop_step < radix; loop_step++) {
             peer = ucc_knomial_pattern_get_loop_peer(p, rank, size, loop_step);
@@ -75,7 +75,7 @@ UCC_KN_PHASE_EXTRA:
                                              mem_type, peer, team, task),
                           task, out);
         }
-        task->args.src.info.buffer = rbuf;
+        task->allgather_kn.sbuf = rbuf;
 
         for (loop_step = 1; loop_step < radix; loop_step++) {
             peer = ucc_knomial_pattern_get_loop_peer(p, rank, size, loop_step);
@@ -131,7 +131,10 @@ ucc_status_t ucc_tl_ucp_allgather_knomial_start(ucc_coll_task_t *coll_task)
     ptrdiff_t          offset;
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allgather_kn_start", 0);
+    ucc_tl_ucp_task_reset(task);
     task->allgather_kn.phase = UCC_KN_PHASE_INIT;
+    ucc_knomial_pattern_init_backward(size, rank, task->allgather_kn.p.radix,
+                                      &task->allgather_kn.p);
     ucc_assert(task->args.src.info.mem_type == task->args.dst.info.mem_type);
 
     offset = ucc_sra_kn_get_offset(task->args.src.info.count,
@@ -148,8 +151,7 @@ ucc_status_t ucc_tl_ucp_allgather_knomial_start(ucc_coll_task_t *coll_task)
             return status;
         }
     }
-    task->args.src.info.buffer = PTR_OFFSET(task->args.dst.info.buffer, offset);
-    task->super.super.status   = UCC_INPROGRESS;
+    task->allgather_kn.sbuf = PTR_OFFSET(task->args.dst.info.buffer, offset);
 
     status = ucc_tl_ucp_allgather_knomial_progress(&task->super);
     if (UCC_INPROGRESS == status) {
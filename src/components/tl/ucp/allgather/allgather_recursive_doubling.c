@@ -0,0 +1,118 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "allgather.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "core/ucc_mc.h"
+
+/* Recursive doubling allgather
+   1. Requires power of 2 team size, log2(size) steps. For other team sizes
+      the init falls back to Bruck allgather.
+   2. At the step with distance "dist" the rank holds "dist" contiguous
+      blocks of dst starting at block (rank & ~(dist - 1)) and exchanges them
+      with rank ^ dist. All the data is received directly into its final
+      location in dst, no scratch or local copies are needed. */
+ucc_status_t
+ucc_tl_ucp_allgather_recursive_doubling_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    ucc_rank_t         rank      = team->rank;
+    ucc_rank_t         size      = team->size;
+    void              *rbuf      = task->args.dst.info.buffer;
+    ucc_memory_type_t  rmem      = task->args.dst.info.mem_type;
+    size_t             data_size = task->args.dst.info.count *
+                       ucc_dt_size(task->args.dst.info.datatype);
+    ucc_rank_t         dist      = task->allgather_rd.dist;
+    ucc_rank_t         peer;
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    while (dist < size) {
+        peer = rank ^ dist;
+        UCPCHECK_GOTO(
+            ucc_tl_ucp_send_nb(PTR_OFFSET(rbuf, (rank & ~(dist - 1)) *
+                                                    data_size),
+                               dist * data_size, rmem, peer, team, task),
+            task, out);
+        UCPCHECK_GOTO(
+            ucc_tl_ucp_recv_nb(PTR_OFFSET(rbuf, (peer & ~(dist - 1)) *
+                                                    data_size),
+                               dist * data_size, rmem, peer, team, task),
+            task, out);
+        dist *= 2;
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            task->allgather_rd.dist = dist;
+            return task->super.super.status;
+        }
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+out:
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allgather_rd_done", 0);
+    return task->super.super.status;
+}
+
+ucc_status_t
+ucc_tl_ucp_allgather_recursive_doubling_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    size_t             data_size = task->args.dst.info.count *
+                       ucc_dt_size(task->args.dst.info.datatype);
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allgather_rd_start", 0);
+    ucc_tl_ucp_task_reset(task);
+    task->allgather_rd.dist = 1;
+    if (!UCC_IS_INPLACE(task->args)) {
+        status = ucc_mc_memcpy(PTR_OFFSET(task->args.dst.info.buffer,
+                                          team->rank * data_size),
+                               task->args.src.info.buffer, data_size,
+                               task->args.dst.info.mem_type,
+                               task->args.src.info.mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+
+    status = ucc_tl_ucp_allgather_recursive_doubling_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t
+ucc_tl_ucp_allgather_recursive_doubling_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t      *team,
+                                             ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    ALLGATHER_TASK_CHECK(coll_args->args, tl_team);
+    if (!ucc_is_pow2(tl_team->size)) {
+        tl_debug(UCC_TL_TEAM_LIB(tl_team), "team size %u is not power of 2, "
+                 "using bruck allgather", tl_team->size);
+        return ucc_tl_ucp_allgather_bruck_init(coll_args, team, task_h);
+    }
+    task                 = ucc_tl_ucp_init_task(coll_args, team);
+    task->super.post     = ucc_tl_ucp_allgather_recursive_doubling_start;
+    task->super.progress = ucc_tl_ucp_allgather_recursive_doubling_progress;
+    *task_h              = &task->super;
+    status               = UCC_OK;
+out:
+    return status;
+}
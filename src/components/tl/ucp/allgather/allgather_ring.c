@@ -21,30 +21,38 @@ ucc_status_t ucc_tl_ucp_allgather_ring_progress(ucc_coll_task_t *coll_task)
     ucc_rank_t         group_size = team->size;
     void              *rbuf       = task->args.dst.info.buffer;
     ucc_memory_type_t  rmem       = task->args.dst.info.mem_type;
-    size_t             count      = task->args.dst.info.count;
+    size_t             count      = task->allgather_ring.count;
     ucc_datatype_t     dt         = task->args.dst.info.datatype;
-    size_t             data_size  = count * ucc_dt_size(dt);
+    size_t             dt_size    = ucc_dt_size(dt);
     ucc_rank_t         sendto     = (group_rank + 1) % group_size;
     ucc_rank_t         recvfrom   = (group_rank - 1 + group_size) % group_size;
     int                step;
+    ucc_rank_t         block;
     void              *buf;
+
     if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
         return task->super.super.status;
     }
 
     while (task->send_posted < group_size - 1) {
-        step = task->send_posted;
-        buf  = (void *)((ptrdiff_t)rbuf +
-                       ((group_rank - step + group_size) % group_size) *
-                           data_size);
+        step  = task->send_posted;
+        block = (group_rank - step + group_size) % group_size;
+        buf   = PTR_OFFSET(rbuf, ucc_buffer_block_offset(count, group_size,
+                                                         block) * dt_size);
         UCPCHECK_GOTO(
-            ucc_tl_ucp_send_nb(buf, data_size, rmem, sendto, team, task),
+            ucc_tl_ucp_send_nb(buf,
+                               ucc_buffer_block_count(count, group_size,
+                                                      block) * dt_size,
+                               rmem, sendto, team, task),
             task, out);
-        buf = (void *)((ptrdiff_t)rbuf +
-                       ((group_rank - step - 1 + group_size) % group_size) *
-                           data_size);
+        block = (group_rank - step - 1 + group_size) % group_size;
+        buf   = PTR_OFFSET(rbuf, ucc_buffer_block_offset(count, group_size,
+                                                         block) * dt_size);
         UCPCHECK_GOTO(
-            ucc_tl_ucp_recv_nb(buf, data_size, rmem, recvfrom, team, task),
+            ucc_tl_ucp_recv_nb(buf,
+                               ucc_buffer_block_count(count, group_size,
+                                                      block) * dt_size,
+                               rmem, recvfrom, team, task),
             task, out);
         if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
             return task->super.super.status;
@@ -61,20 +69,24 @@ ucc_status_t ucc_tl_ucp_allgather_ring_start(ucc_coll_task_t *coll_task)
 {
     ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
     ucc_tl_ucp_team_t *team      = task->team;
-    size_t             count     = task->args.dst.info.count;
+    size_t             count     = task->allgather_ring.count;
     void              *sbuf      = task->args.src.info.buffer;
     void              *rbuf      = task->args.dst.info.buffer;
     ucc_memory_type_t  smem      = task->args.src.info.mem_type;
     ucc_memory_type_t  rmem      = task->args.dst.info.mem_type;
     ucc_datatype_t     dt        = task->args.dst.info.datatype;
-    size_t             data_size = count * ucc_dt_size(dt);
+    size_t             dt_size   = ucc_dt_size(dt);
     ucc_status_t       status;
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allgather_ring_start", 0);
-    task->super.super.status     = UCC_INPROGRESS;
+    ucc_tl_ucp_task_reset(task);
     if (!UCC_IS_INPLACE(task->args)) {
-        status = ucc_mc_memcpy((void*)((ptrdiff_t)rbuf + data_size * team->rank),
-                               sbuf, data_size, rmem, smem);
+        status = ucc_mc_memcpy(
+            PTR_OFFSET(rbuf, ucc_buffer_block_offset(count, team->size,
+                                                     team->rank) * dt_size),
+            sbuf, ucc_buffer_block_count(count, team->size, team->rank) *
+                      dt_size,
+            rmem, smem);
         if (ucc_unlikely(UCC_OK != status)) {
             return status;
         }
@@ -87,3 +99,16 @@ ucc_status_t ucc_tl_ucp_allgather_ring_start(ucc_coll_task_t *coll_task)
     }
     return ucc_task_complete(coll_task);
 }
+
+ucc_status_t ucc_tl_ucp_allgather_ring_init_blocks(
+    ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
+    ucc_coll_task_t **task_h)
+{
+    ucc_tl_ucp_task_t *task = ucc_tl_ucp_init_task(coll_args, team);
+
+    task->super.post           = ucc_tl_ucp_allgather_ring_start;
+    task->super.progress       = ucc_tl_ucp_allgather_ring_progress;
+    task->allgather_ring.count = task->args.dst.info.count;
+    *task_h                    = &task->super;
+    return UCC_OK;
+}
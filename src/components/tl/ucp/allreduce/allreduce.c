@@ -20,6 +20,11 @@ ucc_base_coll_alg_info_t
              .name = "sra_knomial",
              .desc = "recursive k-nomial scatter-reduce followed by k-nomial "
                      "allgather (bw oriented alg)"},
+        [UCC_TL_UCP_ALLREDUCE_ALG_RING] =
+            {.id   = UCC_TL_UCP_ALLREDUCE_ALG_RING,
+             .name = "ring",
+             .desc = "ring reduce-scatter followed by ring allgather "
+                     "(bw oriented alg for any team size)"},
         [UCC_TL_UCP_ALLREDUCE_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
 
@@ -12,6 +12,7 @@
 enum {
     UCC_TL_UCP_ALLREDUCE_ALG_KNOMIAL,
     UCC_TL_UCP_ALLREDUCE_ALG_SRA_KNOMIAL,
+    UCC_TL_UCP_ALLREDUCE_ALG_RING,
     UCC_TL_UCP_ALLREDUCE_ALG_LAST
 };
 
@@ -43,9 +44,24 @@ ucc_status_t ucc_tl_ucp_allreduce_init(ucc_tl_ucp_task_t *task);
         }                                                                      \
     } while (0)
 
+/* MAXLOC and MINLOC only reduce the value-index pair datatypes */
+#define CHECK_REDUCTION_OP_DT(_args, _dt, _team)                               \
+    do {                                                                       \
+        if (!ucc_reduction_op_dt_valid((_args).reduce.predefined_op,           \
+                                       (_dt))) {                               \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "reduction op %s is not supported for datatype %s",       \
+                     ucc_reduction_op_str((_args).reduce.predefined_op),       \
+                     ucc_datatype_str(_dt));                                   \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
 #define ALLREDUCE_TASK_CHECK(_args, _team)                                     \
     CHECK_USERDEFINED_OP((_args), (_team));                                    \
-    CHECK_SAME_MEMTYPE((_args), (_team));
+    CHECK_SAME_MEMTYPE((_args), (_team));                                      \
+    CHECK_REDUCTION_OP_DT((_args), (_args).dst.info.datatype, (_team));
 
 ucc_status_t ucc_tl_ucp_allreduce_knomial_init(ucc_base_coll_args_t *coll_args,
                                                ucc_base_team_t *     team,
@@ -60,6 +76,10 @@ ucc_status_t ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_ar
                                                    ucc_coll_task_t **    task_h);
 ucc_status_t ucc_tl_ucp_allreduce_sra_knomial_start(ucc_coll_task_t *task);
 ucc_status_t ucc_tl_ucp_allreduce_sra_knomial_progress(ucc_coll_task_t *task);
+
+ucc_status_t ucc_tl_ucp_allreduce_ring_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t *     team,
+                                            ucc_coll_task_t **    task_h);
 static inline int ucc_tl_ucp_allreduce_alg_from_str(const char *str)
 {
     int i;
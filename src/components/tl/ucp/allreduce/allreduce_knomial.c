@@ -119,18 +119,39 @@ UCC_KN_PHASE_EXTRA:
             return task->super.super.status;
         }
 
-        if (task->send_posted > p->iteration * (radix - 1)) {
+        if (!task->allreduce_kn.reduce_req &&
+            (task->send_posted > p->iteration * (radix - 1))) {
             if ((p->iteration == 0) && (KN_NODE_PROXY != node_type) &&
                 !UCC_IS_INPLACE(task->args)) {
                 send_buf = sbuf;
             } else {
                 send_buf = rbuf;
             }
-            if (ucc_unlikely(UCC_OK !=
-                    (status = ucc_dt_reduce_multi(
-                         send_buf, scratch, rbuf,
-                         task->send_posted - p->iteration * (radix - 1), count,
-                         data_size, dt, mem_type, &task->args)))) {
+            status = ucc_dt_reduce_multi_nb(
+                send_buf, scratch, rbuf,
+                task->send_posted - p->iteration * (radix - 1), count,
+                data_size, dt, mem_type, &task->args,
+                &task->allreduce_kn.reduce_req);
+            if (ucc_unlikely(UCC_OK != status && UCC_INPROGRESS != status)) {
+                tl_error(UCC_TL_TEAM_LIB(task->team),
+                         "failed to perform dt reduction");
+                task->super.super.status = status;
+                return status;
+            }
+        }
+        /* reduction executed by the helper threads of mc */
+        if (task->allreduce_kn.reduce_req) {
+            status = ucc_mc_req_test(task->allreduce_kn.reduce_req);
+            if (UCC_INPROGRESS == status) {
+                /* no UCP operation completes to mark the task runnable
+                   in the event driven mode: test the request again on the
+                   next progress call */
+                ucc_coll_task_set_runnable(&task->super);
+                SAVE_STATE(UCC_KN_PHASE_LOOP);
+                return task->super.super.status;
+            }
+            task->allreduce_kn.reduce_req = NULL;
+            if (ucc_unlikely(UCC_OK != status)) {
                 tl_error(UCC_TL_TEAM_LIB(task->team),
                          "failed to perform dt reduction");
                 task->super.super.status = status;
@@ -171,14 +192,13 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_start(ucc_coll_task_t *coll_task)
     ucc_rank_t         rank      = task->subset.myrank;
     ucc_status_t       status;
 
-    task->allreduce_kn.phase = UCC_KN_PHASE_INIT;
+    task->allreduce_kn.phase      = UCC_KN_PHASE_INIT;
+    task->allreduce_kn.reduce_req = NULL;
     ucc_assert(task->args.src.info.mem_type ==
                task->args.dst.info.mem_type);
-    ucc_knomial_pattern_init(size, rank,
-                             ucc_min(UCC_TL_UCP_TEAM_LIB(team)->
-                                     cfg.allreduce_kn_radix, size),
+    ucc_knomial_pattern_init(size, rank, task->allreduce_kn.radix,
                              &task->allreduce_kn.p);
-    task->super.super.status = UCC_INPROGRESS;
+    ucc_tl_ucp_task_reset(task);
     status = ucc_tl_ucp_allreduce_knomial_progress(&task->super);
     if (UCC_INPROGRESS == status) {
         ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
@@ -193,13 +213,14 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_init_common(ucc_tl_ucp_task_t *task)
     ucc_datatype_t     dt        = task->args.src.info.datatype;
     size_t             data_size = count * ucc_dt_size(dt);
     ucc_rank_t         size      = (ucc_rank_t)task->subset.map.ep_num;
-    ucc_kn_radix_t     radix     = ucc_min(UCC_TL_UCP_TEAM_LIB(task->team)->
-                                     cfg.allreduce_kn_radix, size);
+    ucc_kn_radix_t     radix     = ucc_min(UCC_TL_UCP_TEAM_KN_RADIX(
+                                     task->team, allreduce_kn_radix), size);
     ucc_status_t       status;
 
     task->super.post     = ucc_tl_ucp_allreduce_knomial_start;
     task->super.progress = ucc_tl_ucp_allreduce_knomial_progress;
     task->super.finalize = ucc_tl_ucp_allreduce_knomial_finalize;
+    task->allreduce_kn.radix = radix;
     status =
         ucc_mc_alloc(&task->allreduce_kn.scratch_mc_header,
                      (radix - 1) * data_size, task->args.src.info.mem_type);
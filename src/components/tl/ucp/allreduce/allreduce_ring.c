@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "allreduce.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "../reduce_scatter/reduce_scatter.h"
+#include "../allgather/allgather.h"
+
+/* Ring allreduce
+   1. The algorithm performs allreduce as a ring reduce-scatter followed by
+      the ring allgather, both operating on the same block layout
+      (ucc_buffer_block_count/ucc_buffer_block_offset of the total count).
+   2. Each rank sends and receives 2 * (size - 1) / size of the data which
+      is bandwidth optimal, while the latency grows linearly with the team
+      size. The algorithm works for any team size and count.
+   3. Requires a scratch of the size of a single block for the reduce-scatter
+      phase, the allgather phase is done in place in dst. */
+ucc_status_t ucc_tl_ucp_allreduce_ring_start(ucc_coll_task_t *coll_task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(coll_task, ucc_schedule_t);
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_allreduce_ring_start", 0);
+    return ucc_schedule_start(schedule);
+}
+
+ucc_status_t ucc_tl_ucp_allreduce_ring_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(coll_task, ucc_schedule_t);
+    ucc_status_t    status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_allreduce_ring_done", 0);
+    status = ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
+
+ucc_status_t ucc_tl_ucp_allreduce_ring_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t   *tl_team  = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_schedule_t      *schedule = ucc_tl_ucp_get_schedule(tl_team);
+    ucc_base_coll_args_t args     = *coll_args;
+    ucc_coll_task_t     *task, *rs_task;
+    ucc_status_t         status;
+    ALLREDUCE_TASK_CHECK(coll_args->args, tl_team);
+
+    /* 1st step of allreduce: ring reduce_scatter */
+    status = ucc_tl_ucp_reduce_scatter_ring_init(&args, team, &task);
+    if (UCC_OK != status) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "failed to init reduce_scatter_ring task");
+        goto out;
+    }
+    ucc_schedule_add_task(schedule, task);
+    ucc_event_manager_subscribe(&schedule->super.em, UCC_EVENT_SCHEDULE_STARTED,
+                                task);
+    task->handlers[UCC_EVENT_SCHEDULE_STARTED] = ucc_task_start_handler;
+    rs_task                                    = task;
+
+    /* 2nd step of allreduce: in place ring allgather of the reduced blocks.
+       2nd task subscribes to completion event of reduce_scatter task. */
+    args.args.mask |= UCC_COLL_ARGS_FIELD_FLAGS;
+    args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+    status = ucc_tl_ucp_allgather_ring_init_blocks(&args, team, &task);
+    if (UCC_OK != status) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "failed to init allgather_ring task");
+        goto out;
+    }
+    ucc_schedule_add_task(schedule, task);
+    ucc_event_manager_subscribe(&rs_task->em, UCC_EVENT_COMPLETED, task);
+    task->handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
+
+    schedule->super.post     = ucc_tl_ucp_allreduce_ring_start;
+    schedule->super.progress = NULL;
+    schedule->super.finalize = ucc_tl_ucp_allreduce_ring_finalize;
+    *task_h                  = &schedule->super;
+    return UCC_OK;
+out:
+    ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
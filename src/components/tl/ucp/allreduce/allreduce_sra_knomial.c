@@ -37,6 +37,12 @@
    7. After the completion of reduce-scatter phase the local result (at non EXTRA
       ranks) will be located in dst buffer at offset the can be commputed by the
       routine from coll_patterns/sra_knomial.h: ucc_sra_kn_get_offset.
+   8. If the message is larger than ALLREDUCE_SRA_KN_FRAG_SIZE the buffer is
+      split into fragments and each fragment is processed by its own
+      reduce-scatter/allgather schedule. Up to ALLREDUCE_SRA_KN_PIPELINE_DEPTH
+      fragment schedules run concurrently: the completion of fragment i starts
+      fragment i + depth, so the reduction of one fragment overlaps with the
+      data exchange of the others.
  */
 ucc_status_t ucc_tl_ucp_allreduce_sra_knomial_start(ucc_coll_task_t *coll_task)
 {
@@ -50,16 +56,18 @@ ucc_status_t
 ucc_tl_ucp_allreduce_sra_knomial_finalize(ucc_coll_task_t *coll_task)
 {
     ucc_schedule_t *schedule = ucc_derived_of(coll_task, ucc_schedule_t);
+    ucc_status_t    status;
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_allreduce_sra_kn_done", 0);
+    status = ucc_schedule_finalize(&schedule->super);
     ucc_tl_ucp_put_schedule(schedule);
-    return UCC_OK;
+    return status;
 }
 
-ucc_status_t
-ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_args,
-                                      ucc_base_team_t      *team,
-                                      ucc_coll_task_t     **task_h)
+static ucc_status_t
+ucc_tl_ucp_allreduce_sra_knomial_frag_init(ucc_base_coll_args_t *coll_args,
+                                           ucc_base_team_t      *team,
+                                           ucc_coll_task_t     **task_h)
 {
     ucc_tl_ucp_team_t   *tl_team  = ucc_derived_of(team, ucc_tl_ucp_team_t);
     ucc_schedule_t      *schedule = ucc_tl_ucp_get_schedule(tl_team);
@@ -68,8 +76,8 @@ ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_coll_task_t     *task, *rs_task;
     ucc_status_t         status;
     ucc_kn_radix_t       radix;
-    ALLREDUCE_TASK_CHECK(coll_args->args, tl_team);
-    radix = ucc_min(UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.allreduce_sra_kn_radix,
+
+    radix = ucc_min(UCC_TL_UCP_TEAM_KN_RADIX(tl_team, allreduce_sra_kn_radix),
                     tl_team->size);
 
     if (((count + radix - 1) / radix * (radix - 1) > count) ||
@@ -84,7 +92,6 @@ ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_args,
                  "failed to init reduce_scatter_knomial task");
         goto out;
     }
-    task->flags = UCC_COLL_TASK_FLAG_INTERNAL;
     ucc_schedule_add_task(schedule, task);
     ucc_event_manager_subscribe(&schedule->super.em, UCC_EVENT_SCHEDULE_STARTED,
                                 task);
@@ -101,7 +108,6 @@ ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_args,
                  "failed to init allgather_knomial task");
         goto out;
     }
-    task->flags = UCC_COLL_TASK_FLAG_INTERNAL;
     ucc_schedule_add_task(schedule, task);
     ucc_event_manager_subscribe(&rs_task->em, UCC_EVENT_COMPLETED, task);
     task->handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
@@ -112,6 +118,96 @@ ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_args,
     *task_h                  = &schedule->super;
     return UCC_OK;
 out:
+    ucc_schedule_finalize(&schedule->super);
     ucc_tl_ucp_put_schedule(schedule);
     return status;
 }
+
+static ucc_status_t
+ucc_tl_ucp_allreduce_sra_knomial_pipelined_init(ucc_base_coll_args_t *coll_args,
+                                                ucc_base_team_t      *team,
+                                                ucc_coll_task_t     **task_h,
+                                                ucc_rank_t            n_frags)
+{
+    ucc_tl_ucp_team_t   *tl_team  = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_lib_t    *lib      = UCC_TL_UCP_TEAM_LIB(tl_team);
+    ucc_schedule_t      *schedule = ucc_tl_ucp_get_schedule(tl_team);
+    size_t               count    = coll_args->args.src.info.count;
+    size_t               dt_size  = ucc_dt_size(coll_args->args.src.info.datatype);
+    ucc_base_coll_args_t args     = *coll_args;
+    ucc_coll_task_t     *frags[MAX_LISTENERS];
+    ucc_coll_task_t     *task;
+    ucc_status_t         status;
+    ucc_rank_t           depth, i;
+    size_t               frag_offset;
+
+    depth = ucc_min(lib->cfg.allreduce_sra_kn_pipeline_depth, MAX_LISTENERS);
+    depth = ucc_max(ucc_min(depth, n_frags), 1);
+    for (i = 0; i < n_frags; i++) {
+        frag_offset = ucc_buffer_block_offset(count, n_frags, i) * dt_size;
+        args.args.src.info.count  = ucc_buffer_block_count(count, n_frags, i);
+        args.args.dst.info.count  = args.args.src.info.count;
+        args.args.src.info.buffer =
+            PTR_OFFSET(coll_args->args.src.info.buffer, frag_offset);
+        args.args.dst.info.buffer =
+            PTR_OFFSET(coll_args->args.dst.info.buffer, frag_offset);
+        status = ucc_tl_ucp_allreduce_sra_knomial_frag_init(&args, team, &task);
+        if (UCC_OK != status) {
+            tl_error(UCC_TL_TEAM_LIB(tl_team),
+                     "failed to init sra_knomial fragment %u", i);
+            goto out;
+        }
+        status = ucc_schedule_add_task(schedule, task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->finalize(task);
+            goto out;
+        }
+        if (i < depth) {
+            /* first "depth" fragments start together with the schedule */
+            ucc_event_manager_subscribe(&schedule->super.em,
+                                        UCC_EVENT_SCHEDULE_STARTED, task);
+            task->handlers[UCC_EVENT_SCHEDULE_STARTED] = ucc_task_start_handler;
+        } else {
+            /* fragment i starts when fragment i - depth completes */
+            ucc_event_manager_subscribe(&frags[i % depth]->em,
+                                        UCC_EVENT_COMPLETED, task);
+            task->handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
+        }
+        frags[i % depth] = task;
+    }
+
+    schedule->super.post     = ucc_tl_ucp_allreduce_sra_knomial_start;
+    schedule->super.progress = NULL;
+    schedule->super.finalize = ucc_tl_ucp_allreduce_sra_knomial_finalize;
+    *task_h                  = &schedule->super;
+    return UCC_OK;
+out:
+    ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
+
+ucc_status_t
+ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_args,
+                                      ucc_base_team_t      *team,
+                                      ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team   = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    size_t             frag_size =
+        UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.allreduce_sra_kn_frag_size;
+    size_t             count     = coll_args->args.src.info.count;
+    size_t             data_size;
+    ucc_status_t       status;
+    ALLREDUCE_TASK_CHECK(coll_args->args, tl_team);
+
+    data_size = count * ucc_dt_size(coll_args->args.src.info.datatype);
+    if (frag_size > 0 && data_size > frag_size && tl_team->size > 1) {
+        return ucc_tl_ucp_allreduce_sra_knomial_pipelined_init(
+            coll_args, team, task_h,
+            (ucc_rank_t)ucc_min((data_size + frag_size - 1) / frag_size,
+                                count));
+    }
+    return ucc_tl_ucp_allreduce_sra_knomial_frag_init(coll_args, team, task_h);
+out:
+    return status;
+}
@@ -7,25 +7,50 @@
 #include "config.h"
 #include "tl_ucp.h"
 #include "alltoall.h"
+#include "utils/ucc_coll_utils.h"
+
+ucc_base_coll_alg_info_t
+    ucc_tl_ucp_alltoall_algs[UCC_TL_UCP_ALLTOALL_ALG_LAST + 1] = {
+        [UCC_TL_UCP_ALLTOALL_ALG_PAIRWISE] =
+            {.id   = UCC_TL_UCP_ALLTOALL_ALG_PAIRWISE,
+             .name = "pairwise",
+             .desc = "pairwise exchange with configurable number of "
+                     "outstanding messages (bw oriented alg)"},
+        [UCC_TL_UCP_ALLTOALL_ALG_BRUCK] =
+            {.id   = UCC_TL_UCP_ALLTOALL_ALG_BRUCK,
+             .name = "bruck",
+             .desc = "bruck alltoall with log2 number of steps (latency "
+                     "oriented alg for small messages at scale)"},
+        [UCC_TL_UCP_ALLTOALL_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
 
 ucc_status_t ucc_tl_ucp_alltoall_pairwise_start(ucc_coll_task_t *task);
 ucc_status_t ucc_tl_ucp_alltoall_pairwise_progress(ucc_coll_task_t *task);
 
 ucc_status_t ucc_tl_ucp_alltoall_init(ucc_tl_ucp_task_t *task)
 {
-    if ((task->args.mask & UCC_COLL_ARGS_FIELD_FLAGS) &&
-        (task->args.flags & UCC_COLL_ARGS_FLAG_IN_PLACE)) {
-        tl_debug(UCC_TL_TEAM_LIB(task->team),
-                 "inplace alltoall is not supported");
-        return UCC_ERR_NOT_SUPPORTED;
-    }
-    if ((task->args.src.info.datatype == UCC_DT_USERDEFINED) ||
-        (task->args.dst.info.datatype == UCC_DT_USERDEFINED)) {
-        tl_debug(UCC_TL_TEAM_LIB(task->team),
-                 "user defined datatype is not supported");
-        return UCC_ERR_NOT_SUPPORTED;
-    }
+    ucc_status_t status;
+
+    ALLTOALL_TASK_CHECK(task->args, task->team);
     task->super.post     = ucc_tl_ucp_alltoall_pairwise_start;
     task->super.progress = ucc_tl_ucp_alltoall_pairwise_progress;
+    status               = UCC_OK;
+out:
+    return status;
+}
+
+ucc_status_t ucc_tl_ucp_alltoall_pairwise_init(ucc_base_coll_args_t *coll_args,
+                                               ucc_base_team_t *     team,
+                                               ucc_coll_task_t **    task_h)
+{
+    ucc_tl_ucp_task_t *task = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_status_t       status;
+
+    status = ucc_tl_ucp_alltoall_init(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
+    *task_h = &task->super;
     return UCC_OK;
 }
@@ -10,6 +10,56 @@
 #include "../tl_ucp.h"
 #include "../tl_ucp_coll.h"
 
+enum {
+    UCC_TL_UCP_ALLTOALL_ALG_PAIRWISE,
+    UCC_TL_UCP_ALLTOALL_ALG_BRUCK,
+    UCC_TL_UCP_ALLTOALL_ALG_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+             ucc_tl_ucp_alltoall_algs[UCC_TL_UCP_ALLTOALL_ALG_LAST + 1];
+
+/* Bruck reduces the number of messages from size - 1 to log2(size) at the
+   cost of extra data volume and local copies: use it for small per-peer
+   messages, with the threshold growing with the team size. */
+#define UCC_TL_UCP_ALLTOALL_DEFAULT_ALG_SELECT_STR                             \
+    "alltoall:0-64:[16-127]:@bruck#alltoall:0-256:[128-inf]:@bruck"
+
+#define ALLTOALL_TASK_CHECK(_args, _team)                                      \
+    do {                                                                       \
+        if (UCC_IS_INPLACE(_args)) {                                           \
+            tl_debug(UCC_TL_TEAM_LIB(_team),                                   \
+                     "inplace alltoall is not supported");                     \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+        if (((_args).src.info.datatype == UCC_DT_USERDEFINED) ||               \
+            ((_args).dst.info.datatype == UCC_DT_USERDEFINED)) {               \
+            tl_debug(UCC_TL_TEAM_LIB(_team),                                   \
+                     "user defined datatype is not supported");                \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
+static inline int ucc_tl_ucp_alltoall_alg_from_str(const char *str)
+{
+    int i;
+    for (i = 0; i < UCC_TL_UCP_ALLTOALL_ALG_LAST; i++) {
+        if (0 == strcasecmp(str, ucc_tl_ucp_alltoall_algs[i].name)) {
+            break;
+        }
+    }
+    return i;
+}
+
 ucc_status_t ucc_tl_ucp_alltoall_init(ucc_tl_ucp_task_t *task);
 
+ucc_status_t ucc_tl_ucp_alltoall_pairwise_init(ucc_base_coll_args_t *coll_args,
+                                               ucc_base_team_t *     team,
+                                               ucc_coll_task_t **    task_h);
+
+ucc_status_t ucc_tl_ucp_alltoall_bruck_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t *     team,
+                                            ucc_coll_task_t **    task_h);
 #endif
@@ -0,0 +1,227 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "alltoall.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "utils/ucc_math.h"
+#include "tl_ucp_sendrecv.h"
+
+/* Bruck alltoall
+   1. Targets small messages at large scale: each rank sends ceil(log2(size))
+      messages instead of size - 1, at the cost of sending each block up to
+      log2(size) times and local pack/unpack.
+   2. Scratch layout: [tmp: size blocks][send pack: size/2 blocks]
+      [recv pack: size/2 blocks].
+   3. The src is rotated into tmp so that tmp block i is destined to rank
+      (rank + i) % size. At the step with distance "dist" all tmp blocks with
+      bit "dist" set in their index are packed and sent to rank + dist, the
+      same number of blocks is received from rank - dist and unpacked into
+      the same positions of tmp.
+   4. After the last step tmp block i holds the data from rank
+      (rank - i) % size and it is copied into dst accordingly. */
+
+#define ALLTOALL_BRUCK_N_PACKED(_size) ((_size) / 2)
+
+static inline ucc_status_t
+ucc_tl_ucp_alltoall_bruck_pack(ucc_tl_ucp_task_t *task, ucc_rank_t dist,
+                               int unpack)
+{
+    ucc_rank_t        size      = task->team->size;
+    ucc_memory_type_t mem_type  = task->args.dst.info.mem_type;
+    size_t            data_size = task->args.dst.info.count *
+                       ucc_dt_size(task->args.dst.info.datatype);
+    void             *tmp       = task->alltoall_bruck.scratch;
+    void             *pack      = PTR_OFFSET(tmp, size * data_size);
+    ucc_rank_t        i, n;
+    ucc_status_t      status;
+
+    if (unpack) {
+        pack = PTR_OFFSET(pack, ALLTOALL_BRUCK_N_PACKED(size) * data_size);
+    }
+    for (i = dist, n = 0; i < size; i++) {
+        if (!(i & dist)) {
+            continue;
+        }
+        if (unpack) {
+            status = ucc_mc_memcpy(PTR_OFFSET(tmp, i * data_size),
+                                   PTR_OFFSET(pack, n * data_size), data_size,
+                                   mem_type, mem_type);
+        } else {
+            status = ucc_mc_memcpy(PTR_OFFSET(pack, n * data_size),
+                                   PTR_OFFSET(tmp, i * data_size), data_size,
+                                   mem_type, mem_type);
+        }
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+        n++;
+    }
+    task->alltoall_bruck.n_packed = n;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_alltoall_bruck_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    ucc_rank_t         rank      = team->rank;
+    ucc_rank_t         size      = team->size;
+    ucc_memory_type_t  mem_type  = task->args.dst.info.mem_type;
+    size_t             data_size = task->args.dst.info.count *
+                       ucc_dt_size(task->args.dst.info.datatype);
+    void              *tmp       = task->alltoall_bruck.scratch;
+    void              *spack     = PTR_OFFSET(tmp, size * data_size);
+    void              *rpack     = PTR_OFFSET(
+        spack, ALLTOALL_BRUCK_N_PACKED(size) * data_size);
+    ucc_rank_t         step, dist, i;
+    ucc_status_t       status;
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    while (1) {
+        /* one recv is posted per step and all of them are completed here */
+        step = task->recv_posted;
+        if (step > 0) {
+            status = ucc_tl_ucp_alltoall_bruck_pack(task, 1 << (step - 1), 1);
+            if (ucc_unlikely(UCC_OK != status)) {
+                task->super.super.status = status;
+                goto out;
+            }
+        }
+        dist = 1 << step;
+        if (dist >= size) {
+            break;
+        }
+        status = ucc_tl_ucp_alltoall_bruck_pack(task, dist, 0);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            goto out;
+        }
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(spack,
+                                         task->alltoall_bruck.n_packed *
+                                             data_size,
+                                         mem_type, (rank + dist) % size, team,
+                                         task),
+                      task, out);
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(rpack,
+                                         task->alltoall_bruck.n_packed *
+                                             data_size,
+                                         mem_type, (rank - dist + size) % size,
+                                         team, task),
+                      task, out);
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return task->super.super.status;
+        }
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+
+    /* inverse rotation: tmp block i came from rank (rank - i) % size */
+    for (i = 0; i < size; i++) {
+        status = ucc_mc_memcpy(PTR_OFFSET(task->args.dst.info.buffer,
+                                          ((rank - i + size) % size) *
+                                              data_size),
+                               PTR_OFFSET(tmp, i * data_size), data_size,
+                               mem_type, mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            goto out;
+        }
+    }
+    task->super.super.status = UCC_OK;
+out:
+    if (task->super.super.status != UCC_INPROGRESS) {
+        UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_alltoall_bruck_done",
+                                         0);
+    }
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_alltoall_bruck_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    ucc_rank_t         rank      = team->rank;
+    ucc_rank_t         size      = team->size;
+    size_t             data_size = task->args.src.info.count *
+                       ucc_dt_size(task->args.src.info.datatype);
+    void              *tmp       = task->alltoall_bruck.scratch;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_alltoall_bruck_start", 0);
+    ucc_tl_ucp_task_reset(task);
+
+    /* local rotation: tmp block i = src block (rank + i) % size */
+    status = ucc_mc_memcpy(tmp,
+                           PTR_OFFSET(task->args.src.info.buffer,
+                                      rank * data_size),
+                           (size - rank) * data_size,
+                           task->args.dst.info.mem_type,
+                           task->args.src.info.mem_type);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    if (rank > 0) {
+        status = ucc_mc_memcpy(PTR_OFFSET(tmp, (size - rank) * data_size),
+                               task->args.src.info.buffer, rank * data_size,
+                               task->args.dst.info.mem_type,
+                               task->args.src.info.mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+
+    ucc_tl_ucp_alltoall_bruck_progress(&task->super);
+    if (UCC_INPROGRESS == task->super.super.status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_alltoall_bruck_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    ucc_mc_free(task->alltoall_bruck.scratch_mc_header);
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_alltoall_bruck_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_rank_t         size    = tl_team->size;
+    size_t             data_size;
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    ALLTOALL_TASK_CHECK(coll_args->args, tl_team);
+    data_size = coll_args->args.dst.info.count *
+                ucc_dt_size(coll_args->args.dst.info.datatype);
+    task                 = ucc_tl_ucp_init_task(coll_args, team);
+    task->super.post     = ucc_tl_ucp_alltoall_bruck_start;
+    task->super.progress = ucc_tl_ucp_alltoall_bruck_progress;
+    task->super.finalize = ucc_tl_ucp_alltoall_bruck_finalize;
+
+    status = ucc_mc_alloc(&task->alltoall_bruck.scratch_mc_header,
+                          (size + 2 * ALLTOALL_BRUCK_N_PACKED(size)) *
+                              data_size,
+                          coll_args->args.dst.info.mem_type);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team), "failed to allocate scratch buffer");
+        ucc_tl_ucp_put_task(task);
+        goto out;
+    }
+    task->alltoall_bruck.scratch = task->alltoall_bruck.scratch_mc_header->addr;
+    *task_h                      = &task->super;
+out:
+    return status;
+}
@@ -42,9 +42,9 @@ ucc_status_t ucc_tl_ucp_alltoall_pairwise_progress(ucc_coll_task_t *coll_task)
     nreqs     = (posts > gsize || posts == 0) ? gsize : posts;
     data_size = (size_t)task->args.src.info.count *
                 ucc_dt_size(task->args.src.info.datatype);
-    while ((task->send_posted < gsize || task->recv_posted < gsize) &&
-           (polls++ < task->n_polls)) {
-        ucp_worker_progress(UCC_TL_UCP_TEAM_CTX(team)->ucp_worker);
+    /* the posting window is refilled before the worker is progressed: with
+       n_polls == 0 (event driven progress) the task only reposts */
+    while (task->send_posted < gsize || task->recv_posted < gsize) {
         while ((task->recv_posted < gsize) &&
                ((task->recv_posted - task->recv_completed) < nreqs)) {
             peer = get_recv_peer(grank, gsize, task->recv_posted);
@@ -61,6 +61,11 @@ ucc_status_t ucc_tl_ucp_alltoall_pairwise_progress(ucc_coll_task_t *coll_task)
                           task, out);
             polls = 0;
         }
+        if ((task->send_posted == gsize && task->recv_posted == gsize) ||
+            (polls++ >= task->n_polls)) {
+            break;
+        }
+        ucp_worker_progress(UCC_TL_UCP_TEAM_CTX(team)->ucp_worker);
     }
     if ((task->send_posted < gsize) || (task->recv_posted < gsize)) {
         return task->super.super.status;
@@ -82,8 +87,8 @@ ucc_status_t ucc_tl_ucp_alltoall_pairwise_start(ucc_coll_task_t *coll_task)
     size_t data_size;
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_alltoall_pairwise_start", 0);
-    task->super.super.status = UCC_INPROGRESS;
-    task->n_polls            = ucc_min(1, task->n_polls);
+    ucc_tl_ucp_task_reset(task);
+    task->n_polls = ucc_min(1, task->n_polls);
 
     if (UCC_TL_UCP_TEAM_CTX(team)->cfg.pre_reg_mem) {
         data_size = (size_t)task->args.src.info.count *
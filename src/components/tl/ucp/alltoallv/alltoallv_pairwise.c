@@ -43,9 +43,8 @@ ucc_status_t ucc_tl_ucp_alltoallv_pairwise_progress(ucc_coll_task_t *coll_task)
     nreqs    = (posts > gsize || posts == 0) ? gsize : posts;
     rdt_size = ucc_dt_size(task->args.src.info_v.datatype);
     sdt_size = ucc_dt_size(task->args.dst.info_v.datatype);
-    while ((task->send_posted < gsize || task->recv_posted < gsize) &&
-           (polls++ < task->n_polls)) {
-        ucp_worker_progress(UCC_TL_UCP_TEAM_CTX(team)->ucp_worker);
+    /* same as alltoall pairwise: post before progressing the worker */
+    while (task->send_posted < gsize || task->recv_posted < gsize) {
         while ((task->recv_posted < gsize) &&
                ((task->recv_posted - task->recv_completed) < nreqs)) {
             peer       = get_recv_peer(grank, gsize, task->recv_posted);
@@ -72,6 +71,11 @@ ucc_status_t ucc_tl_ucp_alltoallv_pairwise_progress(ucc_coll_task_t *coll_task)
                           task, out);
             polls = 0;
         }
+        if ((task->send_posted == gsize && task->recv_posted == gsize) ||
+            (polls++ >= task->n_polls)) {
+            break;
+        }
+        ucp_worker_progress(UCC_TL_UCP_TEAM_CTX(team)->ucp_worker);
     }
     if ((task->send_posted < gsize) || (task->recv_posted < gsize)) {
         return task->super.super.status;
@@ -93,8 +97,8 @@ ucc_status_t ucc_tl_ucp_alltoallv_pairwise_start(ucc_coll_task_t *coll_task)
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_alltoallv_pairwise_start",
                                      0);
-    task->super.super.status = UCC_INPROGRESS;
-    task->n_polls            = ucc_min(1, task->n_polls);
+    ucc_tl_ucp_task_reset(task);
+    task->n_polls = ucc_min(1, task->n_polls);
 
     if (UCC_TL_UCP_TEAM_CTX(team)->cfg.pre_reg_mem) {
         if (task->args.flags & UCC_COLL_ARGS_FLAG_CONTIG_SRC_BUFFER) {
@@ -113,7 +113,7 @@ ucc_status_t ucc_tl_ucp_barrier_knomial_start(ucc_coll_task_t *coll_task)
                              ucc_min(UCC_TL_UCP_TEAM_LIB(team)->
                                      cfg.barrier_kn_radix, team->size),
                              &task->barrier.p);
-    task->super.super.status = UCC_INPROGRESS;
+    ucc_tl_ucp_task_reset(task);
     status = ucc_tl_ucp_barrier_knomial_progress(&task->super);
     if (UCC_INPROGRESS == status) {
         ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
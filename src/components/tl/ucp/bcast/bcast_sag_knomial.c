@@ -0,0 +1,272 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "bcast.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "coll_patterns/sra_knomial.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "../allgather/allgather.h"
+
+/* SAG - scatter-allgather knomial bcast algorithm (van de Geijn)
+   1. The algorithm performs bcast as a sequence of K-nomial scatter rooted
+      at the bcast root followed by in-place K-nomial allgather with the same
+      radix K.
+   2. The scatter distributes the root buffer using the same segmentation as
+      SRA knomial reduce-scatter (coll_patterns/sra_knomial.h), so that after
+      the scatter every non EXTRA rank holds exactly the segment that
+      the knomial allgather expects to find at ucc_sra_kn_get_offset.
+   3. At the iteration with distance radix_pow every rank that already has
+      its block of data splits it between itself and its peers of that
+      iteration. The root sends (size - 1) / size of the buffer in total
+      compared to log_K(size) full buffers for knomial bcast, so the
+      algorithm targets large messages.
+   4. EXTRA ranks don't participate in the scatter and get the full buffer
+      from their PROXY at the end of allgather. If the root itself is EXTRA
+      it first sends the buffer to its PROXY which then acts as the root of
+      the scatter.
+ */
+
+#define SAVE_STATE(_phase)                                                     \
+    do {                                                                       \
+        task->bcast_sag_kn.phase = _phase;                                     \
+    } while (0)
+
+ucc_status_t
+ucc_tl_ucp_bcast_sag_knomial_scatter_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t     *task      = ucc_derived_of(coll_task,
+                                                      ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t     *team      = task->team;
+    ucc_knomial_pattern_t *p         = &task->bcast_sag_kn.p;
+    ucc_kn_radix_t         radix     = p->radix;
+    ucc_rank_t             size      = team->size;
+    ucc_rank_t             rank      = team->rank;
+    ucc_rank_t             root      = (ucc_rank_t)task->args.root;
+    ucc_rank_t             loop_root = task->bcast_sag_kn.loop_root;
+    void                  *buffer    = task->args.src.info.buffer;
+    ucc_memory_type_t      mem_type  = task->args.src.info.mem_type;
+    size_t                 count     = task->args.src.info.count;
+    size_t                 dt_size   = ucc_dt_size(task->args.src.info.datatype);
+    ucc_rank_t             peer, step_radix, seg_index, loop_rank, loop_vroot;
+    ucc_kn_radix_t         loop_step;
+    size_t                 block_count, block_offset;
+
+    switch (task->bcast_sag_kn.phase) {
+    case UCC_KN_PHASE_EXTRA:
+        goto UCC_KN_PHASE_EXTRA;
+    case UCC_KN_PHASE_LOOP:
+        goto UCC_KN_PHASE_LOOP;
+    default:
+        break;
+    }
+    if (root != loop_root) {
+        if (rank == root) {
+            UCPCHECK_GOTO(ucc_tl_ucp_send_nb(buffer, count * dt_size, mem_type,
+                                             loop_root, team, task),
+                          task, out);
+        } else if (rank == loop_root) {
+            UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(buffer, count * dt_size, mem_type,
+                                             root, team, task),
+                          task, out);
+        }
+    }
+UCC_KN_PHASE_EXTRA:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        SAVE_STATE(UCC_KN_PHASE_EXTRA);
+        return task->super.super.status;
+    }
+    if (KN_NODE_EXTRA == p->node_type) {
+        goto completion;
+    }
+    loop_rank  = ucc_knomial_pattern_loop_rank(p, rank);
+    loop_vroot = ucc_knomial_pattern_loop_rank(p, loop_root);
+    while (!ucc_knomial_pattern_loop_done(p)) {
+        if (loop_rank / (p->radix_pow * radix) !=
+            loop_vroot / (p->radix_pow * radix)) {
+            /* the data has not reached the subtree of this rank yet */
+            ucc_knomial_pattern_next_iteration(p);
+            continue;
+        }
+        step_radix   = ucc_sra_kn_compute_step_radix(rank, size, p);
+        block_count  = ucc_sra_kn_compute_block_count(count, rank, p);
+        block_offset = ucc_sra_kn_compute_block_offset(count, rank, p);
+        if (loop_rank / p->radix_pow == loop_vroot / p->radix_pow) {
+            /* rank has its block: split it between the peers */
+            for (loop_step = 1; loop_step < radix; loop_step++) {
+                peer = ucc_knomial_pattern_get_loop_peer(p, rank, size,
+                                                         loop_step);
+                if (peer == UCC_KN_PEER_NULL)
+                    continue;
+                seg_index = ucc_sra_kn_compute_seg_index(peer, p->radix_pow, p);
+                UCPCHECK_GOTO(
+                    ucc_tl_ucp_send_nb(
+                        PTR_OFFSET(buffer,
+                                   (block_offset +
+                                    ucc_sra_kn_compute_seg_offset(
+                                        block_count, step_radix, seg_index)) *
+                                       dt_size),
+                        ucc_sra_kn_compute_seg_size(block_count, step_radix,
+                                                    seg_index) *
+                            dt_size,
+                        mem_type, peer, team, task),
+                    task, out);
+            }
+        } else {
+            /* receive own segment from the peer that has the block */
+            for (loop_step = 1; loop_step < radix; loop_step++) {
+                peer = ucc_knomial_pattern_get_loop_peer(p, rank, size,
+                                                         loop_step);
+                if (peer != UCC_KN_PEER_NULL &&
+                    ucc_knomial_pattern_loop_rank(p, peer) / p->radix_pow ==
+                        loop_vroot / p->radix_pow) {
+                    break;
+                }
+            }
+            ucc_assert(loop_step < radix);
+            seg_index = ucc_sra_kn_compute_seg_index(rank, p->radix_pow, p);
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_recv_nb(
+                    PTR_OFFSET(buffer,
+                               (block_offset +
+                                ucc_sra_kn_compute_seg_offset(
+                                    block_count, step_radix, seg_index)) *
+                                   dt_size),
+                    ucc_sra_kn_compute_seg_size(block_count, step_radix,
+                                                seg_index) *
+                        dt_size,
+                    mem_type, peer, team, task),
+                task, out);
+        }
+    UCC_KN_PHASE_LOOP:
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            SAVE_STATE(UCC_KN_PHASE_LOOP);
+            return task->super.super.status;
+        }
+        ucc_knomial_pattern_next_iteration(p);
+    }
+completion:
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_bcast_sag_kn_scatter_done",
+                                     0);
+out:
+    return task->super.super.status;
+}
+
+ucc_status_t
+ucc_tl_ucp_bcast_sag_knomial_scatter_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = task->team;
+    ucc_rank_t         root = (ucc_rank_t)task->args.root;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task,
+                                     "ucp_bcast_sag_kn_scatter_start", 0);
+    ucc_knomial_pattern_init(team->size, team->rank, task->bcast_sag_kn.radix,
+                             &task->bcast_sag_kn.p);
+    task->bcast_sag_kn.phase     = UCC_KN_PHASE_INIT;
+    task->bcast_sag_kn.loop_root = root;
+    if (root < task->bcast_sag_kn.p.n_extra * 2 && (root % 2)) {
+        /* root is EXTRA: its PROXY serves as root of the scatter */
+        task->bcast_sag_kn.loop_root =
+            ucc_knomial_pattern_get_proxy(&task->bcast_sag_kn.p, root);
+    }
+    ucc_tl_ucp_task_reset(task);
+    status = ucc_tl_ucp_bcast_sag_knomial_scatter_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_bcast_sag_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(coll_task, ucc_schedule_t);
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_bcast_sag_kn_start", 0);
+    return ucc_schedule_start(schedule);
+}
+
+ucc_status_t ucc_tl_ucp_bcast_sag_knomial_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(coll_task, ucc_schedule_t);
+    ucc_status_t    status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_bcast_sag_kn_done", 0);
+    status = ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
+
+ucc_status_t ucc_tl_ucp_bcast_sag_knomial_init(ucc_base_coll_args_t *coll_args,
+                                               ucc_base_team_t      *team,
+                                               ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t   *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    size_t               count   = coll_args->args.src.info.count;
+    ucc_base_coll_args_t args    = *coll_args;
+    ucc_schedule_t      *schedule;
+    ucc_tl_ucp_task_t   *scatter_task;
+    ucc_coll_task_t     *task;
+    ucc_status_t         status;
+    ucc_kn_radix_t       radix;
+
+    if (count < tl_team->size) {
+        /* nothing to scatter: every rank would get at most one element */
+        return ucc_tl_ucp_bcast_knomial_init(coll_args, team, task_h);
+    }
+    radix = ucc_min(UCC_TL_UCP_TEAM_KN_RADIX(tl_team, bcast_sag_kn_radix),
+                    tl_team->size);
+    if (((count + radix - 1) / radix * (radix - 1) > count) ||
+        ((radix - 1) > count)) {
+        radix = 2;
+    }
+    schedule = ucc_tl_ucp_get_schedule(tl_team);
+
+    /* 1st step of bcast: knomial scatter from root */
+    scatter_task = ucc_tl_ucp_init_task(coll_args, team);
+    scatter_task->super.post     = ucc_tl_ucp_bcast_sag_knomial_scatter_start;
+    scatter_task->super.progress =
+        ucc_tl_ucp_bcast_sag_knomial_scatter_progress;
+    scatter_task->bcast_sag_kn.radix = radix;
+    task                             = &scatter_task->super;
+    ucc_schedule_add_task(schedule, task);
+    ucc_event_manager_subscribe(&schedule->super.em, UCC_EVENT_SCHEDULE_STARTED,
+                                task);
+    task->handlers[UCC_EVENT_SCHEDULE_STARTED] = ucc_task_start_handler;
+
+    /* 2nd step of bcast: in-place knomial allgather over the bcast buffer.
+       It subscribes to completion event of scatter task. */
+    args.args.dst.info = args.args.src.info;
+    args.args.mask    |= UCC_COLL_ARGS_FIELD_FLAGS;
+    args.args.flags   |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+    status = ucc_tl_ucp_allgather_knomial_init_r(&args, team, &task, radix);
+    if (UCC_OK != status) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "failed to init allgather_knomial task");
+        goto out;
+    }
+    ucc_schedule_add_task(schedule, task);
+    ucc_event_manager_subscribe(&scatter_task->super.em, UCC_EVENT_COMPLETED,
+                                task);
+    task->handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
+
+    schedule->super.post     = ucc_tl_ucp_bcast_sag_knomial_start;
+    schedule->super.progress = NULL;
+    schedule->super.finalize = ucc_tl_ucp_bcast_sag_knomial_finalize;
+    *task_h                  = &schedule->super;
+    return UCC_OK;
+out:
+    ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
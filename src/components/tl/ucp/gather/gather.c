@@ -0,0 +1,37 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "gather.h"
+
+ucc_base_coll_alg_info_t
+    ucc_tl_ucp_gather_algs[UCC_TL_UCP_GATHER_ALG_LAST + 1] = {
+        [UCC_TL_UCP_GATHER_ALG_KNOMIAL] =
+            {.id   = UCC_TL_UCP_GATHER_ALG_KNOMIAL,
+             .name = "knomial",
+             .desc = "gather over knomial tree with arbitrary radix "
+                     "(latency oriented alg)"},
+        [UCC_TL_UCP_GATHER_ALG_LINEAR] =
+            {.id   = UCC_TL_UCP_GATHER_ALG_LINEAR,
+             .name = "linear",
+             .desc = "root receives from every rank directly with "
+                     "configurable number of outstanding messages (bw "
+                     "oriented alg)"},
+        [UCC_TL_UCP_GATHER_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+ucc_status_t ucc_tl_ucp_gather_knomial_init_common(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_gather_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_status_t status;
+
+    GATHER_TASK_CHECK(task->args, task->team);
+    status = ucc_tl_ucp_gather_knomial_init_common(task);
+out:
+    return status;
+}
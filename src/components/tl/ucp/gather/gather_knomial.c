@@ -0,0 +1,247 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "gather.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+
+/* Knomial tree gather
+   1. Ranks are renumbered relative to root (vrank 0 is the root). Vrank is
+      a parent at every level "dist" where (vrank / dist) % radix == 0: its
+      children at that level are vrank + i * dist, i = 1..radix - 1, and the
+      subtree of the child c covers vranks [c, min(c + dist, size)). At the
+      first level where the position is not 0 vrank sends its own subtree
+      to the parent.
+   2. Non leaf ranks collect the blocks of their subtree in scratch in vrank
+      order. Slots of different children never overlap, so the receives of
+      all levels are posted at once and the whole subtree goes to the parent
+      with a single send: root receives (radix - 1) * log_radix(size)
+      messages instead of size - 1.
+   3. Root 0 receives directly into dst, any other root gathers into scratch
+      and rotates it into the rank order of dst at the end.
+ */
+
+enum {
+    UCC_GATHER_KN_PHASE_INIT,
+    UCC_GATHER_KN_PHASE_RECV,
+    UCC_GATHER_KN_PHASE_SEND
+};
+
+/* Returns the level at which vrank sends its subtree to the parent, the
+   value is not less than size for the root */
+static inline ucc_rank_t ucc_tl_ucp_gather_kn_level(ucc_rank_t     vrank,
+                                                    ucc_rank_t     size,
+                                                    ucc_kn_radix_t radix)
+{
+    ucc_rank_t dist = 1;
+
+    while (dist < size && (vrank / dist) % radix == 0) {
+        dist *= radix;
+    }
+    return dist;
+}
+
+ucc_status_t ucc_tl_ucp_gather_knomial_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = task->team;
+    ucc_rank_t         size     = team->size;
+    ucc_rank_t         root     = (ucc_rank_t)task->args.root;
+    ucc_rank_t         vrank    = (team->rank - root + size) % size;
+    ucc_kn_radix_t     radix    = task->gather_kn.radix;
+    ucc_memory_type_t  mem_type = GATHER_BUF_INFO(task)->mem_type;
+    size_t             bsize    = ucc_tl_ucp_gather_block_size(task);
+    void              *scratch  = task->gather_kn.scratch;
+    void              *rbuf, *sbuf;
+    ucc_rank_t         vpeer, peer, dist;
+    ucc_kn_radix_t     i;
+    ucc_status_t       status;
+
+    rbuf = scratch ? scratch : task->args.dst.info.buffer;
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    switch (task->gather_kn.phase) {
+    case UCC_GATHER_KN_PHASE_RECV:
+        goto UCC_GATHER_KN_PHASE_RECV;
+    case UCC_GATHER_KN_PHASE_SEND:
+        goto completion;
+    default:
+        break;
+    }
+    for (dist = 1; dist < task->gather_kn.dist; dist *= radix) {
+        for (i = 1; i < radix; i++) {
+            vpeer = vrank + i * dist;
+            if (vpeer >= size) {
+                break;
+            }
+            peer = (vpeer + root) % size;
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_recv_nb(PTR_OFFSET(rbuf, (vpeer - vrank) * bsize),
+                                   ucc_min(dist, size - vpeer) * bsize,
+                                   mem_type, peer, team, task),
+                task, out);
+        }
+    }
+    task->gather_kn.phase = UCC_GATHER_KN_PHASE_RECV;
+UCC_GATHER_KN_PHASE_RECV:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    dist = task->gather_kn.dist;
+    if (vrank == 0) {
+        if (scratch) {
+            /* scratch holds blocks in vrank order, vrank v is rank
+               (v + root) % size */
+            status = ucc_mc_memcpy(
+                PTR_OFFSET(task->args.dst.info.buffer, root * bsize), scratch,
+                (size - root) * bsize, mem_type, mem_type);
+            if (ucc_likely(UCC_OK == status)) {
+                status = ucc_mc_memcpy(
+                    task->args.dst.info.buffer,
+                    PTR_OFFSET(scratch, (size - root) * bsize), root * bsize,
+                    mem_type, mem_type);
+            }
+            if (ucc_unlikely(UCC_OK != status)) {
+                task->super.super.status = status;
+                goto out;
+            }
+        }
+        goto completion;
+    }
+    sbuf = scratch ? scratch : task->args.src.info.buffer;
+    peer = (vrank - ((vrank / dist) % radix) * dist + root) % size;
+    UCPCHECK_GOTO(ucc_tl_ucp_send_nb(sbuf,
+                                     ucc_min(dist, size - vrank) * bsize,
+                                     mem_type, peer, team, task),
+                  task, out);
+    task->gather_kn.phase = UCC_GATHER_KN_PHASE_SEND;
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+completion:
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_gather_kn_done", 0);
+out:
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_gather_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    ucc_rank_t         root      = (ucc_rank_t)task->args.root;
+    int                is_root   = (team->rank == root);
+    ucc_memory_type_t  mem_type  = GATHER_BUF_INFO(task)->mem_type;
+    size_t             bsize     = ucc_tl_ucp_gather_block_size(task);
+    void              *own_block = task->args.src.info.buffer;
+    void              *dst       = task->gather_kn.scratch;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_gather_kn_start", 0);
+    /* own block goes to the first slot of the subtree buffer */
+    if (is_root) {
+        if (UCC_IS_INPLACE(task->args)) {
+            own_block = PTR_OFFSET(task->args.dst.info.buffer, root * bsize);
+        }
+        if (!dst) {
+            dst = task->args.dst.info.buffer;
+        }
+    }
+    if (dst && dst != own_block) {
+        status = ucc_mc_memcpy(dst, own_block, bsize, mem_type, mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    task->gather_kn.phase = UCC_GATHER_KN_PHASE_INIT;
+    ucc_tl_ucp_task_reset(task);
+    status = ucc_tl_ucp_gather_knomial_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_gather_knomial_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    if (task->gather_kn.scratch_mc_header) {
+        ucc_mc_free(task->gather_kn.scratch_mc_header);
+    }
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_gather_knomial_init_common(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team  = task->team;
+    ucc_rank_t         size  = team->size;
+    ucc_rank_t         root  = (ucc_rank_t)task->args.root;
+    ucc_rank_t         vrank = (team->rank - root + size) % size;
+    ucc_kn_radix_t     radix;
+    size_t             data_size;
+    ucc_status_t       status;
+
+    radix = ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.gather_kn_radix, size);
+    radix = ucc_max(radix, 2);
+
+    task->super.post                  = ucc_tl_ucp_gather_knomial_start;
+    task->super.progress              = ucc_tl_ucp_gather_knomial_progress;
+    task->super.finalize              = ucc_tl_ucp_gather_knomial_finalize;
+    task->gather_kn.radix             = radix;
+    task->gather_kn.dist              =
+        ucc_tl_ucp_gather_kn_level(vrank, size, radix);
+    task->gather_kn.scratch_mc_header = NULL;
+    task->gather_kn.scratch           = NULL;
+
+    if (vrank == 0) {
+        /* root 0 collects the blocks directly in dst */
+        data_size = (root == 0) ? 0 : size;
+    } else if (task->gather_kn.dist > 1 && vrank + 1 < size) {
+        data_size = ucc_min(task->gather_kn.dist, size - vrank);
+    } else {
+        /* leaf sends its src buffer */
+        data_size = 0;
+    }
+    if (data_size > 0) {
+        data_size *= ucc_tl_ucp_gather_block_size(task);
+        status = ucc_mc_alloc(&task->gather_kn.scratch_mc_header, data_size,
+                              GATHER_BUF_INFO(task)->mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TL_TEAM_LIB(team), "failed to allocate scratch buffer");
+            return status;
+        }
+        task->gather_kn.scratch = task->gather_kn.scratch_mc_header->addr;
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_gather_knomial_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    GATHER_TASK_CHECK(coll_args->args, tl_team);
+    task   = ucc_tl_ucp_init_task(coll_args, team);
+    status = ucc_tl_ucp_gather_knomial_init_common(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        goto out;
+    }
+    *task_h = &task->super;
+out:
+    return status;
+}
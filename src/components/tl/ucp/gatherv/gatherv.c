@@ -0,0 +1,36 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "gatherv.h"
+#include "utils/ucc_coll_utils.h"
+
+ucc_status_t ucc_tl_ucp_gatherv_linear_start(ucc_coll_task_t *task);
+ucc_status_t ucc_tl_ucp_gatherv_linear_progress(ucc_coll_task_t *task);
+
+ucc_status_t ucc_tl_ucp_gatherv_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_coll_args_t *args    = &task->args;
+    int              is_root = (args->root == task->team->rank);
+
+    if ((is_root && args->dst.info_v.datatype == UCC_DT_USERDEFINED) ||
+        (!(is_root && UCC_IS_INPLACE(*args)) &&
+         args->src.info.datatype == UCC_DT_USERDEFINED)) {
+        tl_error(UCC_TL_TEAM_LIB(task->team),
+                 "user defined datatype is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (is_root && !UCC_IS_INPLACE(*args) &&
+        args->src.info.mem_type != args->dst.info_v.mem_type) {
+        tl_error(UCC_TL_TEAM_LIB(task->team),
+                 "assymetric src/dst memory types are not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task->super.post     = ucc_tl_ucp_gatherv_linear_start;
+    task->super.progress = ucc_tl_ucp_gatherv_linear_progress;
+    return UCC_OK;
+}
@@ -0,0 +1,107 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "gatherv.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "tl_ucp_sendrecv.h"
+
+/* Counts are known to root only, so the knomial tree can't be used without
+   an extra exchange: every rank sends directly to root, root keeps at most
+   GATHERV_LINEAR_NUM_POSTS receives outstanding (0 - no limit). */
+
+ucc_status_t ucc_tl_ucp_gatherv_linear_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task   = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team   = task->team;
+    ucc_coll_args_t   *args   = &task->args;
+    ucc_rank_t         size   = team->size;
+    ucc_rank_t         root   = (ucc_rank_t)args->root;
+    ucc_rank_t         npeers = size - 1;
+    uint32_t           posts, nreqs;
+    size_t             dt_size, data_size, data_displ;
+    ucc_rank_t         peer;
+
+    if (team->rank != root) {
+        if (task->send_posted == 0) {
+            data_size = args->src.info.count *
+                        ucc_dt_size(args->src.info.datatype);
+            UCPCHECK_GOTO(ucc_tl_ucp_send_nb(args->src.info.buffer, data_size,
+                                             args->src.info.mem_type, root,
+                                             team, task),
+                          task, out);
+        }
+        goto test;
+    }
+    dt_size = ucc_dt_size(args->dst.info_v.datatype);
+    posts   = UCC_TL_UCP_TEAM_LIB(team)->cfg.gatherv_linear_num_posts;
+    nreqs   = (posts > npeers || posts == 0) ? npeers : posts;
+    while (task->recv_posted < npeers) {
+        while ((task->recv_posted < npeers) &&
+               ((task->recv_posted - task->recv_completed) < nreqs)) {
+            peer       = (root + 1 + task->recv_posted) % size;
+            data_size  = ucc_coll_args_get_count(args,
+                             args->dst.info_v.counts, peer) * dt_size;
+            data_displ = ucc_coll_args_get_displacement(args,
+                             args->dst.info_v.displacements, peer) * dt_size;
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_recv_nb(PTR_OFFSET(args->dst.info_v.buffer,
+                                              data_displ),
+                                   data_size, args->dst.info_v.mem_type,
+                                   peer, team, task),
+                task, out);
+        }
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task) &&
+            (task->recv_posted - task->recv_completed) == nreqs) {
+            return task->super.super.status;
+        }
+    }
+test:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_gatherv_linear_done", 0);
+out:
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_gatherv_linear_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = task->team;
+    ucc_coll_args_t   *args = &task->args;
+    size_t             dt_size, data_size, data_displ;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_gatherv_linear_start", 0);
+    if (team->rank == args->root && !UCC_IS_INPLACE(*args)) {
+        dt_size    = ucc_dt_size(args->dst.info_v.datatype);
+        data_size  = ucc_coll_args_get_count(args, args->dst.info_v.counts,
+                                             team->rank) * dt_size;
+        data_displ = ucc_coll_args_get_displacement(args,
+                         args->dst.info_v.displacements, team->rank) * dt_size;
+        status = ucc_mc_memcpy(PTR_OFFSET(args->dst.info_v.buffer, data_displ),
+                               args->src.info.buffer, data_size,
+                               args->dst.info_v.mem_type,
+                               args->src.info.mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    ucc_tl_ucp_task_reset(task);
+    status = ucc_tl_ucp_gatherv_linear_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
@@ -0,0 +1,35 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "reduce.h"
+
+ucc_base_coll_alg_info_t
+    ucc_tl_ucp_reduce_algs[UCC_TL_UCP_REDUCE_ALG_LAST + 1] = {
+        [UCC_TL_UCP_REDUCE_ALG_KNOMIAL] =
+            {.id   = UCC_TL_UCP_REDUCE_ALG_KNOMIAL,
+             .name = "knomial",
+             .desc = "reduce over knomial tree with arbitrary radix "
+                     "(latency oriented alg)"},
+        [UCC_TL_UCP_REDUCE_ALG_CHAIN] =
+            {.id   = UCC_TL_UCP_REDUCE_ALG_CHAIN,
+             .name = "chain",
+             .desc = "pipelined reduce over chain of ranks (bw oriented alg)"},
+        [UCC_TL_UCP_REDUCE_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+ucc_status_t ucc_tl_ucp_reduce_knomial_init_common(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_status_t status;
+
+    REDUCE_TASK_CHECK(task->args, task->team);
+    status = ucc_tl_ucp_reduce_knomial_init_common(task);
+out:
+    return status;
+}
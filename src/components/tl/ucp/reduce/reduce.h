@@ -0,0 +1,78 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef REDUCE_H_
+#define REDUCE_H_
+#include "../tl_ucp.h"
+#include "../tl_ucp_coll.h"
+
+enum {
+    UCC_TL_UCP_REDUCE_ALG_KNOMIAL,
+    UCC_TL_UCP_REDUCE_ALG_CHAIN,
+    UCC_TL_UCP_REDUCE_ALG_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+             ucc_tl_ucp_reduce_algs[UCC_TL_UCP_REDUCE_ALG_LAST + 1];
+
+#define UCC_TL_UCP_REDUCE_DEFAULT_ALG_SELECT_STR                               \
+    "reduce:0-512k:@knomial#reduce:512k-inf:@chain"
+
+#define REDUCE_TASK_CHECK(_args, _team)                                        \
+    do {                                                                       \
+        ucc_datatype_t _dt = ((_args).root == (_team)->rank)                   \
+                                 ? (_args).dst.info.datatype                   \
+                                 : (_args).src.info.datatype;                  \
+        if ((_args).mask & UCC_COLL_ARGS_FIELD_USERDEFINED_REDUCTIONS) {       \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "userdefined reductions are not supported yet");          \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+        if (((_args).root == (_team)->rank) && !UCC_IS_INPLACE(_args) &&       \
+            ((_args).src.info.mem_type != (_args).dst.info.mem_type)) {        \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "assymetric src/dst memory types are not supported yet"); \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+        if (!ucc_reduction_op_dt_valid((_args).reduce.predefined_op,           \
+                                       _dt)) {                                 \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "reduction op %s is not supported for datatype %s",       \
+                     ucc_reduction_op_str((_args).reduce.predefined_op),       \
+                     ucc_datatype_str(_dt));                                   \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
+/* Root uses dst buffer info, other ranks only provide src */
+#define REDUCE_BUF_INFO(_task)                                                 \
+    (((_task)->args.root == (_task)->team->rank) ? &(_task)->args.dst.info     \
+                                                  : &(_task)->args.src.info)
+
+static inline int ucc_tl_ucp_reduce_alg_from_str(const char *str)
+{
+    int i;
+    for (i = 0; i < UCC_TL_UCP_REDUCE_ALG_LAST; i++) {
+        if (0 == strcasecmp(str, ucc_tl_ucp_reduce_algs[i].name)) {
+            break;
+        }
+    }
+    return i;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_reduce_knomial_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t *     team,
+                                            ucc_coll_task_t **    task_h);
+
+ucc_status_t ucc_tl_ucp_reduce_chain_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t *     team,
+                                          ucc_coll_task_t **    task_h);
+#endif
@@ -0,0 +1,270 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "reduce.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+
+/* Pipelined chain reduce
+   1. Ranks form a chain ordered by vrank = (rank - root) % size: the last
+      rank sends its src to vrank - 1, every rank in the middle receives the
+      partial result from vrank + 1, reduces it with its own src and sends
+      it further to vrank - 1. Root reduces the data into dst.
+   2. The buffer is split into fragments of REDUCE_CHAIN_FRAG_SIZE bytes and
+      each fragment is reduced by a separate task, so different fragments
+      are in flight on different links of the chain at the same time. Up to
+      REDUCE_CHAIN_PIPELINE_DEPTH fragments are progressed concurrently by
+      every rank: the completion of fragment i starts fragment i + depth.
+   3. Scratch is allocated at init and kept until the schedule is
+      finalized, so a persistent collective does not allocate on every post.
+      Fragment i + depth runs after fragment i completes and reuses its
+      scratch: depth fragment buffers are allocated for any message size.
+ */
+
+ucc_status_t ucc_tl_ucp_reduce_chain_frag_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    ucc_rank_t         rank      = team->rank;
+    ucc_rank_t         size      = team->size;
+    ucc_rank_t         root      = (ucc_rank_t)task->args.root;
+    ucc_rank_t         vrank     = (rank - root + size) % size;
+    ucc_coll_buffer_info_t *info = REDUCE_BUF_INFO(task);
+    ucc_memory_type_t  mem_type  = info->mem_type;
+    size_t             count     = info->count;
+    ucc_datatype_t     dt        = info->datatype;
+    size_t             data_size = count * ucc_dt_size(dt);
+    void              *scratch   = task->reduce_chain.scratch;
+    void              *sbuf;
+    ucc_rank_t         peer;
+    ucc_status_t       status;
+
+    sbuf = (vrank == 0 && UCC_IS_INPLACE(task->args))
+               ? task->args.dst.info.buffer
+               : task->args.src.info.buffer;
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    if (vrank < size - 1 && task->recv_posted == 0) {
+        peer = (vrank + 1 + root) % size;
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(scratch, data_size, mem_type, peer,
+                                         team, task),
+                      task, out);
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return task->super.super.status;
+        }
+    }
+    if (task->send_posted == 0) {
+        if (vrank < size - 1) {
+            /* root puts the result to dst, others reduce in place */
+            status = ucc_dt_reduce(sbuf, scratch,
+                                   vrank == 0 ? task->args.dst.info.buffer
+                                              : scratch,
+                                   count, dt, mem_type, &task->args);
+            if (ucc_unlikely(UCC_OK != status)) {
+                tl_error(UCC_TL_TEAM_LIB(team),
+                         "failed to perform dt reduction");
+                task->super.super.status = status;
+                goto out;
+            }
+            sbuf = scratch;
+        }
+        if (vrank == 0) {
+            goto completion;
+        }
+        peer = (vrank - 1 + root) % size;
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(sbuf, data_size, mem_type, peer, team,
+                                         task),
+                      task, out);
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return task->super.super.status;
+        }
+    }
+completion:
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_chain_frag_done", 0);
+out:
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_chain_frag_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = task->team;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_chain_frag_start",
+                                     0);
+    ucc_tl_ucp_task_reset(task);
+    status = ucc_tl_ucp_reduce_chain_frag_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_reduce_chain_frag_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    if (task->reduce_chain.scratch_mc_header) {
+        ucc_mc_free(task->reduce_chain.scratch_mc_header);
+    }
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+/* prev - fragment that runs before this one in the same pipeline slot:
+   its scratch is reused, NULL if the fragment allocates its own */
+static ucc_status_t
+ucc_tl_ucp_reduce_chain_frag_init(ucc_base_coll_args_t *coll_args,
+                                  ucc_base_team_t      *team,
+                                  ucc_coll_task_t      *prev,
+                                  ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_task_t      *task  = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_rank_t              size  = task->team->size;
+    ucc_rank_t              vrank =
+        (task->team->rank - (ucc_rank_t)task->args.root + size) % size;
+    ucc_coll_buffer_info_t *info  = REDUCE_BUF_INFO(task);
+    ucc_status_t            status;
+
+    task->super.post                     = ucc_tl_ucp_reduce_chain_frag_start;
+    task->super.progress                 = ucc_tl_ucp_reduce_chain_frag_progress;
+    task->super.finalize                 = ucc_tl_ucp_reduce_chain_frag_finalize;
+    task->reduce_chain.scratch           = NULL;
+    task->reduce_chain.scratch_mc_header = NULL;
+    if (prev) {
+        /* fragments get smaller towards the end of the buffer */
+        task->reduce_chain.scratch =
+            ucc_derived_of(prev, ucc_tl_ucp_task_t)->reduce_chain.scratch;
+    } else if (vrank < size - 1) {
+        status = ucc_mc_alloc(&task->reduce_chain.scratch_mc_header,
+                              info->count * ucc_dt_size(info->datatype),
+                              info->mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TL_TEAM_LIB(task->team),
+                     "failed to allocate scratch buffer");
+            ucc_tl_ucp_put_task(task);
+            return status;
+        }
+        task->reduce_chain.scratch = task->reduce_chain.scratch_mc_header->addr;
+    }
+    *task_h = &task->super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_chain_start(ucc_coll_task_t *coll_task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(coll_task, ucc_schedule_t);
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_reduce_chain_start", 0);
+    return ucc_schedule_start(schedule);
+}
+
+ucc_status_t ucc_tl_ucp_reduce_chain_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(coll_task, ucc_schedule_t);
+    ucc_status_t    status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_reduce_chain_done", 0);
+    status = ucc_schedule_finalize(coll_task);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_chain_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *team,
+                                          ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t      *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_lib_t       *lib     = UCC_TL_UCP_TEAM_LIB(tl_team);
+    int                     is_root = (coll_args->args.root == tl_team->rank);
+    ucc_base_coll_args_t    args    = *coll_args;
+    ucc_coll_task_t        *frags[MAX_LISTENERS];
+    const ucc_coll_buffer_info_t *info;
+    ucc_schedule_t         *schedule;
+    ucc_coll_task_t        *task;
+    ucc_status_t            status;
+    size_t                  count, dt_size, frag_offset;
+    ucc_rank_t              n_frags, depth, i;
+
+    REDUCE_TASK_CHECK(coll_args->args, tl_team);
+    if (tl_team->size < 2) {
+        return ucc_tl_ucp_reduce_knomial_init(coll_args, team, task_h);
+    }
+    info    = is_root ? &coll_args->args.dst.info : &coll_args->args.src.info;
+    count   = info->count;
+    dt_size = ucc_dt_size(info->datatype);
+    n_frags = 1;
+    if (lib->cfg.reduce_chain_frag_size > 0 &&
+        count * dt_size > lib->cfg.reduce_chain_frag_size) {
+        n_frags = ucc_min((count * dt_size + lib->cfg.reduce_chain_frag_size -
+                           1) / lib->cfg.reduce_chain_frag_size,
+                          count);
+    }
+    if (n_frags == 1) {
+        return ucc_tl_ucp_reduce_chain_frag_init(coll_args, team, NULL,
+                                                 task_h);
+    }
+
+    schedule = ucc_tl_ucp_get_schedule(tl_team);
+    depth    = ucc_min(lib->cfg.reduce_chain_pipeline_depth, MAX_LISTENERS);
+    depth    = ucc_max(ucc_min(depth, n_frags), 1);
+    for (i = 0; i < n_frags; i++) {
+        frag_offset = ucc_buffer_block_offset(count, n_frags, i) * dt_size;
+        args.args.src.info.count = ucc_buffer_block_count(count, n_frags, i);
+        args.args.dst.info.count = args.args.src.info.count;
+        if (!is_root || !UCC_IS_INPLACE(coll_args->args)) {
+            args.args.src.info.buffer =
+                PTR_OFFSET(coll_args->args.src.info.buffer, frag_offset);
+        }
+        if (is_root) {
+            args.args.dst.info.buffer =
+                PTR_OFFSET(coll_args->args.dst.info.buffer, frag_offset);
+        }
+        status = ucc_tl_ucp_reduce_chain_frag_init(
+            &args, team, (i < depth) ? NULL : frags[i % depth], &task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            goto err;
+        }
+        status = ucc_schedule_add_task(schedule, task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->finalize(task);
+            goto err;
+        }
+        if (i < depth) {
+            /* first "depth" fragments start together with the schedule */
+            ucc_event_manager_subscribe(&schedule->super.em,
+                                        UCC_EVENT_SCHEDULE_STARTED, task);
+            task->handlers[UCC_EVENT_SCHEDULE_STARTED] = ucc_task_start_handler;
+        } else {
+            /* fragment i starts when fragment i - depth completes */
+            ucc_event_manager_subscribe(&frags[i % depth]->em,
+                                        UCC_EVENT_COMPLETED, task);
+            task->handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
+        }
+        frags[i % depth] = task;
+    }
+
+    schedule->super.post     = ucc_tl_ucp_reduce_chain_start;
+    schedule->super.progress = NULL;
+    schedule->super.finalize = ucc_tl_ucp_reduce_chain_finalize;
+    *task_h                  = &schedule->super;
+    return UCC_OK;
+err:
+    ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+out:
+    return status;
+}
@@ -0,0 +1,223 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "reduce.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+
+/* Knomial tree reduce
+   1. Ranks are renumbered relative to root (vrank 0 is the root). At the
+      level with distance "dist" the rank with (vrank / dist) % radix == 0
+      receives the data of up to radix - 1 children vrank + i * dist and
+      reduces it into its accumulator with a single reduce_multi call, other
+      ranks send their accumulator to the parent and leave.
+   2. Root accumulates directly into dst, other non leaf ranks use scratch
+      of size radix * count: [accumulator][radix - 1 recv slots]. Leaf ranks
+      send their src buffer and don't need scratch.
+ */
+
+enum {
+    UCC_REDUCE_KN_PHASE_INIT,
+    UCC_REDUCE_KN_PHASE_MULTI,
+    UCC_REDUCE_KN_PHASE_SEND
+};
+
+ucc_status_t ucc_tl_ucp_reduce_knomial_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team      = task->team;
+    ucc_rank_t         rank      = team->rank;
+    ucc_rank_t         size      = team->size;
+    ucc_rank_t         root      = (ucc_rank_t)task->args.root;
+    ucc_rank_t         vrank     = (rank - root + size) % size;
+    ucc_kn_radix_t     radix     = task->reduce_kn.radix;
+    int                is_root   = (rank == root);
+    ucc_coll_buffer_info_t *info = REDUCE_BUF_INFO(task);
+    ucc_memory_type_t  mem_type  = info->mem_type;
+    size_t             count     = info->count;
+    ucc_datatype_t     dt        = info->datatype;
+    size_t             data_size = count * ucc_dt_size(dt);
+    void              *scratch   = task->reduce_kn.scratch;
+    void              *sbuf, *acc, *rbuf;
+    ucc_rank_t         vpeer, peer, pos, dist;
+    ucc_kn_radix_t     i;
+    ucc_status_t       status;
+
+    sbuf = (is_root && UCC_IS_INPLACE(task->args)) ? task->args.dst.info.buffer
+                                                   : task->args.src.info.buffer;
+    acc  = is_root ? task->args.dst.info.buffer : scratch;
+    rbuf = is_root ? scratch : PTR_OFFSET(scratch, data_size);
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    switch (task->reduce_kn.phase) {
+    case UCC_REDUCE_KN_PHASE_MULTI:
+        goto UCC_REDUCE_KN_PHASE_MULTI;
+    case UCC_REDUCE_KN_PHASE_SEND:
+        goto completion;
+    default:
+        break;
+    }
+    while (task->reduce_kn.dist < size) {
+        dist = task->reduce_kn.dist;
+        pos  = (vrank / dist) % radix;
+        if (pos == 0) {
+            task->reduce_kn.children_per_cycle = 0;
+            for (i = 1; i < radix; i++) {
+                vpeer = vrank + i * dist;
+                if (vpeer >= size) {
+                    break;
+                }
+                peer = (vpeer + root) % size;
+                UCPCHECK_GOTO(
+                    ucc_tl_ucp_recv_nb(PTR_OFFSET(rbuf, (i - 1) * data_size),
+                                       data_size, mem_type, peer, team, task),
+                    task, out);
+                task->reduce_kn.children_per_cycle++;
+            }
+            task->reduce_kn.phase = UCC_REDUCE_KN_PHASE_MULTI;
+UCC_REDUCE_KN_PHASE_MULTI:
+            if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+                return task->super.super.status;
+            }
+            if (task->reduce_kn.children_per_cycle > 0) {
+                status = ucc_dt_reduce_multi(
+                    task->reduce_kn.reduced ? acc : sbuf, rbuf, acc,
+                    task->reduce_kn.children_per_cycle, count, data_size, dt,
+                    mem_type, &task->args);
+                if (ucc_unlikely(UCC_OK != status)) {
+                    tl_error(UCC_TL_TEAM_LIB(team),
+                             "failed to perform dt reduction");
+                    task->super.super.status = status;
+                    goto out;
+                }
+                task->reduce_kn.reduced = 1;
+            }
+            task->reduce_kn.phase = UCC_REDUCE_KN_PHASE_INIT;
+        } else {
+            peer = (vrank - pos * dist + root) % size;
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_send_nb(task->reduce_kn.reduced ? acc : sbuf,
+                                   data_size, mem_type, peer, team, task),
+                task, out);
+            task->reduce_kn.phase = UCC_REDUCE_KN_PHASE_SEND;
+            if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+                return task->super.super.status;
+            }
+            goto completion;
+        }
+        task->reduce_kn.dist *= radix;
+    }
+
+    if (is_root && !task->reduce_kn.reduced && !UCC_IS_INPLACE(task->args)) {
+        /* single rank team */
+        status = ucc_mc_memcpy(task->args.dst.info.buffer,
+                               task->args.src.info.buffer, data_size, mem_type,
+                               task->args.src.info.mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            goto out;
+        }
+    }
+completion:
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_kn_done", 0);
+out:
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = task->team;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_kn_start", 0);
+    task->reduce_kn.dist    = 1;
+    task->reduce_kn.phase   = UCC_REDUCE_KN_PHASE_INIT;
+    task->reduce_kn.reduced = 0;
+    ucc_tl_ucp_task_reset(task);
+    status = ucc_tl_ucp_reduce_knomial_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_reduce_knomial_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    if (task->reduce_kn.scratch_mc_header) {
+        ucc_mc_free(task->reduce_kn.scratch_mc_header);
+    }
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_reduce_knomial_init_common(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t      *team  = task->team;
+    ucc_rank_t              rank  = team->rank;
+    ucc_rank_t              size  = team->size;
+    ucc_rank_t              root  = (ucc_rank_t)task->args.root;
+    ucc_rank_t              vrank = (rank - root + size) % size;
+    ucc_coll_buffer_info_t *info  = REDUCE_BUF_INFO(task);
+    size_t                  data_size;
+    ucc_status_t            status;
+
+    task->super.post                  = ucc_tl_ucp_reduce_knomial_start;
+    task->super.progress              = ucc_tl_ucp_reduce_knomial_progress;
+    task->super.finalize              = ucc_tl_ucp_reduce_knomial_finalize;
+    task->reduce_kn.radix             =
+        ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_kn_radix, size);
+    task->reduce_kn.scratch_mc_header = NULL;
+    task->reduce_kn.scratch           = NULL;
+
+    if (size > 1 && (vrank % task->reduce_kn.radix) == 0) {
+        /* rank has children at least at the first level */
+        data_size = info->count * ucc_dt_size(info->datatype);
+        if (vrank != 0) {
+            data_size *= task->reduce_kn.radix;
+        } else {
+            data_size *= task->reduce_kn.radix - 1;
+        }
+        status = ucc_mc_alloc(&task->reduce_kn.scratch_mc_header, data_size,
+                              info->mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TL_TEAM_LIB(team), "failed to allocate scratch buffer");
+            return status;
+        }
+        task->reduce_kn.scratch = task->reduce_kn.scratch_mc_header->addr;
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_knomial_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    REDUCE_TASK_CHECK(coll_args->args, tl_team);
+    task   = ucc_tl_ucp_init_task(coll_args, team);
+    status = ucc_tl_ucp_reduce_knomial_init_common(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        goto out;
+    }
+    *task_h = &task->super;
+out:
+    return status;
+}
@@ -0,0 +1,33 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "reduce_scatter.h"
+
+ucc_base_coll_alg_info_t
+    ucc_tl_ucp_reduce_scatter_algs[UCC_TL_UCP_REDUCE_SCATTER_ALG_LAST + 1] = {
+        [UCC_TL_UCP_REDUCE_SCATTER_ALG_KNOMIAL] =
+            {.id   = UCC_TL_UCP_REDUCE_SCATTER_ALG_KNOMIAL,
+             .name = "knomial",
+             .desc = "recursive k-ing with arbitrary radix over permuted "
+                     "blocks (latency oriented alg)"},
+        [UCC_TL_UCP_REDUCE_SCATTER_ALG_RING] =
+            {.id   = UCC_TL_UCP_REDUCE_SCATTER_ALG_RING,
+             .name = "ring",
+             .desc = "ring reduce-scatter (bw oriented alg)"},
+        [UCC_TL_UCP_REDUCE_SCATTER_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_status_t status;
+
+    REDUCE_SCATTER_TASK_CHECK(task->args, task->team);
+    status = ucc_tl_ucp_reduce_scatter_ring_init_common(task);
+out:
+    return status;
+}
@@ -8,15 +8,93 @@
 #include "../tl_ucp.h"
 #include "../tl_ucp_coll.h"
 
-/* Base interface signature: uses reduce_scatter_kn_radix from config. */
+/* Reduce-scatter: dst.info.count is the number of elements of the result
+   of each rank, src holds dst.info.count * team_size elements, block r of
+   the reduced vector goes to rank r. In place: the whole vector is taken
+   from dst and the result is stored at the beginning of dst.
+   Reduce-scatterv: the src vector is split contiguously in rank order
+   by dst.info_v.counts, displacements are not used. */
 
+enum {
+    UCC_TL_UCP_REDUCE_SCATTER_ALG_KNOMIAL,
+    UCC_TL_UCP_REDUCE_SCATTER_ALG_RING,
+    UCC_TL_UCP_REDUCE_SCATTER_ALG_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+    ucc_tl_ucp_reduce_scatter_algs[UCC_TL_UCP_REDUCE_SCATTER_ALG_LAST + 1];
+
+#define UCC_TL_UCP_REDUCE_SCATTER_DEFAULT_ALG_SELECT_STR                       \
+    "reduce_scatter:0-32k:@knomial#reduce_scatter:32k-inf:@ring"
+
+#define REDUCE_SCATTER_TASK_CHECK(_args, _team)                                \
+    do {                                                                       \
+        ucc_memory_type_t _dst_mt =                                            \
+            (UCC_COLL_TYPE_REDUCE_SCATTERV == (_args).coll_type)               \
+                ? (_args).dst.info_v.mem_type                                  \
+                : (_args).dst.info.mem_type;                                   \
+        ucc_datatype_t _dt =                                                   \
+            (UCC_COLL_TYPE_REDUCE_SCATTERV == (_args).coll_type)               \
+                ? (_args).dst.info_v.datatype                                  \
+                : (_args).dst.info.datatype;                                   \
+        if ((_args).mask & UCC_COLL_ARGS_FIELD_USERDEFINED_REDUCTIONS) {       \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "userdefined reductions are not supported yet");          \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+        if (!UCC_IS_INPLACE(_args) &&                                          \
+            ((_args).src.info.mem_type != _dst_mt)) {                          \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "assymetric src/dst memory types are not supported yet"); \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+        if (!ucc_reduction_op_dt_valid((_args).reduce.predefined_op,           \
+                                       _dt)) {                                 \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "reduction op %s is not supported for datatype %s",       \
+                     ucc_reduction_op_str((_args).reduce.predefined_op),       \
+                     ucc_datatype_str(_dt));                                   \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
+static inline int ucc_tl_ucp_reduce_scatter_alg_from_str(const char *str)
+{
+    int i;
+    for (i = 0; i < UCC_TL_UCP_REDUCE_SCATTER_ALG_LAST; i++) {
+        if (0 == strcasecmp(str, ucc_tl_ucp_reduce_scatter_algs[i].name)) {
+            break;
+        }
+    }
+    return i;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_init(ucc_tl_ucp_task_t *task);
+
+/* Base interface signature: uses reduce_scatter_kn_radix from config.
+   Only UCC_COLL_TYPE_REDUCE_SCATTER with the layout described above. */
 ucc_status_t
 ucc_tl_ucp_reduce_scatter_knomial_init(ucc_base_coll_args_t *coll_args,
                                        ucc_base_team_t      *team,
                                        ucc_coll_task_t     **task_h);
 
-/* Internal interface to KN reduce scatter with custom radix */
+/* Internal interface to KN reduce scatter with custom radix: the result of
+   the rank is stored in dst at ucc_sra_kn_get_offset */
 ucc_status_t ucc_tl_ucp_reduce_scatter_knomial_init_r(
     ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
     ucc_coll_task_t **task_h, ucc_kn_radix_t radix);
+
+/* Ring reduce-scatter(v). When used for other collective types (phase of
+   ring allreduce) src.info.count elements are split by
+   ucc_buffer_block_count and the result block of the rank is stored in dst
+   at offset ucc_buffer_block_offset(count, team_size, rank) */
+ucc_status_t
+ucc_tl_ucp_reduce_scatter_ring_init(ucc_base_coll_args_t *coll_args,
+                                    ucc_base_team_t      *team,
+                                    ucc_coll_task_t     **task_h);
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_ring_init_common(ucc_tl_ucp_task_t *task);
 #endif
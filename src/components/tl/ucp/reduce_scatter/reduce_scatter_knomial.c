@@ -7,6 +7,7 @@
 #include "config.h"
 #include "tl_ucp.h"
 #include "tl_ucp_coll.h"
+#include "reduce_scatter.h"
 #include "tl_ucp_sendrecv.h"
 #include "core/ucc_progress_queue.h"
 #include "core/ucc_mc.h"
@@ -42,11 +43,22 @@ ucc_tl_ucp_reduce_scatter_knomial_progress(ucc_coll_task_t *coll_task)
     ucc_status_t           status;
     ucc_kn_radix_t         loop_step;
     size_t                 block_count, peer_seg_count, local_seg_count;
-    void                  *reduce_data, *local_data;
+    void                  *reduce_data, *local_data, *loop_sbuf;
 
+    /* PROXY reduces the data of EXTRA into dst, the loop starts from there */
+    loop_sbuf       = (KN_NODE_PROXY == node_type) ? rbuf : sbuf;
     local_seg_count = 0;
     block_count     = ucc_sra_kn_compute_block_count(count, rank, p);
-    UCC_KN_GOTO_PHASE(task->reduce_scatter_kn.phase);
+    switch (task->reduce_scatter_kn.phase) {
+    case UCC_KN_PHASE_EXTRA:
+        goto UCC_KN_PHASE_EXTRA;
+    case UCC_KN_PHASE_LOOP:
+        goto UCC_KN_PHASE_LOOP;
+    case UCC_KN_PHASE_COPY:
+        goto UCC_KN_PHASE_COPY;
+    default:
+        break;
+    }
 
     if (KN_NODE_EXTRA == node_type) {
         peer = ucc_knomial_pattern_get_proxy(p, rank);
@@ -78,13 +90,12 @@ UCC_KN_PHASE_EXTRA:
                 task->super.super.status = status;
                 return status;
             }
-            task->args.src.info.buffer = task->args.dst.info.buffer;
         }
     }
     while (!ucc_knomial_pattern_loop_done(p)) {
         step_radix  = ucc_sra_kn_compute_step_radix(rank, size, p);
         block_count = ucc_sra_kn_compute_block_count(count, rank, p);
-        sbuf        = (p->iteration == 0) ? task->args.src.info.buffer
+        sbuf        = (p->iteration == 0) ? loop_sbuf
                                           : task->reduce_scatter_kn.scratch;
         for (loop_step = 1; loop_step < radix; loop_step++) {
             peer = ucc_knomial_pattern_get_loop_peer(p, rank, size, loop_step);
@@ -126,8 +137,9 @@ UCC_KN_PHASE_EXTRA:
             SAVE_STATE(UCC_KN_PHASE_LOOP);
             return task->super.super.status;
         }
-        if (task->send_posted > p->iteration * (radix - 1)) {
-            sbuf = task->args.src.info.buffer;
+        if (!task->reduce_scatter_kn.mc_req &&
+            (task->send_posted > p->iteration * (radix - 1))) {
+            sbuf = loop_sbuf;
             rbuf = task->reduce_scatter_kn.scratch;
             if (p->iteration != 0) {
                 sbuf = task->reduce_scatter_kn.scratch;
@@ -142,11 +154,31 @@ UCC_KN_PHASE_EXTRA:
                 block_count, step_radix, local_seg_index);
             local_data  = PTR_OFFSET(sbuf, local_seg_offset * dt_size);
             reduce_data = task->reduce_scatter_kn.scratch;
-            if (UCC_OK != (status = ucc_dt_reduce_multi(
-                               local_data, rbuf, reduce_data,
-                               task->send_posted - p->iteration * (radix - 1),
-                               local_seg_count, local_seg_count * dt_size, dt,
-                               mem_type, &task->args))) {
+            status = ucc_dt_reduce_multi_nb(
+                local_data, rbuf, reduce_data,
+                task->send_posted - p->iteration * (radix - 1),
+                local_seg_count, local_seg_count * dt_size, dt, mem_type,
+                &task->args, &task->reduce_scatter_kn.mc_req);
+            if (UCC_OK != status && UCC_INPROGRESS != status) {
+                tl_error(UCC_TL_TEAM_LIB(task->team),
+                         "failed to perform dt reduction");
+                task->super.super.status = status;
+                return status;
+            }
+        }
+        /* reduction executed by the helper threads of mc */
+        if (task->reduce_scatter_kn.mc_req) {
+            status = ucc_mc_req_test(task->reduce_scatter_kn.mc_req);
+            if (UCC_INPROGRESS == status) {
+                /* no UCP operation completes to mark the task runnable
+                   in the event driven mode: test the request again on the
+                   next progress call */
+                ucc_coll_task_set_runnable(&task->super);
+                SAVE_STATE(UCC_KN_PHASE_LOOP);
+                return task->super.super.status;
+            }
+            task->reduce_scatter_kn.mc_req = NULL;
+            if (UCC_OK != status) {
                 tl_error(UCC_TL_TEAM_LIB(task->team),
                          "failed to perform dt reduction");
                 task->super.super.status = status;
@@ -157,14 +189,29 @@ UCC_KN_PHASE_EXTRA:
     }
 
     offset = ucc_sra_kn_get_offset(count, dt_size, rank, size, radix);
-    status = ucc_mc_memcpy(PTR_OFFSET(task->args.dst.info.buffer, offset),
-                           task->reduce_scatter_kn.scratch,
-                           local_seg_count * dt_size, mem_type, mem_type);
-
-    if (UCC_OK != status) {
+    status = ucc_mc_memcpy_nb(PTR_OFFSET(task->args.dst.info.buffer, offset),
+                              task->reduce_scatter_kn.scratch,
+                              local_seg_count * dt_size, mem_type, mem_type,
+                              &task->reduce_scatter_kn.mc_req);
+    if (ucc_unlikely(UCC_OK != status && UCC_INPROGRESS != status)) {
+        task->super.super.status = status;
         return status;
     }
-UCC_KN_PHASE_PROXY: /* unused label */
+UCC_KN_PHASE_COPY:
+    /* copy executed by the helper threads of mc */
+    if (task->reduce_scatter_kn.mc_req) {
+        status = ucc_mc_req_test(task->reduce_scatter_kn.mc_req);
+        if (UCC_INPROGRESS == status) {
+            ucc_coll_task_set_runnable(&task->super);
+            SAVE_STATE(UCC_KN_PHASE_COPY);
+            return task->super.super.status;
+        }
+        task->reduce_scatter_kn.mc_req = NULL;
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            return status;
+        }
+    }
 out:
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_scatter_kn_done",
                                      0);
@@ -180,7 +227,12 @@ ucc_status_t ucc_tl_ucp_reduce_scatter_knomial_start(ucc_coll_task_t *coll_task)
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_scatter_kn_start",
                                      0);
-    task->super.super.status = UCC_INPROGRESS;
+    ucc_tl_ucp_task_reset(task);
+    task->reduce_scatter_kn.phase      = UCC_KN_PHASE_INIT;
+    task->reduce_scatter_kn.mc_req = NULL;
+    ucc_knomial_pattern_init(team->size, team->rank,
+                             task->reduce_scatter_kn.p.radix,
+                             &task->reduce_scatter_kn.p);
     status = ucc_tl_ucp_reduce_scatter_knomial_progress(&task->super);
     if (UCC_INPROGRESS == status) {
         ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
@@ -221,8 +273,9 @@ ucc_status_t ucc_tl_ucp_reduce_scatter_knomial_init_r(
     task->super.progress = ucc_tl_ucp_reduce_scatter_knomial_progress;
     task->super.finalize = ucc_tl_ucp_reduce_scatter_knomial_finalize;
 
-    task->reduce_scatter_kn.phase   = UCC_KN_PHASE_INIT;
-    task->reduce_scatter_kn.scratch = task->args.dst.info.buffer;
+    task->reduce_scatter_kn.phase      = UCC_KN_PHASE_INIT;
+    task->reduce_scatter_kn.scratch    = task->args.dst.info.buffer;
+    task->reduce_scatter_kn.mc_req = NULL;
     ucc_assert(task->args.src.info.mem_type == task->args.dst.info.mem_type);
     ucc_knomial_pattern_init(size, rank, radix, &task->reduce_scatter_kn.p);
 
@@ -244,22 +297,330 @@ ucc_status_t ucc_tl_ucp_reduce_scatter_knomial_init_r(
     return UCC_OK;
 }
 
+/* Knomial reduce-scatter with the standard block layout
+   SRA knomial reduce-scatter leaves the result of the rank at
+   ucc_sra_kn_get_offset of the digit reversed segmentation and EXTRA ranks
+   get nothing. To use it for UCC_COLL_TYPE_REDUCE_SCATTER the schedule of 3
+   tasks is built:
+   1. pack: the input blocks are permuted into the "virtual" vector, so that
+      the final SRA segment of every loop rank consists of its own block
+      followed by the block of its EXTRA rank (if rank is PROXY). The segment
+      size is 2 * count for all ranks when there are EXTRA ranks, for ranks
+      without EXTRA the 2nd half is padding and never read.
+   2. SRA knomial reduce-scatter of the virtual vector.
+   3. unpack: the own block is copied from the final segment to dst, PROXY
+      sends the 2nd half of its segment to EXTRA. */
+
+static inline size_t
+ucc_tl_ucp_reduce_scatter_kn_slot(ucc_rank_t block, ucc_rank_t size,
+                                  ucc_rank_t n_extra, ucc_kn_radix_t radix,
+                                  size_t count, size_t vcount)
+{
+    ucc_rank_t proxy = block;
+
+    if (block < n_extra * 2) {
+        proxy = block - block % 2;
+    }
+    return ucc_sra_kn_get_offset(vcount, 1, proxy, size, radix) +
+           (block - proxy) * count;
+}
+
+static inline size_t ucc_tl_ucp_reduce_scatter_kn_vcount(ucc_rank_t n_extra,
+                                                         ucc_rank_t size,
+                                                         size_t     count)
+{
+    return (size - n_extra) * (n_extra ? 2 * count : count);
+}
+
+/* The blocks are copied one by one, every copy may run on the helper
+   threads of mc */
+ucc_status_t
+ucc_tl_ucp_reduce_scatter_kn_pack_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t    *task     = ucc_derived_of(coll_task,
+                                                    ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t    *team     = task->team;
+    ucc_rank_t            size     = team->size;
+    ucc_kn_radix_t        radix    = task->reduce_scatter_kn_layout.radix;
+    size_t                count    = task->args.dst.info.count;
+    ucc_memory_type_t     mem_type = task->args.dst.info.mem_type;
+    size_t                dt_size  = ucc_dt_size(task->args.dst.info.datatype);
+    void                 *sbuf     = task->args.src.info.buffer;
+    ucc_knomial_pattern_t p;
+    size_t                vcount, slot;
+    ucc_rank_t            i;
+    ucc_status_t          status;
+
+    if (UCC_IS_INPLACE(task->args)) {
+        sbuf = task->args.dst.info.buffer;
+    }
+    ucc_knomial_pattern_init(size, team->rank, radix, &p);
+    vcount = ucc_tl_ucp_reduce_scatter_kn_vcount(p.n_extra, size, count);
+    for (;;) {
+        if (task->reduce_scatter_kn_layout.mc_req) {
+            status = ucc_mc_req_test(task->reduce_scatter_kn_layout.mc_req);
+            if (UCC_INPROGRESS == status) {
+                ucc_coll_task_set_runnable(&task->super);
+                return task->super.super.status;
+            }
+            task->reduce_scatter_kn_layout.mc_req = NULL;
+            if (ucc_unlikely(UCC_OK != status)) {
+                goto err;
+            }
+        }
+        if (task->reduce_scatter_kn_layout.block == size) {
+            break;
+        }
+        i      = task->reduce_scatter_kn_layout.block++;
+        slot   = ucc_tl_ucp_reduce_scatter_kn_slot(i, size, p.n_extra, radix,
+                                                   count, vcount);
+        status = ucc_mc_memcpy_nb(
+            PTR_OFFSET(task->reduce_scatter_kn_layout.scratch, slot * dt_size),
+            PTR_OFFSET(sbuf, i * count * dt_size), count * dt_size, mem_type,
+            mem_type, &task->reduce_scatter_kn_layout.mc_req);
+        if (ucc_unlikely(UCC_OK != status && UCC_INPROGRESS != status)) {
+            goto err;
+        }
+    }
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_scatter_kn_pack",
+                                     0);
+    return task->super.super.status;
+err:
+    task->super.super.status = status;
+    return status;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_kn_pack_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = task->team;
+    ucc_status_t       status;
+
+    ucc_tl_ucp_task_reset(task);
+    task->reduce_scatter_kn_layout.block  = 0;
+    task->reduce_scatter_kn_layout.mc_req = NULL;
+    status = ucc_tl_ucp_reduce_scatter_kn_pack_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t
+ucc_tl_ucp_reduce_scatter_kn_unpack_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    ucc_status_t       status;
+
+    if (task->reduce_scatter_kn_layout.mc_req) {
+        status = ucc_mc_req_test(task->reduce_scatter_kn_layout.mc_req);
+        if (UCC_INPROGRESS == status) {
+            ucc_coll_task_set_runnable(&task->super);
+            return task->super.super.status;
+        }
+        task->reduce_scatter_kn_layout.mc_req = NULL;
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            return status;
+        }
+    }
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_scatter_kn_unpack",
+                                     0);
+    return task->super.super.status;
+}
+
+ucc_status_t
+ucc_tl_ucp_reduce_scatter_kn_unpack_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t    *task     = ucc_derived_of(coll_task,
+                                                    ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t    *team     = task->team;
+    ucc_rank_t            size     = team->size;
+    ucc_rank_t            rank     = team->rank;
+    ucc_kn_radix_t        radix    = task->reduce_scatter_kn_layout.radix;
+    size_t                count    = task->args.dst.info.count;
+    ucc_memory_type_t     mem_type = task->args.dst.info.mem_type;
+    size_t                dt_size  = ucc_dt_size(task->args.dst.info.datatype);
+    void                 *rbuf     = task->args.dst.info.buffer;
+    ucc_knomial_pattern_t p;
+    size_t                vcount;
+    void                 *seg;
+    ucc_status_t          status;
+
+    ucc_tl_ucp_task_reset(task);
+    task->reduce_scatter_kn_layout.mc_req = NULL;
+    ucc_knomial_pattern_init(size, rank, radix, &p);
+    if (KN_NODE_EXTRA == p.node_type) {
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(rbuf, count * dt_size, mem_type,
+                                         ucc_knomial_pattern_get_proxy(&p, rank),
+                                         team, task),
+                      task, out);
+    } else {
+        vcount = ucc_tl_ucp_reduce_scatter_kn_vcount(p.n_extra, size, count);
+        /* reduced virtual vector follows the packed one in scratch */
+        seg    = PTR_OFFSET(task->reduce_scatter_kn_layout.scratch,
+                            (vcount + ucc_sra_kn_get_offset(vcount, 1, rank,
+                                                            size, radix)) *
+                                dt_size);
+        if (KN_NODE_PROXY == p.node_type) {
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_send_nb(PTR_OFFSET(seg, count * dt_size),
+                                   count * dt_size, mem_type,
+                                   ucc_knomial_pattern_get_extra(&p, rank),
+                                   team, task),
+                task, out);
+        }
+        status = ucc_mc_memcpy_nb(rbuf, seg, count * dt_size, mem_type,
+                                  mem_type,
+                                  &task->reduce_scatter_kn_layout.mc_req);
+        if (ucc_unlikely(UCC_OK != status && UCC_INPROGRESS != status)) {
+            task->super.super.status = status;
+            return status;
+        }
+    }
+    status = ucc_tl_ucp_reduce_scatter_kn_unpack_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+out:
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t
+ucc_tl_ucp_reduce_scatter_kn_unpack_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    ucc_mc_free(task->reduce_scatter_kn_layout.scratch_mc_header);
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_kn_schedule_start(ucc_coll_task_t *task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(task, ucc_schedule_t);
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_reduce_scatter_kn_start",
+                                     0);
+    return ucc_schedule_start(schedule);
+}
+
+ucc_status_t
+ucc_tl_ucp_reduce_scatter_kn_schedule_finalize(ucc_coll_task_t *task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(task, ucc_schedule_t);
+    ucc_status_t    status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(schedule, "ucp_reduce_scatter_kn_done", 0);
+    status = ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    return status;
+}
+
 ucc_status_t
 ucc_tl_ucp_reduce_scatter_knomial_init(ucc_base_coll_args_t *coll_args,
                                        ucc_base_team_t *     team,
                                        ucc_coll_task_t **    task_h)
 {
-    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
-    ucc_rank_t         size    = tl_team->size;
-    size_t             count   = coll_args->args.src.info.count;
-    ucc_kn_radix_t     radix;
+    ucc_tl_ucp_team_t      *tl_team  = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_rank_t              size     = tl_team->size;
+    size_t                  count    = coll_args->args.dst.info.count;
+    ucc_datatype_t          dt       = coll_args->args.dst.info.datatype;
+    size_t                  dt_size  = ucc_dt_size(dt);
+    ucc_memory_type_t       mem_type = coll_args->args.dst.info.mem_type;
+    ucc_base_coll_args_t    args     = *coll_args;
+    ucc_mc_buffer_header_t *scratch_mc_header;
+    ucc_tl_ucp_task_t      *pack_task, *unpack_task;
+    ucc_coll_task_t        *rs_task;
+    ucc_schedule_t         *schedule;
+    ucc_knomial_pattern_t   p;
+    ucc_kn_radix_t          radix;
+    size_t                  vcount;
+    ucc_status_t            status;
 
-    radix = ucc_min(UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.reduce_scatter_kn_radix,
+    REDUCE_SCATTER_TASK_CHECK(coll_args->args, tl_team);
+    if (size == 1) {
+        return ucc_tl_ucp_reduce_scatter_ring_init(coll_args, team, task_h);
+    }
+    radix = ucc_min(UCC_TL_UCP_TEAM_KN_RADIX(tl_team, reduce_scatter_kn_radix),
                     size);
-    if (((count + radix - 1) / radix * (radix - 1) > count) ||
-        ((radix - 1) > count)) {
-        radix = 2;
+    radix = ucc_max(radix, 2);
+    ucc_knomial_pattern_init(size, tl_team->rank, radix, &p);
+    vcount = ucc_tl_ucp_reduce_scatter_kn_vcount(p.n_extra, size, count);
+    status = ucc_mc_alloc(&scratch_mc_header, 2 * vcount * dt_size, mem_type);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team), "failed to allocate scratch buffer");
+        goto out;
+    }
+    schedule = ucc_tl_ucp_get_schedule(tl_team);
+
+    /* 1st step: pack the blocks into the virtual vector */
+    pack_task = ucc_tl_ucp_init_task(coll_args, team);
+    pack_task->super.post                       =
+        ucc_tl_ucp_reduce_scatter_kn_pack_start;
+    pack_task->super.progress                   =
+        ucc_tl_ucp_reduce_scatter_kn_pack_progress;
+    pack_task->reduce_scatter_kn_layout.radix   = radix;
+    pack_task->reduce_scatter_kn_layout.scratch = scratch_mc_header->addr;
+    ucc_schedule_add_task(schedule, &pack_task->super);
+    ucc_event_manager_subscribe(&schedule->super.em, UCC_EVENT_SCHEDULE_STARTED,
+                                &pack_task->super);
+    pack_task->super.handlers[UCC_EVENT_SCHEDULE_STARTED] =
+        ucc_task_start_handler;
+
+    /* 2nd step: SRA knomial reduce-scatter of the virtual vector */
+    args.args.mask             |= UCC_COLL_ARGS_FIELD_FLAGS;
+    args.args.flags            &= ~UCC_COLL_ARGS_FLAG_IN_PLACE;
+    args.args.src.info.buffer   = scratch_mc_header->addr;
+    args.args.src.info.count    = vcount;
+    args.args.src.info.datatype = dt;
+    args.args.src.info.mem_type = mem_type;
+    args.args.dst.info.buffer   = PTR_OFFSET(scratch_mc_header->addr,
+                                             vcount * dt_size);
+    args.args.dst.info.count    = vcount;
+    status = ucc_tl_ucp_reduce_scatter_knomial_init_r(&args, team, &rs_task,
+                                                      radix);
+    if (UCC_OK != status) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "failed to init reduce_scatter_knomial task");
+        goto err;
     }
-    return ucc_tl_ucp_reduce_scatter_knomial_init_r(coll_args, team, task_h,
-                                                    radix);
+    ucc_schedule_add_task(schedule, rs_task);
+    ucc_event_manager_subscribe(&pack_task->super.em, UCC_EVENT_COMPLETED,
+                                rs_task);
+    rs_task->handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
+
+    /* 3rd step: move the own block to dst and serve EXTRA rank */
+    unpack_task = ucc_tl_ucp_init_task(coll_args, team);
+    unpack_task->super.post     = ucc_tl_ucp_reduce_scatter_kn_unpack_start;
+    unpack_task->super.progress = ucc_tl_ucp_reduce_scatter_kn_unpack_progress;
+    unpack_task->super.finalize = ucc_tl_ucp_reduce_scatter_kn_unpack_finalize;
+    unpack_task->reduce_scatter_kn_layout.radix             = radix;
+    unpack_task->reduce_scatter_kn_layout.scratch           =
+        scratch_mc_header->addr;
+    unpack_task->reduce_scatter_kn_layout.scratch_mc_header = scratch_mc_header;
+    ucc_schedule_add_task(schedule, &unpack_task->super);
+    ucc_event_manager_subscribe(&rs_task->em, UCC_EVENT_COMPLETED,
+                                &unpack_task->super);
+    unpack_task->super.handlers[UCC_EVENT_COMPLETED] = ucc_task_start_handler;
+
+    schedule->super.post     = ucc_tl_ucp_reduce_scatter_kn_schedule_start;
+    schedule->super.progress = NULL;
+    schedule->super.finalize = ucc_tl_ucp_reduce_scatter_kn_schedule_finalize;
+    *task_h                  = &schedule->super;
+    return UCC_OK;
+err:
+    ucc_schedule_finalize(&schedule->super);
+    ucc_tl_ucp_put_schedule(schedule);
+    ucc_mc_free(scratch_mc_header);
+out:
+    return status;
 }
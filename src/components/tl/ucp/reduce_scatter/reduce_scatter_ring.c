@@ -0,0 +1,278 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "reduce_scatter.h"
+#include "tl_ucp_sendrecv.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+
+/* Ring reduce-scatter
+   1. The src buffer is split into team size blocks: block r is the result
+      of rank r (see reduce_scatter.h for the layout of reduce-scatter(v)).
+      When used as the 1st phase of ring allreduce the total count is split
+      using ucc_buffer_block_count/ucc_buffer_block_offset.
+   2. At step s rank r sends block (r - s - 1) to rank r + 1 and receives
+      block (r - s - 2) from rank r - 1 into the scratch. The received
+      partial result is reduced with the local contribution of that block
+      and sent further at the next step.
+   3. After size - 1 steps rank r holds the fully reduced block r. Allreduce
+      keeps the partial results in dst at the block offsets, so the layout
+      matches the input of the ring allgather. Standalone reduce-scatter(v)
+      keeps them in the 2nd half of the scratch and reduces the last block
+      directly into dst.
+   4. Requires a scratch of the size of the largest block (2 blocks for
+      standalone reduce-scatter(v)). */
+
+static inline void
+ucc_tl_ucp_reduce_scatter_ring_block(ucc_tl_ucp_task_t *task, ucc_rank_t block,
+                                     size_t *count, size_t *offset)
+{
+    ucc_coll_args_t *args = &task->args;
+    ucc_rank_t       size = task->team->size;
+    ucc_rank_t       i;
+
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        *count  = args->dst.info.count;
+        *offset = block * args->dst.info.count;
+        break;
+    case UCC_COLL_TYPE_REDUCE_SCATTERV:
+        *count  = ucc_coll_args_get_count(args, args->dst.info_v.counts, block);
+        *offset = 0;
+        for (i = 0; i < block; i++) {
+            *offset += ucc_coll_args_get_count(args, args->dst.info_v.counts, i);
+        }
+        break;
+    default:
+        *count  = ucc_buffer_block_count(args->src.info.count, size, block);
+        *offset = ucc_buffer_block_offset(args->src.info.count, size, block);
+        break;
+    }
+}
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_ring_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = task->team;
+    ucc_rank_t         size     = team->size;
+    ucc_rank_t         rank     = team->rank;
+    void              *sbuf     = task->args.src.info.buffer;
+    void              *rbuf     = task->args.dst.info.buffer;
+    void              *scratch  = task->reduce_scatter_ring.scratch;
+    void              *partial  = task->reduce_scatter_ring.reduce_scratch;
+    ucc_memory_type_t  mem_type = task->args.src.info.mem_type;
+    ucc_datatype_t     dt       = task->args.src.info.datatype;
+    size_t             dt_size  = ucc_dt_size(dt);
+    ucc_rank_t         sendto   = (rank + 1) % size;
+    ucc_rank_t         recvfrom = (rank - 1 + size) % size;
+    ucc_rank_t         step, block;
+    size_t             block_count, block_offset;
+    ucc_status_t       status;
+    void              *buf;
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    while (1) {
+        step = task->recv_posted;
+        if (step > 0) {
+            /* reduce the block received at previous step */
+            block = (rank - step - 1 + size) % size;
+            ucc_tl_ucp_reduce_scatter_ring_block(task, block, &block_count,
+                                                 &block_offset);
+            if (!partial) {
+                buf = PTR_OFFSET(rbuf, block_offset * dt_size);
+            } else if (block == rank && !UCC_IS_INPLACE(task->args)) {
+                buf = rbuf;
+            } else {
+                buf = partial;
+            }
+            status = ucc_dt_reduce(PTR_OFFSET(sbuf, block_offset * dt_size),
+                                   scratch, buf, block_count, dt, mem_type,
+                                   &task->args);
+            if (ucc_unlikely(UCC_OK != status)) {
+                tl_error(UCC_TL_TEAM_LIB(team),
+                         "failed to perform dt reduction");
+                task->super.super.status = status;
+                return status;
+            }
+        }
+        if (step == size - 1) {
+            break;
+        }
+        block = (rank - step - 1 + size) % size;
+        ucc_tl_ucp_reduce_scatter_ring_block(task, block, &block_count,
+                                             &block_offset);
+        if (step == 0) {
+            buf = PTR_OFFSET(sbuf, block_offset * dt_size);
+        } else {
+            buf = partial ? partial : PTR_OFFSET(rbuf, block_offset * dt_size);
+        }
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(buf, block_count * dt_size, mem_type,
+                                         sendto, team, task),
+                      task, out);
+        block = (rank - step - 2 + size) % size;
+        ucc_tl_ucp_reduce_scatter_ring_block(task, block, &block_count,
+                                             &block_offset);
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(scratch, block_count * dt_size,
+                                         mem_type, recvfrom, team, task),
+                      task, out);
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return task->super.super.status;
+        }
+    }
+    if (partial && UCC_IS_INPLACE(task->args) && size > 1) {
+        /* inplace result goes to the beginning of dst, it may overlap with
+           the local contribution of the last block */
+        ucc_tl_ucp_reduce_scatter_ring_block(task, rank, &block_count,
+                                             &block_offset);
+        status = ucc_mc_memcpy(rbuf, partial, block_count * dt_size, mem_type,
+                               mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            return status;
+        }
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+out:
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_scatter_ring_done",
+                                     0);
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_ring_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = task->team;
+    size_t             block_count, block_offset;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_reduce_scatter_ring_start",
+                                     0);
+    ucc_tl_ucp_task_reset(task);
+    if (team->size == 1 && !UCC_IS_INPLACE(task->args)) {
+        ucc_tl_ucp_reduce_scatter_ring_block(task, 0, &block_count,
+                                             &block_offset);
+        status = ucc_mc_memcpy(task->args.dst.info.buffer,
+                               task->args.src.info.buffer,
+                               block_count *
+                                   ucc_dt_size(task->args.src.info.datatype),
+                               task->args.src.info.mem_type,
+                               task->args.src.info.mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    status = ucc_tl_ucp_reduce_scatter_ring_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_ring_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    ucc_mc_free(task->reduce_scatter_ring.scratch_mc_header);
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_reduce_scatter_ring_init_common(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team = task->team;
+    ucc_coll_args_t   *args = &task->args;
+    ucc_rank_t         size = team->size;
+    size_t             max_count, block_count, block_offset, dt_size;
+    ucc_memory_type_t  mem_type;
+    ucc_rank_t         i;
+    ucc_status_t       status;
+
+    task->super.post     = ucc_tl_ucp_reduce_scatter_ring_start;
+    task->super.progress = ucc_tl_ucp_reduce_scatter_ring_progress;
+    task->super.finalize = ucc_tl_ucp_reduce_scatter_ring_finalize;
+    task->reduce_scatter_ring.reduce_scratch = NULL;
+
+    /* progress works with src.info only: describe the whole input vector
+       there, for inplace it is stored in dst */
+    if (UCC_COLL_TYPE_REDUCE_SCATTERV == args->coll_type) {
+        args->src.info.count = ucc_coll_args_get_total_count(
+            args, args->dst.info_v.counts, size);
+        if (UCC_IS_INPLACE(*args)) {
+            args->src.info.buffer   = args->dst.info_v.buffer;
+            args->src.info.datatype = args->dst.info_v.datatype;
+            args->src.info.mem_type = args->dst.info_v.mem_type;
+        }
+    } else if (UCC_IS_INPLACE(*args)) {
+        if (UCC_COLL_TYPE_REDUCE_SCATTER == args->coll_type) {
+            args->src.info.count = args->dst.info.count * size;
+        }
+        args->src.info.buffer   = args->dst.info.buffer;
+        args->src.info.datatype = args->dst.info.datatype;
+        args->src.info.mem_type = args->dst.info.mem_type;
+    }
+    dt_size  = ucc_dt_size(args->src.info.datatype);
+    mem_type = args->src.info.mem_type;
+
+    max_count = 0;
+    for (i = 0; i < size; i++) {
+        ucc_tl_ucp_reduce_scatter_ring_block(task, i, &block_count,
+                                             &block_offset);
+        max_count = ucc_max(max_count, block_count);
+        if (UCC_COLL_TYPE_REDUCE_SCATTERV != args->coll_type) {
+            /* block 0 is the largest one */
+            break;
+        }
+    }
+    if (UCC_COLL_TYPE_REDUCE_SCATTER != args->coll_type &&
+        UCC_COLL_TYPE_REDUCE_SCATTERV != args->coll_type) {
+        status = ucc_mc_alloc(&task->reduce_scatter_ring.scratch_mc_header,
+                              max_count * dt_size, mem_type);
+    } else {
+        /* 2nd half keeps the partial result sent at the next step */
+        status = ucc_mc_alloc(&task->reduce_scatter_ring.scratch_mc_header,
+                              2 * max_count * dt_size, mem_type);
+    }
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(team), "failed to allocate scratch buffer");
+        return status;
+    }
+    task->reduce_scatter_ring.scratch =
+        task->reduce_scatter_ring.scratch_mc_header->addr;
+    if (UCC_COLL_TYPE_REDUCE_SCATTER == args->coll_type ||
+        UCC_COLL_TYPE_REDUCE_SCATTERV == args->coll_type) {
+        task->reduce_scatter_ring.reduce_scratch =
+            PTR_OFFSET(task->reduce_scatter_ring.scratch, max_count * dt_size);
+    }
+    return UCC_OK;
+}
+
+ucc_status_t
+ucc_tl_ucp_reduce_scatter_ring_init(ucc_base_coll_args_t *coll_args,
+                                    ucc_base_team_t      *team,
+                                    ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    REDUCE_SCATTER_TASK_CHECK(coll_args->args, tl_team);
+    task   = ucc_tl_ucp_init_task(coll_args, team);
+    status = ucc_tl_ucp_reduce_scatter_ring_init_common(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        goto out;
+    }
+    *task_h = &task->super;
+out:
+    return status;
+}
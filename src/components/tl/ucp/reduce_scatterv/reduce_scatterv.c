@@ -0,0 +1,21 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "reduce_scatterv.h"
+#include "../reduce_scatter/reduce_scatter.h"
+
+/* Ring handles uneven blocks, knomial requires equal blocks */
+ucc_status_t ucc_tl_ucp_reduce_scatterv_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_status_t status;
+
+    REDUCE_SCATTER_TASK_CHECK(task->args, task->team);
+    status = ucc_tl_ucp_reduce_scatter_ring_init_common(task);
+out:
+    return status;
+}
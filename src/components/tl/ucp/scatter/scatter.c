@@ -0,0 +1,37 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "scatter.h"
+
+ucc_base_coll_alg_info_t
+    ucc_tl_ucp_scatter_algs[UCC_TL_UCP_SCATTER_ALG_LAST + 1] = {
+        [UCC_TL_UCP_SCATTER_ALG_KNOMIAL] =
+            {.id   = UCC_TL_UCP_SCATTER_ALG_KNOMIAL,
+             .name = "knomial",
+             .desc = "scatter over knomial tree with arbitrary radix "
+                     "(latency oriented alg)"},
+        [UCC_TL_UCP_SCATTER_ALG_LINEAR] =
+            {.id   = UCC_TL_UCP_SCATTER_ALG_LINEAR,
+             .name = "linear",
+             .desc = "root sends to every rank directly with "
+                     "configurable number of outstanding messages (bw "
+                     "oriented alg)"},
+        [UCC_TL_UCP_SCATTER_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+ucc_status_t ucc_tl_ucp_scatter_knomial_init_common(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_scatter_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_status_t status;
+
+    SCATTER_TASK_CHECK(task->args, task->team);
+    status = ucc_tl_ucp_scatter_knomial_init_common(task);
+out:
+    return status;
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef SCATTER_H_
+#define SCATTER_H_
+#include "../tl_ucp.h"
+#include "../tl_ucp_coll.h"
+
+enum {
+    UCC_TL_UCP_SCATTER_ALG_KNOMIAL,
+    UCC_TL_UCP_SCATTER_ALG_LINEAR,
+    UCC_TL_UCP_SCATTER_ALG_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+             ucc_tl_ucp_scatter_algs[UCC_TL_UCP_SCATTER_ALG_LAST + 1];
+
+/* Knomial scatter forwards the data of whole subtrees through the
+   intermediate ranks: it is only worth it while the latency dominates. */
+#define UCC_TL_UCP_SCATTER_DEFAULT_ALG_SELECT_STR                              \
+    "scatter:0-64k:@knomial#scatter:64k-inf:@linear"
+
+#define SCATTER_TASK_CHECK(_args, _team)                                       \
+    do {                                                                       \
+        if ((_args).root == (_team)->rank) {                                   \
+            if ((_args).src.info.datatype == UCC_DT_USERDEFINED ||             \
+                (!UCC_IS_INPLACE(_args) &&                                     \
+                 (_args).dst.info.datatype == UCC_DT_USERDEFINED)) {           \
+                tl_debug(UCC_TL_TEAM_LIB(_team),                               \
+                         "user defined datatype is not supported");            \
+                status = UCC_ERR_NOT_SUPPORTED;                                \
+                goto out;                                                      \
+            }                                                                  \
+            if (!UCC_IS_INPLACE(_args) &&                                      \
+                (_args).src.info.mem_type != (_args).dst.info.mem_type) {      \
+                tl_debug(UCC_TL_TEAM_LIB(_team),                               \
+                         "assymetric src/dst memory types are not supported"); \
+                status = UCC_ERR_NOT_SUPPORTED;                                \
+                goto out;                                                      \
+            }                                                                  \
+        } else if ((_args).dst.info.datatype == UCC_DT_USERDEFINED) {          \
+            tl_debug(UCC_TL_TEAM_LIB(_team),                                   \
+                     "user defined datatype is not supported");                \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
+/* Root describes the whole buffer to be scattered in src, other ranks
+   receive their own block into dst */
+#define SCATTER_BUF_INFO(_task)                                                \
+    (((_task)->args.root == (_task)->team->rank) ? &(_task)->args.src.info     \
+                                                  : &(_task)->args.dst.info)
+
+/* Size in bytes of the block delivered to every rank */
+static inline size_t ucc_tl_ucp_scatter_block_size(ucc_tl_ucp_task_t *task)
+{
+    ucc_coll_buffer_info_t *info  = SCATTER_BUF_INFO(task);
+    size_t                  count = info->count;
+
+    if (task->args.root == task->team->rank) {
+        count /= task->team->size;
+    }
+    return count * ucc_dt_size(info->datatype);
+}
+
+static inline int ucc_tl_ucp_scatter_alg_from_str(const char *str)
+{
+    int i;
+    for (i = 0; i < UCC_TL_UCP_SCATTER_ALG_LAST; i++) {
+        if (0 == strcasecmp(str, ucc_tl_ucp_scatter_algs[i].name)) {
+            break;
+        }
+    }
+    return i;
+}
+
+ucc_status_t ucc_tl_ucp_scatter_init(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_scatter_knomial_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t *     team,
+                                             ucc_coll_task_t **    task_h);
+
+ucc_status_t ucc_tl_ucp_scatter_linear_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t *     team,
+                                            ucc_coll_task_t **    task_h);
+#endif
@@ -0,0 +1,240 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "scatter.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+
+/* Knomial tree scatter
+   1. Uses the same tree as knomial gather: vrank (rank relative to root)
+      receives the blocks of its whole subtree [vrank, min(vrank + dist,
+      size)) from the parent at the first level "dist" where
+      (vrank / dist) % radix != 0, and forwards the blocks of the children
+      vrank + i * dist' at all lower levels dist' < dist.
+   2. Non leaf ranks receive the subtree into scratch and post the sends to
+      all children at once, leaf ranks receive their block directly into
+      dst. Root sends (radix - 1) * log_radix(size) messages instead of
+      size - 1.
+   3. Root 0 sends directly from src, any other root first rotates src into
+      vrank order in scratch.
+ */
+
+enum {
+    UCC_SCATTER_KN_PHASE_INIT,
+    UCC_SCATTER_KN_PHASE_RECV,
+    UCC_SCATTER_KN_PHASE_SEND
+};
+
+/* Returns the level at which vrank receives its subtree from the parent,
+   the value is not less than size for the root */
+static inline ucc_rank_t ucc_tl_ucp_scatter_kn_level(ucc_rank_t     vrank,
+                                                     ucc_rank_t     size,
+                                                     ucc_kn_radix_t radix)
+{
+    ucc_rank_t dist = 1;
+
+    while (dist < size && (vrank / dist) % radix == 0) {
+        dist *= radix;
+    }
+    return dist;
+}
+
+ucc_status_t ucc_tl_ucp_scatter_knomial_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = task->team;
+    ucc_rank_t         size     = team->size;
+    ucc_rank_t         root     = (ucc_rank_t)task->args.root;
+    ucc_rank_t         vrank    = (team->rank - root + size) % size;
+    ucc_kn_radix_t     radix    = task->scatter_kn.radix;
+    ucc_memory_type_t  mem_type = SCATTER_BUF_INFO(task)->mem_type;
+    size_t             bsize    = ucc_tl_ucp_scatter_block_size(task);
+    void              *scratch  = task->scatter_kn.scratch;
+    void              *sbuf;
+    ucc_rank_t         vpeer, peer, dist;
+    ucc_kn_radix_t     i;
+    ucc_status_t       status;
+
+    sbuf = scratch;
+    if (vrank == 0 && !scratch) {
+        sbuf = task->args.src.info.buffer;
+    }
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    switch (task->scatter_kn.phase) {
+    case UCC_SCATTER_KN_PHASE_RECV:
+        goto UCC_SCATTER_KN_PHASE_RECV;
+    case UCC_SCATTER_KN_PHASE_SEND:
+        goto completion;
+    default:
+        break;
+    }
+    dist = task->scatter_kn.dist;
+    if (vrank != 0) {
+        peer = (vrank - ((vrank / dist) % radix) * dist + root) % size;
+        UCPCHECK_GOTO(
+            ucc_tl_ucp_recv_nb(scratch ? scratch : task->args.dst.info.buffer,
+                               ucc_min(dist, size - vrank) * bsize, mem_type,
+                               peer, team, task),
+            task, out);
+    }
+    task->scatter_kn.phase = UCC_SCATTER_KN_PHASE_RECV;
+UCC_SCATTER_KN_PHASE_RECV:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    if (!sbuf) {
+        /* leaf: the block is already in dst */
+        goto completion;
+    }
+    for (dist = 1; dist < task->scatter_kn.dist; dist *= radix) {
+        for (i = 1; i < radix; i++) {
+            vpeer = vrank + i * dist;
+            if (vpeer >= size) {
+                break;
+            }
+            peer = (vpeer + root) % size;
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_send_nb(PTR_OFFSET(sbuf, (vpeer - vrank) * bsize),
+                                   ucc_min(dist, size - vpeer) * bsize,
+                                   mem_type, peer, team, task),
+                task, out);
+        }
+    }
+    /* own block is the first one of the subtree */
+    if (!(vrank == 0 && UCC_IS_INPLACE(task->args))) {
+        status = ucc_mc_memcpy(task->args.dst.info.buffer, sbuf, bsize,
+                               task->args.dst.info.mem_type, mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.super.status = status;
+            goto out;
+        }
+    }
+    task->scatter_kn.phase = UCC_SCATTER_KN_PHASE_SEND;
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+completion:
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scatter_kn_done", 0);
+out:
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_scatter_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = task->team;
+    ucc_rank_t         size     = team->size;
+    ucc_rank_t         root     = (ucc_rank_t)task->args.root;
+    ucc_memory_type_t  mem_type = SCATTER_BUF_INFO(task)->mem_type;
+    size_t             bsize    = ucc_tl_ucp_scatter_block_size(task);
+    void              *scratch  = task->scatter_kn.scratch;
+    void              *src      = task->args.src.info.buffer;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scatter_kn_start", 0);
+    if (team->rank == root && scratch) {
+        /* vrank v is rank (v + root) % size */
+        status = ucc_mc_memcpy(scratch, PTR_OFFSET(src, root * bsize),
+                               (size - root) * bsize, mem_type, mem_type);
+        if (ucc_likely(UCC_OK == status)) {
+            status = ucc_mc_memcpy(PTR_OFFSET(scratch, (size - root) * bsize),
+                                   src, root * bsize, mem_type, mem_type);
+        }
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    task->scatter_kn.phase = UCC_SCATTER_KN_PHASE_INIT;
+    ucc_tl_ucp_task_reset(task);
+    status = ucc_tl_ucp_scatter_knomial_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_scatter_knomial_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    if (task->scatter_kn.scratch_mc_header) {
+        ucc_mc_free(task->scatter_kn.scratch_mc_header);
+    }
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_scatter_knomial_init_common(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team  = task->team;
+    ucc_rank_t         size  = team->size;
+    ucc_rank_t         root  = (ucc_rank_t)task->args.root;
+    ucc_rank_t         vrank = (team->rank - root + size) % size;
+    ucc_kn_radix_t     radix;
+    size_t             data_size;
+    ucc_status_t       status;
+
+    radix = ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.scatter_kn_radix, size);
+    radix = ucc_max(radix, 2);
+
+    task->super.post                   = ucc_tl_ucp_scatter_knomial_start;
+    task->super.progress               = ucc_tl_ucp_scatter_knomial_progress;
+    task->super.finalize               = ucc_tl_ucp_scatter_knomial_finalize;
+    task->scatter_kn.radix             = radix;
+    task->scatter_kn.dist              =
+        ucc_tl_ucp_scatter_kn_level(vrank, size, radix);
+    task->scatter_kn.scratch_mc_header = NULL;
+    task->scatter_kn.scratch           = NULL;
+
+    if (vrank == 0) {
+        /* root 0 sends directly from src */
+        data_size = (root == 0) ? 0 : size;
+    } else if (task->scatter_kn.dist > 1 && vrank + 1 < size) {
+        data_size = ucc_min(task->scatter_kn.dist, size - vrank);
+    } else {
+        /* leaf receives directly into dst */
+        data_size = 0;
+    }
+    if (data_size > 0) {
+        data_size *= ucc_tl_ucp_scatter_block_size(task);
+        status = ucc_mc_alloc(&task->scatter_kn.scratch_mc_header, data_size,
+                              SCATTER_BUF_INFO(task)->mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TL_TEAM_LIB(team), "failed to allocate scratch buffer");
+            return status;
+        }
+        task->scatter_kn.scratch = task->scatter_kn.scratch_mc_header->addr;
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_scatter_knomial_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t      *team,
+                                             ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    SCATTER_TASK_CHECK(coll_args->args, tl_team);
+    task   = ucc_tl_ucp_init_task(coll_args, team);
+    status = ucc_tl_ucp_scatter_knomial_init_common(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        goto out;
+    }
+    *task_h = &task->super;
+out:
+    return status;
+}
@@ -0,0 +1,113 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "scatter.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_mc.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+
+/* Linear scatter: root sends every block directly to its destination
+   rank keeping at most SCATTER_LINEAR_NUM_POSTS sends outstanding
+   (0 - no limit). */
+
+ucc_status_t ucc_tl_ucp_scatter_linear_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = task->team;
+    ucc_rank_t         size     = team->size;
+    ucc_rank_t         root     = (ucc_rank_t)task->args.root;
+    ucc_rank_t         npeers   = size - 1;
+    ucc_memory_type_t  mem_type = SCATTER_BUF_INFO(task)->mem_type;
+    size_t             bsize    = ucc_tl_ucp_scatter_block_size(task);
+    uint32_t           posts, nreqs;
+    ucc_rank_t         peer;
+
+    if (team->rank != root) {
+        if (task->recv_posted == 0) {
+            UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(task->args.dst.info.buffer, bsize,
+                                             mem_type, root, team, task),
+                          task, out);
+        }
+        goto test;
+    }
+    posts = UCC_TL_UCP_TEAM_LIB(team)->cfg.scatter_linear_num_posts;
+    nreqs = (posts > npeers || posts == 0) ? npeers : posts;
+    while (task->send_posted < npeers) {
+        while ((task->send_posted < npeers) &&
+               ((task->send_posted - task->send_completed) < nreqs)) {
+            peer = (root + 1 + task->send_posted) % size;
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_send_nb(PTR_OFFSET(task->args.src.info.buffer,
+                                              peer * bsize),
+                                   bsize, mem_type, peer, team, task),
+                task, out);
+        }
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task) &&
+            (task->send_posted - task->send_completed) == nreqs) {
+            return task->super.super.status;
+        }
+    }
+test:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return task->super.super.status;
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scatter_linear_done", 0);
+out:
+    return task->super.super.status;
+}
+
+ucc_status_t ucc_tl_ucp_scatter_linear_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = task->team;
+    ucc_rank_t         root = (ucc_rank_t)task->args.root;
+    ucc_memory_type_t  mem_type;
+    size_t             bsize;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scatter_linear_start", 0);
+    if (team->rank == root && !UCC_IS_INPLACE(task->args)) {
+        mem_type = task->args.src.info.mem_type;
+        bsize    = ucc_tl_ucp_scatter_block_size(task);
+        status   = ucc_mc_memcpy(
+            task->args.dst.info.buffer,
+            PTR_OFFSET(task->args.src.info.buffer, root * bsize), bsize,
+            mem_type, mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    ucc_tl_ucp_task_reset(task);
+    status = ucc_tl_ucp_scatter_linear_progress(&task->super);
+    if (UCC_INPROGRESS == status) {
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_scatter_linear_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *team,
+                                            ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    SCATTER_TASK_CHECK(coll_args->args, tl_team);
+    task                 = ucc_tl_ucp_init_task(coll_args, team);
+    task->super.post     = ucc_tl_ucp_scatter_linear_start;
+    task->super.progress = ucc_tl_ucp_scatter_linear_progress;
+    *task_h              = &task->super;
+    status               = UCC_OK;
+out:
+    return status;
+}
@@ -9,6 +9,13 @@
 #include "core/ucc_mc.h"
 #include "components/mc/base/ucc_mc_base.h"
 #include "allreduce/allreduce.h"
+#include "allgather/allgather.h"
+#include "alltoall/alltoall.h"
+#include "bcast/bcast.h"
+#include "reduce/reduce.h"
+#include "gather/gather.h"
+#include "scatter/scatter.h"
+#include "reduce_scatter/reduce_scatter.h"
 
 ucc_status_t ucc_tl_ucp_get_lib_attr(const ucc_base_lib_t *lib,
                                      ucc_base_lib_attr_t  *base_attr);
@@ -31,6 +38,30 @@ static ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, alltoallv_pairwise_num_posts),
      UCC_CONFIG_TYPE_UINT},
 
+    {"GATHER_LINEAR_NUM_POSTS", "16",
+     "Maximum number of outstanding receives posted by root in gather linear "
+     "algorithm, 0 - no limit",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, gather_linear_num_posts),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"GATHERV_LINEAR_NUM_POSTS", "16",
+     "Maximum number of outstanding receives posted by root in gatherv "
+     "linear algorithm, 0 - no limit",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, gatherv_linear_num_posts),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"SCATTER_LINEAR_NUM_POSTS", "16",
+     "Maximum number of outstanding sends posted by root in scatter linear "
+     "algorithm, 0 - no limit",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, scatter_linear_num_posts),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"SCATTERV_LINEAR_NUM_POSTS", "16",
+     "Maximum number of outstanding sends posted by root in scatterv "
+     "linear algorithm, 0 - no limit",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, scatterv_linear_num_posts),
+     UCC_CONFIG_TYPE_UINT},
+
     {"KN_RADIX", "0",
      "Radix of all algorithms based on knomial pattern. When set to a "
      "positive value it is used as a convinience parameter to set all "
@@ -52,6 +83,19 @@ static ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sra_kn_radix),
      UCC_CONFIG_TYPE_UINT},
 
+    {"ALLREDUCE_SRA_KN_FRAG_SIZE", "inf",
+     "Fragment size of the pipelined SRA knomial allreduce. Messages larger "
+     "than the fragment size are split into fragments so that reduction of "
+     "one fragment overlaps with the data exchange of the others",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sra_kn_frag_size),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"ALLREDUCE_SRA_KN_PIPELINE_DEPTH", "2",
+     "Number of fragments of the pipelined SRA knomial allreduce progressed "
+     "concurrently (max 4)",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sra_kn_pipeline_depth),
+     UCC_CONFIG_TYPE_UINT},
+
     {"REDUCE_SCATTER_KN_RADIX", "4",
      "Radix of the knomial reduce-scatter algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_scatter_kn_radix),
@@ -65,6 +109,42 @@ static ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, bcast_kn_radix),
      UCC_CONFIG_TYPE_UINT},
 
+    {"BCAST_SAG_KN_RADIX", "4",
+     "Radix of the scatter-allgather (SAG) knomial bcast algorithm",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, bcast_sag_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"REDUCE_KN_RADIX", "4", "Radix of the knomial tree reduce algorithm",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"REDUCE_CHAIN_FRAG_SIZE", "64k",
+     "Fragment size of the pipelined chain reduce algorithm",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_chain_frag_size),
+     UCC_CONFIG_TYPE_MEMUNITS},
+
+    {"REDUCE_CHAIN_PIPELINE_DEPTH", "2",
+     "Number of fragments of the pipelined chain reduce progressed "
+     "concurrently (max 4)",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_chain_pipeline_depth),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"GATHER_KN_RADIX", "4", "Radix of the knomial tree gather algorithm",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, gather_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"SCATTER_KN_RADIX", "4", "Radix of the knomial tree scatter algorithm",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, scatter_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"AUTOTUNE", "0",
+     "Number of timed invocations of every candidate algorithm and radix "
+     "per collective, memory type and message size bucket (power of 2) "
+     "before the fastest one is selected for the team. Applies to "
+     "allreduce, allgather, alltoall, bcast and reduce_scatter. "
+     "0 - autotuning is disabled",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, autotune), UCC_CONFIG_TYPE_UINT},
+
     {NULL}};
 
 static ucs_config_field_t ucc_tl_ucp_context_config_table[] = {
@@ -187,4 +267,18 @@ __attribute__((constructor)) static void tl_ucp_iface_init(void)
     ucc_tl_ucp.super.scoll.update_id = ucc_tl_ucp_service_update_id;
     ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_ALLREDUCE)] =
         ucc_tl_ucp_allreduce_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_ALLGATHER)] =
+        ucc_tl_ucp_allgather_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_ALLTOALL)] =
+        ucc_tl_ucp_alltoall_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_BCAST)] =
+        ucc_tl_ucp_bcast_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_REDUCE)] =
+        ucc_tl_ucp_reduce_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_GATHER)] =
+        ucc_tl_ucp_gather_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_SCATTER)] =
+        ucc_tl_ucp_scatter_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_REDUCE_SCATTER)] =
+        ucc_tl_ucp_reduce_scatter_algs;
 }
@@ -41,11 +41,24 @@ typedef struct ucc_tl_ucp_lib_config {
     uint32_t            barrier_kn_radix;
     uint32_t            allreduce_kn_radix;
     uint32_t            allreduce_sra_kn_radix;
+    size_t              allreduce_sra_kn_frag_size;
+    uint32_t            allreduce_sra_kn_pipeline_depth;
     uint32_t            reduce_scatter_kn_radix;
     uint32_t            allgather_kn_radix;
     uint32_t            bcast_kn_radix;
+    uint32_t            bcast_sag_kn_radix;
+    uint32_t            reduce_kn_radix;
+    size_t              reduce_chain_frag_size;
+    uint32_t            reduce_chain_pipeline_depth;
+    uint32_t            gather_kn_radix;
+    uint32_t            scatter_kn_radix;
     uint32_t            alltoall_pairwise_num_posts;
     uint32_t            alltoallv_pairwise_num_posts;
+    uint32_t            gather_linear_num_posts;
+    uint32_t            gatherv_linear_num_posts;
+    uint32_t            scatter_linear_num_posts;
+    uint32_t            scatterv_linear_num_posts;
+    uint32_t            autotune;
 } ucc_tl_ucp_lib_config_t;
 
 typedef struct ucc_tl_ucp_context_config {
@@ -82,25 +95,33 @@ UCC_CLASS_DECLARE(ucc_tl_ucp_context_t, const ucc_base_context_params_t *,
                   const ucc_base_config_t *);
 
 typedef struct ucc_tl_ucp_task ucc_tl_ucp_task_t;
+typedef struct ucc_tl_ucp_tune ucc_tl_ucp_tune_t;
 typedef struct ucc_tl_ucp_team {
     ucc_tl_team_t              super;
     ucc_status_t               status;
     ucc_rank_t                 size;
     ucc_rank_t                 rank;
+    ucc_ep_map_t               map; /* team rank -> core team rank */
     uint32_t                   id;
     uint32_t                   scope;
     uint32_t                   scope_id;
     uint32_t                   seq_num;
+    uint32_t                   max_coll_tag; /* seq_num wraps around it */
     ucc_tl_ucp_task_t         *preconnect_task;
+    ucc_tl_ucp_tune_t         *tune; /* NULL if autotuning is disabled */
+    uint32_t                   tune_radix; /* set by autotuner during init */
 } ucc_tl_ucp_team_t;
 UCC_CLASS_DECLARE(ucc_tl_ucp_team_t, ucc_base_context_t *,
                   const ucc_base_team_params_t *);
 
-#define UCC_TL_UCP_SUPPORTED_COLLS                         \
-    (UCC_COLL_TYPE_ALLTOALL  | UCC_COLL_TYPE_ALLTOALLV  |  \
-     UCC_COLL_TYPE_ALLGATHER | UCC_COLL_TYPE_ALLGATHERV |  \
-     UCC_COLL_TYPE_ALLREDUCE | UCC_COLL_TYPE_BCAST      |  \
-     UCC_COLL_TYPE_BARRIER)
+#define UCC_TL_UCP_SUPPORTED_COLLS                                \
+    (UCC_COLL_TYPE_ALLTOALL       | UCC_COLL_TYPE_ALLTOALLV       |  \
+     UCC_COLL_TYPE_ALLGATHER      | UCC_COLL_TYPE_ALLGATHERV      |  \
+     UCC_COLL_TYPE_ALLREDUCE      | UCC_COLL_TYPE_BCAST           |  \
+     UCC_COLL_TYPE_BARRIER        | UCC_COLL_TYPE_REDUCE          |  \
+     UCC_COLL_TYPE_GATHER         | UCC_COLL_TYPE_GATHERV         |  \
+     UCC_COLL_TYPE_SCATTER        | UCC_COLL_TYPE_SCATTERV        |  \
+     UCC_COLL_TYPE_REDUCE_SCATTER | UCC_COLL_TYPE_REDUCE_SCATTERV)
 
 #define UCC_TL_UCP_TEAM_LIB(_team)                                             \
     (ucc_derived_of((_team)->super.super.context->lib, ucc_tl_ucp_lib_t))
@@ -108,6 +129,12 @@ UCC_CLASS_DECLARE(ucc_tl_ucp_team_t, ucc_base_context_t *,
 #define UCC_TL_UCP_TEAM_CTX(_team)                                             \
     (ucc_derived_of((_team)->super.super.context, ucc_tl_ucp_context_t))
 
+/* Radix of a knomial algorithm: the lib config value unless the autotuner
+   forces a candidate radix for the collective being initialized */
+#define UCC_TL_UCP_TEAM_KN_RADIX(_team, _cfg_radix)                            \
+    ((_team)->tune_radix ? (_team)->tune_radix                                 \
+                         : UCC_TL_UCP_TEAM_LIB(_team)->cfg._cfg_radix)
+
 #define UCC_TL_UCP_WORKER(_team) UCC_TL_UCP_TEAM_CTX(_team)->ucp_worker
 
 #define UCC_TL_CTX_HAS_OOB(_ctx) ((_ctx)->super.super.ucc_context->params.mask & \
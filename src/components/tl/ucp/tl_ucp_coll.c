@@ -15,9 +15,23 @@
 #include "allgather/allgather.h"
 #include "allgatherv/allgatherv.h"
 #include "bcast/bcast.h"
+#include "reduce/reduce.h"
+#include "gather/gather.h"
+#include "gatherv/gatherv.h"
+#include "scatter/scatter.h"
+#include "scatterv/scatterv.h"
+#include "reduce_scatter/reduce_scatter.h"
+#include "reduce_scatterv/reduce_scatterv.h"
 const char
     *ucc_tl_ucp_default_alg_select_str[UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR] = {
-        UCC_TL_UCP_ALLREDUCE_DEFAULT_ALG_SELECT_STR};
+        UCC_TL_UCP_ALLREDUCE_DEFAULT_ALG_SELECT_STR,
+        UCC_TL_UCP_ALLGATHER_DEFAULT_ALG_SELECT_STR,
+        UCC_TL_UCP_ALLTOALL_DEFAULT_ALG_SELECT_STR,
+        UCC_TL_UCP_BCAST_DEFAULT_ALG_SELECT_STR,
+        UCC_TL_UCP_REDUCE_DEFAULT_ALG_SELECT_STR,
+        UCC_TL_UCP_GATHER_DEFAULT_ALG_SELECT_STR,
+        UCC_TL_UCP_SCATTER_DEFAULT_ALG_SELECT_STR,
+        UCC_TL_UCP_REDUCE_SCATTER_DEFAULT_ALG_SELECT_STR};
 
 void ucc_tl_ucp_send_completion_cb(void *request, ucs_status_t status,
                                    void *user_data)
@@ -29,6 +43,7 @@ void ucc_tl_ucp_send_completion_cb(void *request, ucs_status_t status,
         task->super.super.status = ucs_status_to_ucc_status(status);
     }
     task->send_completed++;
+    ucc_coll_task_set_runnable(&task->super);
     ucp_request_free(request);
 }
 
@@ -43,6 +58,7 @@ void ucc_tl_ucp_recv_completion_cb(void *request, ucs_status_t status,
         task->super.super.status = ucs_status_to_ucc_status(status);
     }
     task->recv_completed++;
+    ucc_coll_task_set_runnable(&task->super);
     ucp_request_free(request);
 }
 
@@ -219,6 +235,27 @@ ucc_status_t ucc_tl_ucp_coll_init(ucc_base_coll_args_t *coll_args,
     case UCC_COLL_TYPE_BCAST:
         status = ucc_tl_ucp_bcast_init(task);
         break;
+    case UCC_COLL_TYPE_REDUCE:
+        status = ucc_tl_ucp_reduce_init(task);
+        break;
+    case UCC_COLL_TYPE_GATHER:
+        status = ucc_tl_ucp_gather_init(task);
+        break;
+    case UCC_COLL_TYPE_GATHERV:
+        status = ucc_tl_ucp_gatherv_init(task);
+        break;
+    case UCC_COLL_TYPE_SCATTER:
+        status = ucc_tl_ucp_scatter_init(task);
+        break;
+    case UCC_COLL_TYPE_SCATTERV:
+        status = ucc_tl_ucp_scatterv_init(task);
+        break;
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        status = ucc_tl_ucp_reduce_scatter_init(task);
+        break;
+    case UCC_COLL_TYPE_REDUCE_SCATTERV:
+        status = ucc_tl_ucp_reduce_scatterv_init(task);
+        break;
     default:
         status = UCC_ERR_NOT_SUPPORTED;
     }
@@ -236,6 +273,20 @@ static inline int alg_id_from_str(ucc_coll_type_t coll_type, const char *str)
     switch (coll_type) {
     case UCC_COLL_TYPE_ALLREDUCE:
         return ucc_tl_ucp_allreduce_alg_from_str(str);
+    case UCC_COLL_TYPE_ALLGATHER:
+        return ucc_tl_ucp_allgather_alg_from_str(str);
+    case UCC_COLL_TYPE_ALLTOALL:
+        return ucc_tl_ucp_alltoall_alg_from_str(str);
+    case UCC_COLL_TYPE_BCAST:
+        return ucc_tl_ucp_bcast_alg_from_str(str);
+    case UCC_COLL_TYPE_REDUCE:
+        return ucc_tl_ucp_reduce_alg_from_str(str);
+    case UCC_COLL_TYPE_GATHER:
+        return ucc_tl_ucp_gather_alg_from_str(str);
+    case UCC_COLL_TYPE_SCATTER:
+        return ucc_tl_ucp_scatter_alg_from_str(str);
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        return ucc_tl_ucp_reduce_scatter_alg_from_str(str);
     default:
         break;
     }
@@ -261,6 +312,103 @@ ucc_status_t ucc_tl_ucp_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_TL_UCP_ALLREDUCE_ALG_SRA_KNOMIAL:
             *init = ucc_tl_ucp_allreduce_sra_knomial_init;
             break;
+        case UCC_TL_UCP_ALLREDUCE_ALG_RING:
+            *init = ucc_tl_ucp_allreduce_ring_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_ALLGATHER:
+        switch (alg_id) {
+        case UCC_TL_UCP_ALLGATHER_ALG_RING:
+            *init = ucc_tl_ucp_allgather_ring_init;
+            break;
+        case UCC_TL_UCP_ALLGATHER_ALG_BRUCK:
+            *init = ucc_tl_ucp_allgather_bruck_init;
+            break;
+        case UCC_TL_UCP_ALLGATHER_ALG_RECURSIVE_DOUBLING:
+            *init = ucc_tl_ucp_allgather_recursive_doubling_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_ALLTOALL:
+        switch (alg_id) {
+        case UCC_TL_UCP_ALLTOALL_ALG_PAIRWISE:
+            *init = ucc_tl_ucp_alltoall_pairwise_init;
+            break;
+        case UCC_TL_UCP_ALLTOALL_ALG_BRUCK:
+            *init = ucc_tl_ucp_alltoall_bruck_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_BCAST:
+        switch (alg_id) {
+        case UCC_TL_UCP_BCAST_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_bcast_knomial_init;
+            break;
+        case UCC_TL_UCP_BCAST_ALG_SAG_KNOMIAL:
+            *init = ucc_tl_ucp_bcast_sag_knomial_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_REDUCE:
+        switch (alg_id) {
+        case UCC_TL_UCP_REDUCE_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_reduce_knomial_init;
+            break;
+        case UCC_TL_UCP_REDUCE_ALG_CHAIN:
+            *init = ucc_tl_ucp_reduce_chain_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_GATHER:
+        switch (alg_id) {
+        case UCC_TL_UCP_GATHER_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_gather_knomial_init;
+            break;
+        case UCC_TL_UCP_GATHER_ALG_LINEAR:
+            *init = ucc_tl_ucp_gather_linear_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_SCATTER:
+        switch (alg_id) {
+        case UCC_TL_UCP_SCATTER_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_scatter_knomial_init;
+            break;
+        case UCC_TL_UCP_SCATTER_ALG_LINEAR:
+            *init = ucc_tl_ucp_scatter_linear_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        switch (alg_id) {
+        case UCC_TL_UCP_REDUCE_SCATTER_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_reduce_scatter_knomial_init;
+            break;
+        case UCC_TL_UCP_REDUCE_SCATTER_ALG_RING:
+            *init = ucc_tl_ucp_reduce_scatter_ring_init;
+            break;
         default:
             status = UCC_ERR_INVALID_PARAM;
             break;
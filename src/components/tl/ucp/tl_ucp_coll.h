@@ -13,7 +13,7 @@
 #include "components/mc/base/ucc_mc_base.h"
 #include "tl_ucp_tag.h"
 
-#define UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR 1
+#define UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR 8
 extern const char
     *ucc_tl_ucp_default_alg_select_str[UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR];
 
@@ -36,23 +36,88 @@ typedef struct ucc_tl_ucp_task {
         struct {
             int                     phase;
             ucc_knomial_pattern_t   p;
+            ucc_kn_radix_t          radix;
             void                   *scratch;
             ucc_mc_buffer_header_t *scratch_mc_header;
+            ucc_mc_req_t           *reduce_req;
         } allreduce_kn;
         struct {
             int                     phase;
             ucc_knomial_pattern_t   p;
             void                   *scratch;
             ucc_mc_buffer_header_t *scratch_mc_header;
+            ucc_mc_req_t           *mc_req; /* reduction or copy */
         } reduce_scatter_kn;
+        struct {
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+            ucc_kn_radix_t          radix;
+            ucc_rank_t              block; /* next block to pack */
+            ucc_mc_req_t           *mc_req;
+        } reduce_scatter_kn_layout;
+        struct {
+            void                   *scratch;
+            void                   *reduce_scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } reduce_scatter_ring;
         struct {
             int                     phase;
             ucc_knomial_pattern_t   p;
+            void                   *sbuf;
         } allgather_kn;
+        struct {
+            size_t                  count;
+        } allgather_ring;
+        struct {
+            ucc_rank_t              dist;
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } allgather_bruck;
+        struct {
+            ucc_rank_t              dist;
+        } allgather_rd;
+        struct {
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+            ucc_rank_t              n_packed;
+        } alltoall_bruck;
         struct {
             ucc_rank_t              dist;
             uint32_t                radix;
         } bcast_kn;
+        struct {
+            int                     phase;
+            ucc_knomial_pattern_t   p;
+            ucc_kn_radix_t          radix;
+            ucc_rank_t              loop_root;
+        } bcast_sag_kn;
+        struct {
+            int                     phase;
+            ucc_rank_t              dist;
+            ucc_kn_radix_t          radix;
+            uint32_t                children_per_cycle;
+            int                     reduced;
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } reduce_kn;
+        struct {
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } reduce_chain;
+        struct {
+            int                     phase;
+            ucc_rank_t              dist;
+            ucc_kn_radix_t          radix;
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } gather_kn;
+        struct {
+            int                     phase;
+            ucc_rank_t              dist;
+            ucc_kn_radix_t          radix;
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } scatter_kn;
     };
 } ucc_tl_ucp_task_t;
 
@@ -77,6 +142,17 @@ static inline ucc_tl_ucp_task_t *ucc_tl_ucp_get_task(ucc_tl_ucp_team_t *team)
     return task;
 }
 
+/* Brings the task back to the initial state before it is (re)posted:
+   a persistent task is started many times after a single init */
+static inline void ucc_tl_ucp_task_reset(ucc_tl_ucp_task_t *task)
+{
+    task->send_posted        = 0;
+    task->send_completed     = 0;
+    task->recv_posted        = 0;
+    task->recv_completed     = 0;
+    task->super.super.status = UCC_INPROGRESS;
+}
+
 static inline void ucc_tl_ucp_put_task(ucc_tl_ucp_task_t *task)
 {
     UCC_TL_UCP_PROFILE_REQUEST_FREE(task);
@@ -118,9 +194,15 @@ ucc_tl_ucp_init_task(ucc_base_coll_args_t *coll_args, ucc_base_team_t *team)
     memcpy(&task->args, &coll_args->args, sizeof(ucc_coll_args_t));
     task->team           = tl_team;
     task->tag            = tl_team->seq_num;
-    tl_team->seq_num     = (tl_team->seq_num + 1) % UCC_TL_UCP_MAX_COLL_TAG;
+    tl_team->seq_num     = (tl_team->seq_num + 1) % tl_team->max_coll_tag;
     task->super.finalize = ucc_tl_ucp_coll_finalize;
     task->super.triggered_post = ucc_tl_ucp_triggered_post;
+    if (UCC_TL_CORE_CTX(tl_team)->event_driven_progress) {
+        /* ucp worker is progressed by the context, the task is progressed
+           by the queue only after its send/recv completion callbacks */
+        task->super.flags |= UCC_COLL_TASK_FLAG_EVENT_DRIVEN;
+        task->n_polls      = 0;
+    }
     return task;
 }
 
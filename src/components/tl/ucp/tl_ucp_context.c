@@ -8,6 +8,7 @@
 #include "tl_ucp_tag.h"
 #include "tl_ucp_coll.h"
 #include "tl_ucp_ep.h"
+#include "tl_ucp_tune.h"
 #include "utils/ucc_math.h"
 #include <limits.h>
 
@@ -108,7 +109,7 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
 
     ucc_status = ucc_mpool_init(
         &self->req_mp, 0,
-        ucc_max(sizeof(ucc_tl_ucp_task_t), sizeof(ucc_schedule_t)), 0,
+        ucc_max(sizeof(ucc_tl_ucp_task_t), sizeof(ucc_tl_ucp_tune_task_t)), 0,
         UCC_CACHE_LINE_SIZE, 8, UINT_MAX, &ucc_tl_ucp_req_mpool_ops,
         params->thread_mode, "tl_ucp_req_mp");
     if (UCC_OK != ucc_status) {
@@ -9,11 +9,13 @@
 #include "tl_ucp_tag.h"
 #include "allreduce/allreduce.h"
 
-ucc_status_t ucc_tl_ucp_service_allreduce(ucc_base_team_t *team, void *sbuf,
-                                          void *rbuf, ucc_datatype_t dt,
-                                          size_t count, ucc_reduction_op_t op,
-                                          ucc_tl_team_subset_t subset,
-                                          ucc_coll_task_t **task_p)
+ucc_status_t ucc_tl_ucp_service_allreduce_tag(ucc_base_team_t *team,
+                                              void *sbuf, void *rbuf,
+                                              ucc_datatype_t dt, size_t count,
+                                              ucc_reduction_op_t op,
+                                              ucc_tl_team_subset_t subset,
+                                              uint32_t tag,
+                                              ucc_coll_task_t **task_p)
 {
     ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
     ucc_tl_ucp_task_t *task    = ucc_tl_ucp_get_task(tl_team);
@@ -41,7 +43,7 @@ ucc_status_t ucc_tl_ucp_service_allreduce(ucc_base_team_t *team, void *sbuf,
     }
     task->subset = subset;
     task->team = tl_team;
-    task->tag  = UCC_TL_UCP_SERVICE_TAG;
+    task->tag  = tag;
     task->n_polls = 10; // TODO need a var ?
     task->super.progress = ucc_tl_ucp_allreduce_knomial_progress;
     memcpy(&task->args, &args, sizeof(ucc_coll_args_t));
@@ -63,15 +65,26 @@ free_task:
     return status;
 }
 
+ucc_status_t ucc_tl_ucp_service_allreduce(ucc_base_team_t *team, void *sbuf,
+                                          void *rbuf, ucc_datatype_t dt,
+                                          size_t count, ucc_reduction_op_t op,
+                                          ucc_tl_team_subset_t subset,
+                                          ucc_coll_task_t **task_p)
+{
+    return ucc_tl_ucp_service_allreduce_tag(team, sbuf, rbuf, dt, count, op,
+                                            subset, UCC_TL_UCP_SERVICE_TAG,
+                                            task_p);
+}
+
 ucc_status_t ucc_tl_ucp_service_test(ucc_coll_task_t *task)
 {
     return task->super.status;
 }
 
 
-void ucc_tl_ucp_service_cleanup(ucc_coll_task_t *task)
+ucc_status_t ucc_tl_ucp_service_cleanup(ucc_coll_task_t *task)
 {
-    ucc_tl_ucp_allreduce_knomial_finalize(task);
+    return ucc_tl_ucp_allreduce_knomial_finalize(task);
 }
 
 void ucc_tl_ucp_service_update_id(ucc_base_team_t *team, uint16_t id) {
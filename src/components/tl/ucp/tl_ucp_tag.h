@@ -40,6 +40,12 @@
 #define UCC_TL_UCP_RESERVED_TAGS 8
 #define UCC_TL_UCP_MAX_COLL_TAG  (UCC_TL_UCP_MAX_TAG - UCC_TL_UCP_RESERVED_TAGS)
 #define UCC_TL_UCP_SERVICE_TAG   (UCC_TL_UCP_MAX_COLL_TAG + 1)
+/* one tag per autotuner bucket: agreements of different buckets may run
+   concurrently and complete in a different order on different ranks. The
+   block is taken from the top of the collective tags only by the teams
+   with autotuning enabled, see ucc_tl_ucp_team_t::max_coll_tag */
+#define UCC_TL_UCP_TUNE_TAGS     2048
+#define UCC_TL_UCP_TUNE_TAG      (UCC_TL_UCP_MAX_COLL_TAG - UCC_TL_UCP_TUNE_TAGS)
 #define UCC_TL_UCP_MAX_SENDER    UCC_MASK(UCC_TL_UCP_SENDER_BITS)
 #define UCC_TL_UCP_MAX_ID        UCC_MASK(UCC_TL_UCP_ID_BITS)
 
@@ -8,6 +8,7 @@
 #include "tl_ucp_ep.h"
 #include "tl_ucp_coll.h"
 #include "tl_ucp_sendrecv.h"
+#include "tl_ucp_tune.h"
 #include "utils/ucc_malloc.h"
 #include "coll_score/ucc_coll_score.h"
 
@@ -16,24 +17,43 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_team_t, ucc_base_context_t *tl_context,
 {
     ucc_tl_ucp_context_t *ctx =
         ucc_derived_of(tl_context, ucc_tl_ucp_context_t);
+    ucc_status_t          status;
+
     UCC_CLASS_CALL_SUPER_INIT(ucc_tl_team_t, &ctx->super, params->team);
     /* TODO: init based on ctx settings and on params: need to check
              if all the necessary ranks mappings are provided */
     self->preconnect_task    = NULL;
-    self->size               = params->params.oob.participants;
+    self->size               = params->size;
+    self->map                = params->map;
     self->scope              = params->scope;
     self->scope_id           = params->scope_id;
     self->rank               = params->rank;
     self->id                 = params->id;
     self->seq_num            = 0;
+    self->max_coll_tag       = UCC_TL_UCP_MAX_COLL_TAG;
     self->status             = UCC_INPROGRESS;
+    status = ucc_tl_ucp_tune_init(self);
+    if (UCC_OK != status) {
+        return status;
+    }
     tl_info(tl_context->lib, "posted tl team: %p", self);
     return UCC_OK;
 }
 
 UCC_CLASS_CLEANUP_FUNC(ucc_tl_ucp_team_t)
 {
+    char tune_str[UCC_TL_UCP_TUNE_STR_MAX_LEN];
+
     tl_info(self->super.super.context->lib, "finalizing tl team: %p", self);
+    if (self->tune) {
+        if (0 == self->rank &&
+            UCC_OK == ucc_tl_ucp_tune_dump(self, tune_str, sizeof(tune_str)) &&
+            strlen(tune_str) > 0) {
+            tl_info(self->super.super.context->lib,
+                    "autotuned TUNE string: %s", tune_str);
+        }
+        ucc_tl_ucp_tune_cleanup(self);
+    }
 }
 
 UCC_CLASS_DEFINE_DELETE_FUNC(ucc_tl_ucp_team_t, ucc_base_team_t);
@@ -106,6 +126,24 @@ err_preconnect:
     return status;
 }
 
+/* Ranges of the tuned coll_types go through the autotuner, the user
+   provided TUNE string applied afterwards still takes precedence */
+static void ucc_tl_ucp_team_set_tune_init(ucc_coll_score_t *score)
+{
+    uint64_t         colls = ucc_tl_ucp_tune_colls();
+    ucc_msg_range_t *range;
+    uint64_t         c;
+    int              m;
+
+    ucc_for_each_bit(c, colls) {
+        for (m = 0; m < UCC_MEMORY_TYPE_LAST; m++) {
+            ucc_list_for_each(range, &score->scores[c][m], list_elem) {
+                range->init = ucc_tl_ucp_tune_coll_init;
+            }
+        }
+    }
+}
+
 ucc_status_t ucc_tl_ucp_team_get_scores(ucc_base_team_t   *tl_team,
                                         ucc_coll_score_t **score_p)
 {
@@ -134,6 +172,9 @@ ucc_status_t ucc_tl_ucp_team_get_scores(ucc_base_team_t   *tl_team,
             goto err;
         }
     }
+    if (team->tune) {
+        ucc_tl_ucp_team_set_tune_init(score);
+    }
     if (strlen(lib->super.super.score_str) > 0) {
         status = ucc_coll_score_update_from_str(
             lib->super.super.score_str, score, team->size, NULL,
@@ -0,0 +1,628 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "tl_ucp_tune.h"
+#include "tl_ucp_coll.h"
+#include "core/ucc_progress_queue.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_coll_utils.h"
+#include "utils/ucc_string.h"
+#include "allreduce/allreduce.h"
+#include "allgather/allgather.h"
+#include "alltoall/alltoall.h"
+#include "bcast/bcast.h"
+#include "reduce_scatter/reduce_scatter.h"
+#include <float.h>
+
+ucc_status_t ucc_tl_ucp_service_allreduce_tag(ucc_base_team_t *team,
+                                              void *sbuf, void *rbuf,
+                                              ucc_datatype_t dt, size_t count,
+                                              ucc_reduction_op_t op,
+                                              ucc_tl_team_subset_t subset,
+                                              uint32_t tag,
+                                              ucc_coll_task_t **task);
+
+ucc_status_t ucc_tl_ucp_service_test(ucc_coll_task_t *task);
+
+ucc_status_t ucc_tl_ucp_service_cleanup(ucc_coll_task_t *task);
+
+typedef struct ucc_tl_ucp_tune_alg {
+    ucc_coll_type_t coll_type;
+    int             alg_id;
+    int             has_radix;
+} ucc_tl_ucp_tune_alg_t;
+
+/* Collectives with the msgsize known to all the ranks: required to select
+   the same bucket everywhere w/o communication */
+static const ucc_coll_type_t
+    ucc_tl_ucp_tune_coll_types[UCC_TL_UCP_TUNE_N_COLLS] = {
+        UCC_COLL_TYPE_ALLREDUCE, UCC_COLL_TYPE_ALLGATHER,
+        UCC_COLL_TYPE_ALLTOALL,  UCC_COLL_TYPE_BCAST,
+        UCC_COLL_TYPE_REDUCE_SCATTER};
+
+static const ucc_tl_ucp_tune_alg_t ucc_tl_ucp_tune_algs[] = {
+    {UCC_COLL_TYPE_ALLREDUCE, UCC_TL_UCP_ALLREDUCE_ALG_KNOMIAL, 1},
+    {UCC_COLL_TYPE_ALLREDUCE, UCC_TL_UCP_ALLREDUCE_ALG_SRA_KNOMIAL, 1},
+    {UCC_COLL_TYPE_ALLREDUCE, UCC_TL_UCP_ALLREDUCE_ALG_RING, 0},
+    {UCC_COLL_TYPE_ALLGATHER, UCC_TL_UCP_ALLGATHER_ALG_RING, 0},
+    {UCC_COLL_TYPE_ALLGATHER, UCC_TL_UCP_ALLGATHER_ALG_BRUCK, 0},
+    {UCC_COLL_TYPE_ALLGATHER, UCC_TL_UCP_ALLGATHER_ALG_RECURSIVE_DOUBLING, 0},
+    {UCC_COLL_TYPE_ALLTOALL, UCC_TL_UCP_ALLTOALL_ALG_PAIRWISE, 0},
+    {UCC_COLL_TYPE_ALLTOALL, UCC_TL_UCP_ALLTOALL_ALG_BRUCK, 0},
+    {UCC_COLL_TYPE_BCAST, UCC_TL_UCP_BCAST_ALG_KNOMIAL, 1},
+    {UCC_COLL_TYPE_BCAST, UCC_TL_UCP_BCAST_ALG_SAG_KNOMIAL, 1},
+    {UCC_COLL_TYPE_REDUCE_SCATTER, UCC_TL_UCP_REDUCE_SCATTER_ALG_KNOMIAL, 1},
+    {UCC_COLL_TYPE_REDUCE_SCATTER, UCC_TL_UCP_REDUCE_SCATTER_ALG_RING, 0}};
+
+static const uint32_t ucc_tl_ucp_tune_radices[] = {2, 4, 8};
+
+static inline int ucc_tl_ucp_tune_coll_idx(ucc_coll_type_t coll_type)
+{
+    int i;
+
+    for (i = 0; i < UCC_TL_UCP_TUNE_N_COLLS; i++) {
+        if (ucc_tl_ucp_tune_coll_types[i] == coll_type) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static inline const char *ucc_tl_ucp_tune_alg_name(ucc_coll_type_t coll_type,
+                                                   int             alg_id)
+{
+    return ucc_tl_ucp.super.alg_info[ucc_ilog2(coll_type)][alg_id].name;
+}
+
+/* Names accepted by the TUNE string parser */
+static inline const char *ucc_tl_ucp_tune_mem_type_str(ucc_memory_type_t mt)
+{
+    switch (mt) {
+    case UCC_MEMORY_TYPE_HOST:
+        return "host";
+    case UCC_MEMORY_TYPE_CUDA:
+        return "cuda";
+    case UCC_MEMORY_TYPE_CUDA_MANAGED:
+        return "cuda_managed";
+    case UCC_MEMORY_TYPE_ROCM:
+        return "rocm";
+    case UCC_MEMORY_TYPE_ROCM_MANAGED:
+        return "rocm_managed";
+    default:
+        break;
+    }
+    return "unknown";
+}
+
+uint64_t ucc_tl_ucp_tune_colls(void)
+{
+    uint64_t colls = 0;
+    int      i;
+
+    for (i = 0; i < UCC_TL_UCP_TUNE_N_COLLS; i++) {
+        colls |= ucc_tl_ucp_tune_coll_types[i];
+    }
+    return colls;
+}
+
+ucc_status_t ucc_tl_ucp_tune_init(ucc_tl_ucp_team_t *team)
+{
+    ucc_tl_ucp_lib_t       *lib = UCC_TL_UCP_TEAM_LIB(team);
+    ucc_tl_ucp_tune_t      *tune;
+    ucc_tl_ucp_tune_cand_t *cand;
+    ucc_base_coll_init_fn_t init;
+    ucc_status_t            status;
+    uint32_t                radix, last_radix;
+    int                     i, j, c;
+
+    team->tune       = NULL;
+    team->tune_radix = 0;
+    if (0 == lib->cfg.autotune || team->size < 2) {
+        return UCC_OK;
+    }
+    tune = ucc_calloc(1, sizeof(*tune), "tl_ucp_tune");
+    if (!tune) {
+        tl_error(&lib->super.super, "failed to allocate %zd bytes for tune",
+                 sizeof(*tune));
+        return UCC_ERR_NO_MEMORY;
+    }
+    ucc_assert(UCC_TL_UCP_TUNE_N_COLLS * UCC_MEMORY_TYPE_LAST *
+               UCC_TL_UCP_TUNE_N_BUCKETS <= UCC_TL_UCP_TUNE_TAGS);
+    team->max_coll_tag = UCC_TL_UCP_TUNE_TAG;
+    tune->n_iters = lib->cfg.autotune;
+    for (i = 0; i < (int)ucs_static_array_size(ucc_tl_ucp_tune_algs); i++) {
+        c      = ucc_tl_ucp_tune_coll_idx(ucc_tl_ucp_tune_algs[i].coll_type);
+        status = ucc_tl_ucp_alg_id_to_init(
+            ucc_tl_ucp_tune_algs[i].alg_id, NULL,
+            ucc_tl_ucp_tune_algs[i].coll_type, UCC_MEMORY_TYPE_HOST, &init);
+        ucc_assert(c >= 0 && UCC_OK == status);
+        last_radix = 0;
+        for (j = 0; j < (int)ucs_static_array_size(ucc_tl_ucp_tune_radices); j++) {
+            radix = 0;
+            if (ucc_tl_ucp_tune_algs[i].has_radix) {
+                /* radices above the team size are equivalent */
+                radix = ucc_min(ucc_tl_ucp_tune_radices[j], team->size);
+                if (radix == last_radix) {
+                    continue;
+                }
+                last_radix = radix;
+            }
+            ucc_assert(tune->n_cands[c] < UCC_TL_UCP_TUNE_MAX_CANDS);
+            cand         = &tune->cands[c][tune->n_cands[c]++];
+            cand->alg_id = ucc_tl_ucp_tune_algs[i].alg_id;
+            cand->radix  = radix;
+            cand->init   = init;
+            if (!ucc_tl_ucp_tune_algs[i].has_radix) {
+                break;
+            }
+        }
+    }
+    team->tune = tune;
+    return UCC_OK;
+}
+
+void ucc_tl_ucp_tune_cleanup(ucc_tl_ucp_team_t *team)
+{
+    ucc_tl_ucp_tune_t        *tune = team->tune;
+    ucc_tl_ucp_tune_bucket_t *bucket;
+    int                       c, m, b;
+
+    if (!tune) {
+        return;
+    }
+    for (c = 0; c < UCC_TL_UCP_TUNE_N_COLLS; c++) {
+        for (m = 0; m < UCC_MEMORY_TYPE_LAST; m++) {
+            for (b = 0; b < UCC_TL_UCP_TUNE_N_BUCKETS; b++) {
+                bucket = tune->buckets[c][m][b];
+                if (!bucket) {
+                    continue;
+                }
+                if (bucket->agree_task) {
+                    ucc_tl_ucp_service_cleanup(bucket->agree_task);
+                }
+                ucc_free(bucket);
+            }
+        }
+    }
+    ucc_free(tune);
+    team->tune = NULL;
+}
+
+static inline ucc_tl_ucp_tune_bucket_t *
+ucc_tl_ucp_tune_get_bucket(ucc_tl_ucp_tune_t *tune, int c,
+                           ucc_memory_type_t mt, size_t msgsize)
+{
+    int                       b = (0 == msgsize) ? 0 : ucc_ilog2(msgsize) + 1;
+    ucc_tl_ucp_tune_bucket_t *bucket;
+
+    bucket = tune->buckets[c][mt][b];
+    if (ucc_likely(bucket)) {
+        return bucket;
+    }
+    bucket = ucc_calloc(1, sizeof(*bucket), "tl_ucp_tune_bucket");
+    if (!bucket) {
+        return NULL;
+    }
+    bucket->state           = UCC_TL_UCP_TUNE_STATE_TUNING;
+    bucket->winner          = -1;
+    bucket->tag             = UCC_TL_UCP_TUNE_TAG +
+        (c * UCC_MEMORY_TYPE_LAST + mt) * UCC_TL_UCP_TUNE_N_BUCKETS + b;
+    tune->buckets[c][mt][b] = bucket;
+    return bucket;
+}
+
+static inline ucc_status_t
+ucc_tl_ucp_tune_cand_init(ucc_tl_ucp_team_t *team, ucc_tl_ucp_tune_cand_t *cand,
+                          ucc_base_coll_args_t *coll_args,
+                          ucc_coll_task_t     **task_h)
+{
+    ucc_status_t status;
+
+    team->tune_radix = cand->radix;
+    status           = cand->init(coll_args, &team->super.super, task_h);
+    team->tune_radix = 0;
+    return status;
+}
+
+/* Every rank contributes its average time of each candidate, the max over
+   the team is the time of the collective. The agreements of different
+   buckets complete in any order, each one uses the tag of its bucket */
+static ucc_status_t ucc_tl_ucp_tune_agree_post(ucc_tl_ucp_tune_task_t *task)
+{
+    ucc_tl_ucp_team_t        *team    = task->team;
+    ucc_tl_ucp_tune_bucket_t *bucket  = task->bucket;
+    int                       n_cands = team->tune->n_cands[task->coll];
+    ucc_tl_team_subset_t      subset  = {
+        .map.type   = UCC_EP_MAP_FULL,
+        .map.ep_num = team->size,
+        .myrank     = team->rank
+    };
+    ucc_coll_task_t          *agree_task;
+    ucc_status_t              status;
+    int                       i;
+
+    for (i = 0; i < n_cands; i++) {
+        if ((bucket->unsupported & UCC_BIT(i)) || !bucket->n_samples[i]) {
+            bucket->avg[i] = DBL_MAX;
+        } else {
+            bucket->avg[i] = bucket->time[i] / bucket->n_samples[i];
+        }
+    }
+    bucket->state = UCC_TL_UCP_TUNE_STATE_AGREE;
+    status = ucc_tl_ucp_service_allreduce_tag(&team->super.super, bucket->avg,
+                                              bucket->avg_max, UCC_DT_FLOAT64,
+                                              n_cands, UCC_OP_MAX, subset,
+                                              bucket->tag, &agree_task);
+    if (UCC_OK == status) {
+        bucket->agree_task = agree_task;
+    }
+    return status;
+}
+
+static ucc_status_t ucc_tl_ucp_tune_agree_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_tune_task_t   *task    =
+        ucc_derived_of(coll_task, ucc_tl_ucp_tune_task_t);
+    ucc_tl_ucp_team_t        *team    = task->team;
+    ucc_tl_ucp_tune_bucket_t *bucket  = task->bucket;
+    ucc_tl_ucp_tune_cand_t   *cands   = team->tune->cands[task->coll];
+    int                       n_cands = team->tune->n_cands[task->coll];
+    ucc_status_t              status;
+    int                       i;
+
+    status = ucc_tl_ucp_service_test(bucket->agree_task);
+    if (UCC_INPROGRESS == status) {
+        return UCC_INPROGRESS;
+    }
+    ucc_tl_ucp_service_cleanup(bucket->agree_task);
+    bucket->agree_task = NULL;
+    if (UCC_OK != status) {
+        tl_error(UCC_TL_TEAM_LIB(team), "autotune agreement failed: %s",
+                 ucc_status_string(status));
+    } else {
+        for (i = 0; i < n_cands; i++) {
+            if (bucket->avg_max[i] != DBL_MAX &&
+                (bucket->winner < 0 ||
+                 bucket->avg_max[i] < bucket->avg_max[bucket->winner])) {
+                bucket->winner = i;
+            }
+        }
+    }
+    bucket->state = UCC_TL_UCP_TUNE_STATE_DONE;
+    if (bucket->winner >= 0) {
+        tl_debug(UCC_TL_TEAM_LIB(team),
+                 "autotune %s, msgsize %zd: alg %s, radix %u, %.2f us",
+                 ucc_coll_type_str(ucc_tl_ucp_tune_coll_types[task->coll]),
+                 task->msgsize,
+                 ucc_tl_ucp_tune_alg_name(
+                     ucc_tl_ucp_tune_coll_types[task->coll],
+                     cands[bucket->winner].alg_id),
+                 cands[bucket->winner].radix,
+                 bucket->avg_max[bucket->winner] * 1e6);
+    }
+    task->super.super.progress     = NULL;
+    task->super.super.super.status = status;
+    return status;
+}
+
+static ucc_status_t
+ucc_tl_ucp_tune_task_completed_handler(ucc_coll_task_t *parent_task, //NOLINT
+                                       ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_tune_task_t   *task   =
+        ucc_derived_of(coll_task, ucc_tl_ucp_tune_task_t);
+    ucc_tl_ucp_tune_bucket_t *bucket = task->bucket;
+    ucc_status_t              status;
+
+    if (UCC_TL_UCP_TUNE_STATE_TUNING == bucket->state) {
+        bucket->time[task->cand] +=
+            ucs_time_to_sec(ucs_get_time() - task->start);
+        bucket->n_samples[task->cand]++;
+    }
+    if (task->agree) {
+        task->agree = 0;
+        status      = ucc_tl_ucp_tune_agree_post(task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TL_TEAM_LIB(task->team),
+                     "failed to post autotune agreement");
+            bucket->state                  = UCC_TL_UCP_TUNE_STATE_DONE;
+            task->super.super.super.status = status;
+            return ucc_task_complete(coll_task);
+        }
+        /* the collective completes together with the agreement */
+        task->in_pq                = 1;
+        task->super.super.progress = ucc_tl_ucp_tune_agree_progress;
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(task->team)->pq, coll_task);
+        return UCC_OK;
+    }
+    task->super.super.super.status = UCC_OK;
+    if (task->in_pq) {
+        return UCC_OK;
+    }
+    return ucc_task_complete(coll_task);
+}
+
+static inline void ucc_tl_ucp_tune_task_add(ucc_tl_ucp_tune_task_t *task,
+                                            ucc_coll_task_t        *coll_task)
+{
+    ucc_schedule_add_task(&task->super, coll_task);
+    ucc_event_manager_subscribe(&task->super.super.em,
+                                UCC_EVENT_SCHEDULE_STARTED, coll_task);
+    coll_task->handlers[UCC_EVENT_SCHEDULE_STARTED] = ucc_task_start_handler;
+}
+
+/* Checks if the collective initialized by the deferred task used more tags
+   than the task reserved at init */
+static inline int
+ucc_tl_ucp_tune_deferred_overflow(ucc_tl_ucp_tune_task_t *task)
+{
+    ucc_tl_ucp_team_t *team = task->team;
+
+    return (team->seq_num - task->seq_num + team->max_coll_tag) %
+           team->max_coll_tag > UCC_TL_UCP_TUNE_DEFERRED_TAGS;
+}
+
+/* Deferred task waits in the progress queue for the winner of its bucket.
+   The selected collective gets the tags reserved at init, so its tags are
+   the same on all the ranks */
+static ucc_status_t
+ucc_tl_ucp_tune_deferred_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_tune_task_t   *task    =
+        ucc_derived_of(coll_task, ucc_tl_ucp_tune_task_t);
+    ucc_tl_ucp_team_t        *team    = task->team;
+    ucc_tl_ucp_tune_bucket_t *bucket  = task->bucket;
+    uint32_t                  seq_num = team->seq_num;
+    ucc_coll_task_t          *subtask;
+    ucc_status_t              status;
+
+    if (UCC_TL_UCP_TUNE_STATE_DONE != bucket->state) {
+        return UCC_INPROGRESS;
+    }
+    team->seq_num = task->seq_num;
+    if (bucket->winner < 0) {
+        status = ucc_tl_ucp_coll_init(&task->args, &team->super.super,
+                                      &subtask);
+    } else {
+        status = ucc_tl_ucp_tune_cand_init(
+            team, &team->tune->cands[task->coll][bucket->winner], &task->args,
+            &subtask);
+        if (UCC_OK == status && ucc_tl_ucp_tune_deferred_overflow(task)) {
+            /* the winner needs more tags than reserved, the default
+               algorithm is selected on all the ranks */
+            tl_debug(UCC_TL_TEAM_LIB(team),
+                     "deferred %s: winner needs more than %d tags, "
+                     "using default algorithm",
+                     ucc_coll_type_str(ucc_tl_ucp_tune_coll_types[task->coll]),
+                     UCC_TL_UCP_TUNE_DEFERRED_TAGS);
+            subtask->finalize(subtask);
+            team->seq_num = task->seq_num;
+            status        = ucc_tl_ucp_coll_init(&task->args,
+                                                 &team->super.super, &subtask);
+        }
+    }
+    if (UCC_OK == status && ucc_tl_ucp_tune_deferred_overflow(task)) {
+        subtask->finalize(subtask);
+        status = UCC_ERR_NO_RESOURCE;
+    }
+    team->seq_num              = seq_num;
+    task->super.super.progress = NULL;
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(team), "failed to init deferred %s",
+                 ucc_coll_type_str(ucc_tl_ucp_tune_coll_types[task->coll]));
+        goto out;
+    }
+    ucc_tl_ucp_tune_task_add(task, subtask);
+    status = ucc_schedule_start(&task->super);
+    if (ucc_likely(UCC_OK == status)) {
+        return UCC_OK;
+    }
+out:
+    task->super.super.super.status = status;
+    return status;
+}
+
+static ucc_status_t ucc_tl_ucp_tune_task_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_tune_task_t *task =
+        ucc_derived_of(coll_task, ucc_tl_ucp_tune_task_t);
+
+    if (0 == task->super.n_tasks) {
+        /* deferred, the collective is selected by the progress */
+        task->in_pq                    = 1;
+        task->super.super.super.status = UCC_INPROGRESS;
+        task->super.super.progress     = ucc_tl_ucp_tune_deferred_progress;
+        ucc_progress_enqueue(UCC_TL_CORE_CTX(task->team)->pq, coll_task);
+        return UCC_OK;
+    }
+    task->in_pq = 0;
+    task->start = ucs_get_time();
+    return ucc_schedule_start(&task->super);
+}
+
+static ucc_status_t ucc_tl_ucp_tune_task_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_tune_task_t *task =
+        ucc_derived_of(coll_task, ucc_tl_ucp_tune_task_t);
+    ucc_status_t            status;
+
+    if (task->agree) {
+        /* the collective selected to agree on the winner was never posted:
+           the next one takes over */
+        task->bucket->n_inits--;
+    }
+    status = ucc_schedule_finalize(coll_task);
+    ucc_tl_ucp_put_schedule(&task->super);
+    return status;
+}
+
+static ucc_status_t
+ucc_tl_ucp_tune_task_init(ucc_tl_ucp_team_t *team, ucc_base_coll_args_t *args,
+                          ucc_tl_ucp_tune_bucket_t *bucket, int coll, int cand,
+                          int agree, ucc_coll_task_t *coll_task,
+                          ucc_coll_task_t **task_h)
+{
+    ucc_tl_ucp_tune_task_t *task =
+        ucc_derived_of(ucc_tl_ucp_get_schedule(team), ucc_tl_ucp_tune_task_t);
+
+    task->team    = team;
+    task->bucket  = bucket;
+    task->msgsize = ucc_coll_args_msgsize(args);
+    task->coll    = coll;
+    task->cand    = cand;
+    task->agree   = agree;
+    task->in_pq   = 0;
+    if (coll_task) {
+        ucc_tl_ucp_tune_task_add(task, coll_task);
+    } else {
+        /* deferred: reserve the tags of the collective selected on post */
+        task->args    = *args;
+        task->seq_num = team->seq_num;
+        team->seq_num = (team->seq_num + UCC_TL_UCP_TUNE_DEFERRED_TAGS) %
+                        team->max_coll_tag;
+    }
+    task->super.super.handlers[UCC_EVENT_COMPLETED] =
+        ucc_tl_ucp_tune_task_completed_handler;
+    task->super.super.post     = ucc_tl_ucp_tune_task_start;
+    task->super.super.progress = NULL;
+    task->super.super.finalize = ucc_tl_ucp_tune_task_finalize;
+    *task_h                    = &task->super.super;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_tune_coll_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *team,
+                                       ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t        *tl_team = ucc_derived_of(team,
+                                                       ucc_tl_ucp_team_t);
+    ucc_tl_ucp_tune_t        *tune    = tl_team->tune;
+    ucc_memory_type_t         mt      = ucc_coll_args_mem_type(coll_args);
+    ucc_tl_ucp_tune_bucket_t *bucket;
+    ucc_tl_ucp_tune_cand_t   *cands;
+    ucc_coll_task_t          *task;
+    ucc_status_t              status;
+    uint32_t                  n_tuning;
+    int                       c, n_cands, cand, agree, i;
+
+    c = tune ? ucc_tl_ucp_tune_coll_idx(coll_args->args.coll_type) : -1;
+    if (c < 0 || mt >= UCC_MEMORY_TYPE_LAST) {
+        return ucc_tl_ucp_coll_init(coll_args, team, task_h);
+    }
+    bucket = ucc_tl_ucp_tune_get_bucket(tune, c, mt,
+                                        ucc_coll_args_msgsize(coll_args));
+    if (ucc_unlikely(!bucket)) {
+        tl_error(team->context->lib, "failed to allocate autotune bucket");
+        return UCC_ERR_NO_MEMORY;
+    }
+    cands    = tune->cands[c];
+    n_cands  = tune->n_cands[c];
+    n_tuning = tune->n_iters * n_cands;
+    if (UCC_TL_UCP_TUNE_STATE_DONE != bucket->state &&
+        bucket->n_inits > n_tuning) {
+        /* the agreement collective is initialized, the winner is not known
+           yet on all the ranks: select on post, once it is known */
+        return ucc_tl_ucp_tune_task_init(tl_team, coll_args, bucket, c, -1, 0,
+                                         NULL, task_h);
+    }
+    if (UCC_TL_UCP_TUNE_STATE_DONE == bucket->state) {
+        if (bucket->winner < 0) {
+            return ucc_tl_ucp_coll_init(coll_args, team, task_h);
+        }
+        return ucc_tl_ucp_tune_cand_init(tl_team, &cands[bucket->winner],
+                                         coll_args, task_h);
+    }
+
+    agree  = (bucket->n_inits == n_tuning);
+    cand   = bucket->n_inits % n_cands;
+    status = UCC_ERR_NOT_SUPPORTED;
+    bucket->n_inits++;
+    /* unsupported candidates (e.g. team size restrictions) are the same on
+       all the ranks, the next one is used instead */
+    for (i = 0; i < n_cands; i++, cand = (cand + 1) % n_cands) {
+        if (bucket->unsupported & UCC_BIT(cand)) {
+            continue;
+        }
+        status = ucc_tl_ucp_tune_cand_init(tl_team, &cands[cand], coll_args,
+                                           &task);
+        if (UCC_ERR_NOT_SUPPORTED != status) {
+            break;
+        }
+        bucket->unsupported |= UCC_BIT(cand);
+    }
+    if (ucc_unlikely(UCC_OK != status)) {
+        bucket->n_inits--;
+        return status;
+    }
+    return ucc_tl_ucp_tune_task_init(tl_team, coll_args, bucket, c, cand, agree,
+                                     task, task_h);
+}
+
+static inline size_t ucc_tl_ucp_tune_bucket_start(int b)
+{
+    return (0 == b) ? 0 : (1ULL << (b - 1));
+}
+
+ucc_status_t ucc_tl_ucp_tune_dump(ucc_tl_ucp_team_t *team, char *str,
+                                  size_t max_len)
+{
+    ucc_tl_ucp_tune_t        *tune = team->tune;
+    ucc_tl_ucp_tune_bucket_t *bucket, *next;
+    ucc_tl_ucp_tune_cand_t   *cand;
+    char                      end[32];
+    size_t                    len;
+    int                       c, m, b, e, n;
+
+    str[0] = '\0';
+    if (!tune) {
+        return UCC_OK;
+    }
+    len = 0;
+    for (c = 0; c < UCC_TL_UCP_TUNE_N_COLLS; c++) {
+        for (m = 0; m < UCC_MEMORY_TYPE_LAST; m++) {
+            for (b = 0; b < UCC_TL_UCP_TUNE_N_BUCKETS; b = e) {
+                bucket = tune->buckets[c][m][b];
+                e      = b + 1;
+                if (!bucket || UCC_TL_UCP_TUNE_STATE_DONE != bucket->state ||
+                    bucket->winner < 0) {
+                    continue;
+                }
+                /* merge the adjacent buckets with the same winner */
+                for (; e < UCC_TL_UCP_TUNE_N_BUCKETS; e++) {
+                    next = tune->buckets[c][m][e];
+                    if (!next || UCC_TL_UCP_TUNE_STATE_DONE != next->state ||
+                        next->winner != bucket->winner) {
+                        break;
+                    }
+                }
+                if (e == UCC_TL_UCP_TUNE_N_BUCKETS) {
+                    ucc_strncpy_safe(end, "inf", sizeof(end));
+                } else {
+                    ucc_snprintf_safe(end, sizeof(end), "%zu",
+                                      ucc_tl_ucp_tune_bucket_start(e));
+                }
+                /* TUNE has no radix qualifier: the tuned radix is only
+                   reported by the debug log */
+                cand = &tune->cands[c][bucket->winner];
+                n    = snprintf(str + len, max_len - len,
+                                "%s%s:%zu-%s:%s:[%u-%u]:@%s", len ? "#" : "",
+                                ucc_coll_type_str(ucc_tl_ucp_tune_coll_types[c]),
+                                ucc_tl_ucp_tune_bucket_start(b), end,
+                                ucc_tl_ucp_tune_mem_type_str(m), team->size,
+                                team->size,
+                                ucc_tl_ucp_tune_alg_name(
+                                    ucc_tl_ucp_tune_coll_types[c],
+                                    cand->alg_id));
+                if (n < 0 || (size_t)n >= max_len - len) {
+                    str[len] = '\0';
+                    return UCC_ERR_NO_MESSAGE;
+                }
+                len += n;
+            }
+        }
+    }
+    return UCC_OK;
+}
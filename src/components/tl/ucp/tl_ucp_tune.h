@@ -0,0 +1,109 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TL_UCP_TUNE_H_
+#define UCC_TL_UCP_TUNE_H_
+
+#include "tl_ucp.h"
+#include "schedule/ucc_schedule.h"
+#include <ucs/time/time.h>
+
+/* Online autotuner (UCC_TL_UCP_AUTOTUNE=N).
+
+   For every (coll_type, mem_type, msgsize bucket) the first N * n_cands
+   invocations of the collective rotate over the candidate algorithms and
+   radices, every invocation is timed. The invocation that follows the
+   tuning round appends an allreduce(MAX) of the average times over the
+   team to the collective, so all the ranks select the same winner. Next
+   invocations of the bucket go directly to the winner.
+
+   The selection is done at collective init, so it is the same on all the
+   ranks as long as the collectives are initialized in the same order.
+   A collective initialized while the agreement of its bucket is still
+   running is deferred: the algorithm is selected and posted once the
+   winner is known. It completes only after all the earlier collectives of
+   the bucket are posted by the user. */
+
+#define UCC_TL_UCP_TUNE_N_COLLS     5
+#define UCC_TL_UCP_TUNE_MAX_CANDS   8
+/* bucket 0 - msgsize 0, bucket i - msgsize in [2^(i-1), 2^i) */
+#define UCC_TL_UCP_TUNE_N_BUCKETS   65
+#define UCC_TL_UCP_TUNE_STR_MAX_LEN 4096
+/* tags reserved at init by a deferred collective, one per tl_ucp task. A
+   winner that needs more (long pipelines) is replaced by the default
+   algorithm */
+#define UCC_TL_UCP_TUNE_DEFERRED_TAGS 64
+
+typedef enum {
+    UCC_TL_UCP_TUNE_STATE_TUNING,
+    UCC_TL_UCP_TUNE_STATE_AGREE, /* times allreduce is posted */
+    UCC_TL_UCP_TUNE_STATE_DONE
+} ucc_tl_ucp_tune_state_t;
+
+typedef struct ucc_tl_ucp_tune_cand {
+    int                     alg_id;
+    uint32_t                radix; /* 0 - algorithm has no radix */
+    ucc_base_coll_init_fn_t init;
+} ucc_tl_ucp_tune_cand_t;
+
+typedef struct ucc_tl_ucp_tune_bucket {
+    ucc_tl_ucp_tune_state_t state;
+    uint32_t                n_inits;
+    int                     winner;
+    uint32_t                unsupported; /* bitmap of candidates */
+    uint32_t                tag; /* of the agreement */
+    uint32_t                n_samples[UCC_TL_UCP_TUNE_MAX_CANDS];
+    double                  time[UCC_TL_UCP_TUNE_MAX_CANDS];
+    double                  avg[UCC_TL_UCP_TUNE_MAX_CANDS];
+    double                  avg_max[UCC_TL_UCP_TUNE_MAX_CANDS];
+    ucc_coll_task_t        *agree_task;
+} ucc_tl_ucp_tune_bucket_t;
+
+typedef struct ucc_tl_ucp_tune {
+    uint32_t                  n_iters;
+    int                       n_cands[UCC_TL_UCP_TUNE_N_COLLS];
+    ucc_tl_ucp_tune_cand_t    cands[UCC_TL_UCP_TUNE_N_COLLS]
+                                   [UCC_TL_UCP_TUNE_MAX_CANDS];
+    ucc_tl_ucp_tune_bucket_t *buckets[UCC_TL_UCP_TUNE_N_COLLS]
+                                     [UCC_MEMORY_TYPE_LAST]
+                                     [UCC_TL_UCP_TUNE_N_BUCKETS];
+} ucc_tl_ucp_tune_t;
+
+/* Wraps the collective task selected during the tuning round: measures
+   the time from post to completion. A deferred task has no collective task
+   until the winner of its bucket is known */
+typedef struct ucc_tl_ucp_tune_task {
+    ucc_schedule_t            super;
+    ucc_tl_ucp_team_t        *team;
+    ucc_tl_ucp_tune_bucket_t *bucket;
+    size_t                    msgsize;
+    int                       coll;
+    int                       cand;
+    int                       agree;
+    int                       in_pq; /* completed by the progress queue */
+    ucs_time_t                start;
+    uint32_t                  seq_num; /* first reserved tag, deferred */
+    ucc_base_coll_args_t      args;    /* deferred */
+} ucc_tl_ucp_tune_task_t;
+
+ucc_status_t ucc_tl_ucp_tune_init(ucc_tl_ucp_team_t *team);
+
+void         ucc_tl_ucp_tune_cleanup(ucc_tl_ucp_team_t *team);
+
+/* Returns the coll_types handled by the autotuner */
+uint64_t     ucc_tl_ucp_tune_colls(void);
+
+/* "init" registered in the team score for the tuned coll_types */
+ucc_status_t ucc_tl_ucp_tune_coll_init(ucc_base_coll_args_t *coll_args,
+                                       ucc_base_team_t      *team,
+                                       ucc_coll_task_t     **task_h);
+
+/* Prints the tuned selection as a TUNE string: '#' separated tokens
+   "coll_type:msg_range:mem_type:[team_size]:@alg" */
+ucc_status_t ucc_tl_ucp_tune_dump(ucc_tl_ucp_team_t *team, char *str,
+                                  size_t max_len);
+
+#endif
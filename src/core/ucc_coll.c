@@ -13,15 +13,51 @@
 #include "utils/ucc_coll_utils.h"
 #include "utils/profile/ucc_profile_core.h"
 #include "schedule/ucc_schedule.h"
+#include "coll_score/ucc_coll_score.h"
 
-/* NOLINTNEXTLINE  */
-static ucc_cl_team_t *ucc_select_cl_team(ucc_coll_args_t *coll_args,
-                                         ucc_team_t *team)
+/* Selects the CL team with the highest score for the given coll_type,
+   mem_type and msgsize. If no CL reported a score for the collective then
+   the first CL team is used (it will report NOT_SUPPORTED if needed). */
+static inline ucc_status_t
+ucc_select_cl_team(ucc_base_coll_args_t *op_args, ucc_team_t *team,
+                   ucc_base_coll_init_fn_t *init, ucc_base_team_t **cl_team)
 {
-    /* TODO1: collective CL selection logic will be there.
-       for now just return 1st CL on a list
-       TODO2: remove NOLINT once TODO1 is done */
-    return team->cl_teams[0];
+    ucc_status_t status;
+
+    status = ucc_coll_score_map_lookup(team->score_map, op_args, init,
+                                       cl_team);
+    if (UCC_ERR_NOT_FOUND == status) {
+        *cl_team = &team->cl_teams[0]->super;
+        *init    = UCC_CL_TEAM_IFACE(team->cl_teams[0])->coll.init;
+        return UCC_OK;
+    }
+    return status;
+}
+
+/* The CL team selected by the score does not support the collective with
+   the given args: try the generic init of the other CL teams in the order
+   of the CL list. Returns NOT_SUPPORTED if none of them supports it. */
+static ucc_status_t ucc_coll_init_fallback(ucc_base_coll_args_t *op_args,
+                                          ucc_team_t           *team,
+                                          ucc_base_team_t      *tried,
+                                          ucc_coll_task_t     **task)
+{
+    ucc_status_t status = UCC_ERR_NOT_SUPPORTED;
+    int          i;
+
+    for (i = 0; i < team->n_cl_teams; i++) {
+        if (&team->cl_teams[i]->super == tried) {
+            continue;
+        }
+        status = UCC_CL_TEAM_IFACE(team->cl_teams[i])
+                     ->coll.init(op_args, &team->cl_teams[i]->super, task);
+        if (UCC_ERR_NOT_SUPPORTED != status) {
+            ucc_debug("collective falls back to CL %s",
+                      UCC_CL_TEAM_IFACE(team->cl_teams[i])->super.name);
+            break;
+        }
+    }
+    return status;
 }
 
 #define UCC_BUFFER_INFO_CHECK_MEM_TYPE(_info) do {                             \
@@ -122,10 +158,11 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init,
                       (coll_args, request, team), ucc_coll_args_t *coll_args,
                       ucc_coll_req_h *request, ucc_team_h team)
 {
-    ucc_cl_team_t         *cl_team;
-    ucc_coll_task_t       *task;
-    ucc_base_coll_args_t   op_args;
-    ucc_status_t           status;
+    ucc_base_team_t        *cl_team;
+    ucc_base_coll_init_fn_t init;
+    ucc_coll_task_t        *task;
+    ucc_base_coll_args_t    op_args;
+    ucc_status_t            status;
     status = ucc_coll_args_check_mem_type(coll_args, team->rank);
     if (ucc_unlikely(status != UCC_OK)) {
         ucc_error("memory type detection failed");
@@ -135,9 +172,13 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init,
     op_args.mask = 0;
     memcpy(&op_args.args, coll_args, sizeof(ucc_coll_args_t));
     op_args.team = team;
-    cl_team      = ucc_select_cl_team(coll_args, team);
-    status =
-        UCC_CL_TEAM_IFACE(cl_team)->coll.init(&op_args, &cl_team->super, &task);
+    status       = ucc_select_cl_team(&op_args, team, &init, &cl_team);
+    if (ucc_likely(UCC_OK == status)) {
+        status = init(&op_args, cl_team, &task);
+        if (UCC_ERR_NOT_SUPPORTED == status) {
+            status = ucc_coll_init_fallback(&op_args, team, cl_team, &task);
+        }
+    }
     if (UCC_ERR_NOT_SUPPORTED == status) {
         ucc_debug("failed to init collective: not supported");
         return status;
@@ -156,6 +197,14 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init,
 ucc_status_t ucc_collective_post(ucc_coll_req_h request)
 {
     ucc_coll_task_t *task = ucc_derived_of(request, ucc_coll_task_t);
+
+    /* A request (persistent or not) can be posted again only after the
+       previous post completed */
+    if (ucc_unlikely(UCC_INPROGRESS == task->super.status)) {
+        ucc_error("collective request %p is posted while in progress",
+                  request);
+        return UCC_ERR_INVALID_PARAM;
+    }
     return task->post(task);
 }
 
@@ -19,9 +19,24 @@ static ucc_config_field_t ucc_context_config_table[] = {
      ucc_offsetof(ucc_context_config_t, estimated_num_eps), UCC_CONFIG_TYPE_UINT},
 
     {"LOCK_FREE_PROGRESS_Q", "0",
-     "Enable lock free progress queue optimization",
+     "Progress queue of multithreaded context: 0 - locked list, 1 - lock "
+     "free queue, 2 - per thread queues with work stealing",
      ucc_offsetof(ucc_context_config_t, lock_free_progress_q), UCC_CONFIG_TYPE_UINT},
 
+    {"PROGRESS_Q_CAPACITY", "1024",
+     "Number of tasks in the ring of the lock free progress queue "
+     "(LOCK_FREE_PROGRESS_Q=1), rounded up to a power of 2. Tasks exceeding "
+     "it go to a locked list",
+     ucc_offsetof(ucc_context_config_t, progress_q_capacity),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"EVENT_DRIVEN_PROGRESS", "n",
+     "Progress a collective task only after its transport reported a "
+     "completion. Transport workers are progressed once per context "
+     "progress. Single threaded contexts only",
+     ucc_offsetof(ucc_context_config_t, event_driven_progress),
+     UCC_CONFIG_TYPE_BOOL},
+
     {"ESTIMATED_NUM_PPN", "0",
      "An optimization hint of how many endpoints created on this context reside"
      " on the same node",
@@ -499,8 +514,16 @@ ucc_status_t ucc_context_create(ucc_lib_h lib,
                         (params->mask & UCC_CONTEXT_PARAM_FIELD_TYPE))
                            ? UCC_THREAD_SINGLE
                            : lib->attr.thread_mode;
-    status           = ucc_progress_queue_init(&ctx->pq, ctx->thread_mode,
-                                               config->lock_free_progress_q);
+    ctx->event_driven_progress = config->event_driven_progress &&
+                                 (ctx->thread_mode == UCC_THREAD_SINGLE);
+    if (config->event_driven_progress && !ctx->event_driven_progress) {
+        ucc_warn("event driven progress is not supported in multithreaded "
+                 "context, ignoring");
+    }
+    status = ucc_progress_queue_init(&ctx->pq, ctx->thread_mode,
+                                     config->lock_free_progress_q,
+                                     config->progress_q_capacity,
+                                     ctx->event_driven_progress);
     if (UCC_OK != status) {
         ucc_error("failed to init progress queue for context %p", ctx);
         goto error_ctx_create;
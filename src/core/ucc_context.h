@@ -46,6 +46,7 @@ typedef struct ucc_context {
     ucc_context_params_t     params;
     ucc_context_attr_t       attr;
     ucc_thread_mode_t        thread_mode;
+    int                      event_driven_progress;
     ucc_cl_context_t       **cl_ctx;
     ucc_tl_context_t       **tl_ctx;
     ucc_tl_context_t        *service_ctx;
@@ -71,6 +72,8 @@ typedef struct ucc_context_config {
     uint32_t                  estimated_num_eps;
     uint32_t                  estimated_num_ppn;
     uint32_t                  lock_free_progress_q;
+    uint32_t                  progress_q_capacity;
+    int                       event_driven_progress;
 } ucc_context_config_t;
 
 /* Any internal UCC component (TL, CL, etc) may register its own
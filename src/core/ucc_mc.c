@@ -153,6 +153,27 @@ UCC_MC_PROFILE_FUNC(ucc_status_t, ucc_mc_reduce_multi,
                                           dtype, op);
 }
 
+UCC_MC_PROFILE_FUNC(ucc_status_t, ucc_mc_reduce_multi_nb,
+                    (src1, src2, dst, size, count, stride, dtype, op, mem_type,
+                     req),
+                    void *src1, void *src2, void *dst, size_t size,
+                    size_t count, size_t stride, ucc_datatype_t dtype,
+                    ucc_reduction_op_t op, ucc_memory_type_t mem_type,
+                    ucc_mc_req_t **req)
+{
+    *req = NULL;
+    if (count == 0) {
+        return UCC_OK;
+    }
+    UCC_CHECK_MC_AVAILABLE(mem_type);
+    if (!mc_ops[mem_type]->reduce_multi_nb) {
+        return mc_ops[mem_type]->reduce_multi(src1, src2, dst, size, count,
+                                              stride, dtype, op);
+    }
+    return mc_ops[mem_type]->reduce_multi_nb(src1, src2, dst, size, count,
+                                             stride, dtype, op, req);
+}
+
 ucc_status_t ucc_mc_free(ucc_mc_buffer_header_t *h_ptr)
 {
     UCC_CHECK_MC_AVAILABLE(h_ptr->mt);
@@ -182,6 +203,29 @@ UCC_MC_PROFILE_FUNC(ucc_status_t, ucc_mc_memcpy,
     return mc_ops[mt]->memcpy(dst, src, len, dst_mem, src_mem);
 }
 
+UCC_MC_PROFILE_FUNC(ucc_status_t, ucc_mc_memcpy_nb,
+                    (dst, src, len, dst_mem, src_mem, req), void *dst,
+                    const void *src, size_t len, ucc_memory_type_t dst_mem,
+                    ucc_memory_type_t src_mem, ucc_mc_req_t **req)
+{
+    *req = NULL;
+    if (src_mem == UCC_MEMORY_TYPE_HOST && dst_mem == UCC_MEMORY_TYPE_HOST) {
+        UCC_CHECK_MC_AVAILABLE(UCC_MEMORY_TYPE_HOST);
+        if (mc_ops[UCC_MEMORY_TYPE_HOST]->memcpy_nb) {
+            return mc_ops[UCC_MEMORY_TYPE_HOST]->memcpy_nb(
+                dst, src, len, UCC_MEMORY_TYPE_HOST, UCC_MEMORY_TYPE_HOST,
+                req);
+        }
+    }
+    return ucc_mc_memcpy(dst, src, len, dst_mem, src_mem);
+}
+
+ucc_status_t ucc_mc_req_test(ucc_mc_req_t *req)
+{
+    UCC_CHECK_MC_AVAILABLE(req->mt);
+    return mc_ops[req->mt]->req_test(req);
+}
+
 ucc_status_t ucc_mc_finalize()
 {
    ucc_memory_type_t  mt;
@@ -17,6 +17,12 @@ typedef struct ucc_mc_buffer_header {
     void             *addr;
 } ucc_mc_buffer_header_t;
 
+/* Request of the non blocking mc operation, mt - memory type of the mc
+   component executing it */
+typedef struct ucc_mc_req {
+    ucc_memory_type_t mt;
+} ucc_mc_req_t;
+
 typedef struct ucc_mc_params {
     ucc_thread_mode_t thread_mode;
 } ucc_mc_params_t;
@@ -92,6 +98,36 @@ ucc_status_t ucc_mc_reduce_multi(void *src1, void *src2, void *dst,
                                  ucc_datatype_t dtype, ucc_reduction_op_t op,
                                  ucc_memory_type_t mem_type);
 
+/**
+ * Non blocking version of ucc_mc_reduce_multi: the memory component may
+ * execute large reductions on its helper threads
+ * @param [out] req      NULL if the reduction is completed on return,
+ *                       otherwise request to test with ucc_mc_req_test
+ * @return UCC_INPROGRESS if the request is posted, status of the
+ *         reduction otherwise
+ */
+ucc_status_t ucc_mc_reduce_multi_nb(void *src1, void *src2, void *dst,
+                                    size_t size, size_t count, size_t stride,
+                                    ucc_datatype_t dtype,
+                                    ucc_reduction_op_t op,
+                                    ucc_memory_type_t mem_type,
+                                    ucc_mc_req_t **req);
+
+/**
+ * Non blocking version of ucc_mc_memcpy, same semantics of req as in
+ * ucc_mc_reduce_multi_nb
+ */
+ucc_status_t ucc_mc_memcpy_nb(void *dst, const void *src, size_t len,
+                              ucc_memory_type_t dst_mem,
+                              ucc_memory_type_t src_mem, ucc_mc_req_t **req);
+
+/**
+ * Tests the request of the non blocking operation, the request is released
+ * once the operation is completed
+ * @return UCC_INPROGRESS or the status of the completed operation
+ */
+ucc_status_t ucc_mc_req_test(ucc_mc_req_t *req);
+
 static inline ucc_status_t ucc_dt_reduce(const void *src1, const void *src2,
                                          void *dst, size_t count,
                                          ucc_datatype_t dt,
@@ -121,4 +157,19 @@ static inline ucc_status_t ucc_dt_reduce_multi(void *src1, void *src2,
     }
 }
 
+static inline ucc_status_t
+ucc_dt_reduce_multi_nb(void *src1, void *src2, void *dst, size_t size,
+                       size_t count, size_t stride, ucc_datatype_t dt,
+                       ucc_memory_type_t mem_type, ucc_coll_args_t *args,
+                       ucc_mc_req_t **req)
+{
+    if (args->mask & UCC_COLL_ARGS_FIELD_USERDEFINED_REDUCTIONS) {
+        return UCC_ERR_NOT_SUPPORTED; //TODO
+    } else {
+        return ucc_mc_reduce_multi_nb(src1, src2, dst, size, count, stride,
+                                      dt, args->reduce.predefined_op,
+                                      mem_type, req);
+    }
+}
+
 #endif
@@ -8,6 +8,14 @@
 
 #include "ucc/api/ucc.h"
 #include "schedule/ucc_schedule.h"
+
+/* Values of LOCK_FREE_PROGRESS_Q: multithreaded progress queue type */
+enum {
+    UCC_PQ_MT_LOCKED        = 0, /* single list protected by a spinlock */
+    UCC_PQ_MT_LOCK_FREE     = 1, /* bounded lock free ring, ucc_mpmc_queue */
+    UCC_PQ_MT_WORK_STEALING = 2  /* per thread queues with work stealing */
+};
+
 typedef struct ucc_progress_queue ucc_progress_queue_t;
 struct ucc_progress_queue {
     void (*enqueue)(ucc_progress_queue_t *pq, ucc_coll_task_t *task);
@@ -18,7 +26,9 @@ struct ucc_progress_queue {
 
 ucc_status_t ucc_progress_queue_init(ucc_progress_queue_t **pq,
                                      ucc_thread_mode_t tm,
-                                     uint32_t lock_free_progress_q);
+                                     uint32_t lock_free_progress_q,
+                                     uint32_t progress_q_capacity,
+                                     int event_driven);
 
 static inline void ucc_progress_enqueue(ucc_progress_queue_t *pq,
                                         ucc_coll_task_t *task)
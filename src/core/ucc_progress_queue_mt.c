@@ -9,11 +9,15 @@
 #include "utils/ucc_log.h"
 #include "utils/ucc_spinlock.h"
 #include "utils/ucc_list.h"
-#include "utils/ucc_lock_free_queue.h"
+#include "utils/ucc_mpmc_queue.h"
 
+/* Tasks that do not fit into the ring go to the locked overflow list */
 typedef struct ucc_pq_mt {
     ucc_progress_queue_t super;
-    ucc_lf_queue_t       lf_queue;
+    ucc_mpmc_queue_t     queue;
+    ucc_spinlock_t       overflow_lock;
+    ucc_list_link_t      overflow;
+    uint32_t             n_overflow;
 } ucc_pq_mt_t;
 
 typedef struct ucc_pq_mt_locked {
@@ -34,8 +38,15 @@ static void ucc_pq_locked_mt_enqueue(ucc_progress_queue_t *pq,
 
 static void ucc_pq_mt_enqueue(ucc_progress_queue_t *pq, ucc_coll_task_t *task)
 {
-    ucc_pq_mt_t *pq_mt      = ucc_derived_of(pq, ucc_pq_mt_t);
-    ucc_lf_queue_enqueue(&pq_mt->lf_queue, &task->lf_elem);
+    ucc_pq_mt_t *pq_mt = ucc_derived_of(pq, ucc_pq_mt_t);
+
+    if (ucc_likely(UCC_OK == ucc_mpmc_queue_enqueue(&pq_mt->queue, task))) {
+        return;
+    }
+    ucc_spin_lock(&pq_mt->overflow_lock);
+    ucc_list_add_tail(&pq_mt->overflow, &task->list_elem);
+    pq_mt->n_overflow++;
+    ucc_spin_unlock(&pq_mt->overflow_lock);
 }
 
 static void ucc_pq_locked_mt_dequeue(ucc_progress_queue_t *pq,
@@ -55,10 +66,31 @@ static void ucc_pq_locked_mt_dequeue(ucc_progress_queue_t *pq,
 static void ucc_pq_mt_dequeue(ucc_progress_queue_t *pq,
                               ucc_coll_task_t **    popped_task)
 {
-    ucc_pq_mt_t *pq_mt  = ucc_derived_of(pq, ucc_pq_mt_t);
-    ucc_lf_queue_elem_t *elem   = ucc_lf_queue_dequeue(&pq_mt->lf_queue, 1);
-    *popped_task =
-        elem ? ucc_container_of(elem, ucc_coll_task_t, lf_elem) : NULL;
+    ucc_pq_mt_t     *pq_mt = ucc_derived_of(pq, ucc_pq_mt_t);
+    ucc_coll_task_t *task;
+
+    *popped_task = ucc_mpmc_queue_dequeue(&pq_mt->queue);
+    /* racy check, the overflow list is empty unless the ring was full */
+    if (!pq_mt->n_overflow) {
+        return;
+    }
+    ucc_spin_lock(&pq_mt->overflow_lock);
+    if (!ucc_list_is_empty(&pq_mt->overflow)) {
+        task = ucc_list_extract_head(&pq_mt->overflow, ucc_coll_task_t,
+                                     list_elem);
+        if (!*popped_task) {
+            *popped_task = task;
+            pq_mt->n_overflow--;
+        } else if (UCC_OK == ucc_mpmc_queue_enqueue(&pq_mt->queue, task)) {
+            /* the slot of the popped task goes to the overflow head: the
+               ring and the overflow list are served as a single FIFO, in
+               progress tasks in the ring can't starve the overflowed ones */
+            pq_mt->n_overflow--;
+        } else {
+            ucc_list_insert_after(&pq_mt->overflow, &task->list_elem);
+        }
+    }
+    ucc_spin_unlock(&pq_mt->overflow_lock);
 }
 
 static int ucc_pq_mt_progress(ucc_progress_queue_t *pq)
@@ -96,20 +128,33 @@ static void ucc_pq_locked_mt_finalize(ucc_progress_queue_t *pq)
 static void ucc_pq_mt_finalize(ucc_progress_queue_t *pq)
 {
     ucc_pq_mt_t *pq_mt = ucc_derived_of(pq, ucc_pq_mt_t);
-    ucc_lf_queue_destroy(&pq_mt->lf_queue);
+    ucc_mpmc_queue_destroy(&pq_mt->queue);
+    ucc_spinlock_destroy(&pq_mt->overflow_lock);
     ucc_free(pq_mt);
 }
 
+ucc_status_t ucc_pq_ws_init(ucc_progress_queue_t **pq);
+
 ucc_status_t ucc_pq_mt_init(ucc_progress_queue_t **pq,
-                            uint32_t lock_free_progress_q)
+                            uint32_t lock_free_progress_q,
+                            uint32_t capacity)
 {
-    if (lock_free_progress_q) {
+    if (lock_free_progress_q == UCC_PQ_MT_WORK_STEALING) {
+        return ucc_pq_ws_init(pq);
+    } else if (lock_free_progress_q) {
         ucc_pq_mt_t *pq_mt = ucc_malloc(sizeof(*pq_mt), "pq_mt");
         if (!pq_mt) {
             ucc_error("failed to allocate %zd bytes for pq_mt", sizeof(*pq_mt));
             return UCC_ERR_NO_MEMORY;
         }
-        ucc_lf_queue_init(&pq_mt->lf_queue);
+        if (UCC_OK != ucc_mpmc_queue_init(&pq_mt->queue, capacity)) {
+            ucc_error("failed to allocate pq_mt queue of %u tasks", capacity);
+            ucc_free(pq_mt);
+            return UCC_ERR_NO_MEMORY;
+        }
+        ucc_spinlock_init(&pq_mt->overflow_lock, 0);
+        ucc_list_head_init(&pq_mt->overflow);
+        pq_mt->n_overflow       = 0;
         pq_mt->super.enqueue    = ucc_pq_mt_enqueue;
         pq_mt->super.dequeue    = ucc_pq_mt_dequeue;
         pq_mt->super.progress   = ucc_pq_mt_progress;
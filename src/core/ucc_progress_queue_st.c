@@ -40,9 +40,47 @@ static int ucc_pq_st_progress(ucc_progress_queue_t *pq)
     return n_progressed;
 }
 
+/* Event driven mode: the tasks flagged EVENT_DRIVEN are progressed only
+   when their transport marked them RUNNABLE since the last progress call,
+   other tasks are progressed every time */
+static int ucc_pq_st_progress_ev(ucc_progress_queue_t *pq)
+{
+    ucc_pq_st_t     *pq_st        = ucc_derived_of(pq, ucc_pq_st_t);
+    int              n_progressed = 0;
+    ucc_coll_task_t *task, *tmp;
+    ucc_status_t     status;
+
+    ucc_list_for_each_safe(task, tmp, &pq_st->list, list_elem) {
+        if ((task->flags & (UCC_COLL_TASK_FLAG_EVENT_DRIVEN |
+                            UCC_COLL_TASK_FLAG_RUNNABLE)) ==
+            UCC_COLL_TASK_FLAG_EVENT_DRIVEN) {
+            continue;
+        }
+        task->flags &= ~UCC_COLL_TASK_FLAG_RUNNABLE;
+        if (task->progress) {
+            ucc_assert(task->super.status != UCC_OK);
+            status = task->progress(task);
+            if (ucc_unlikely(status < 0)) {
+                return ucc_task_error(task);
+            }
+        }
+        if (UCC_INPROGRESS == task->super.status) {
+            continue;
+        }
+        ucc_list_del(&task->list_elem);
+        n_progressed++;
+        if (0 > (status = ucc_task_complete(task))) {
+            return status;
+        }
+    }
+    return n_progressed;
+}
+
 static void ucc_pq_st_enqueue(ucc_progress_queue_t *pq, ucc_coll_task_t *task)
 {
     ucc_pq_st_t *pq_st = ucc_derived_of(pq, ucc_pq_st_t);
+    /* a new task is progressed at least once */
+    task->flags |= UCC_COLL_TASK_FLAG_RUNNABLE;
     ucc_list_add_tail(&pq_st->list, &task->list_elem);
 }
 
@@ -52,7 +90,7 @@ static void ucc_pq_st_finalize(ucc_progress_queue_t *pq)
     ucc_free(pq_st);
 }
 
-ucc_status_t ucc_pq_st_init(ucc_progress_queue_t **pq)
+ucc_status_t ucc_pq_st_init(ucc_progress_queue_t **pq, int event_driven)
 {
     ucc_pq_st_t *pq_st = ucc_malloc(sizeof(*pq_st), "pq_st");
     if (!pq_st) {
@@ -62,7 +100,8 @@ ucc_status_t ucc_pq_st_init(ucc_progress_queue_t **pq)
     ucc_list_head_init(&pq_st->list);
     pq_st->super.enqueue  = ucc_pq_st_enqueue;
     pq_st->super.dequeue  = NULL;
-    pq_st->super.progress = ucc_pq_st_progress;
+    pq_st->super.progress = event_driven ? ucc_pq_st_progress_ev
+                                         : ucc_pq_st_progress;
     pq_st->super.finalize = ucc_pq_st_finalize;
     *pq                   = &pq_st->super;
     return UCC_OK;
@@ -0,0 +1,233 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_progress_queue.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_log.h"
+#include "utils/ucc_spinlock.h"
+#include "utils/ucc_atomic.h"
+#include "utils/ucc_list.h"
+#include "utils/ucc_math.h"
+
+/* Work stealing progress queue (LOCK_FREE_PROGRESS_Q=2).
+
+   Every thread calling ucc_context_progress owns a task queue. Tasks are
+   enqueued to the queue of the posting thread and are progressed by the
+   owner in batches. A thread having nothing to progress steals a half of
+   the tasks of another thread and keeps them: stolen tasks are enqueued
+   back to the queue of the thief. Queue locks are taken once per batch,
+   not once per task, and are contended only by the stealing threads.
+
+   A thread also steals when its own batch made no progress, and every
+   UCC_PQ_WS_SWEEP_PERIOD calls: own tasks may wait for the tasks left in
+   the queue of a thread which does not progress the context anymore. */
+
+#define UCC_PQ_WS_MAX_THREADS  64
+#define UCC_PQ_WS_BATCH        16
+#define UCC_PQ_WS_SWEEP_PERIOD 32
+
+typedef struct ucc_pq_ws_queue {
+    ucc_spinlock_t  lock;
+    ucc_list_link_t tasks;
+    uint32_t        n_tasks;
+} ucc_pq_ws_queue_t;
+
+/* queues are padded to a cache line to avoid false sharing between
+   the owners */
+typedef union ucc_pq_ws_slot {
+    ucc_pq_ws_queue_t q;
+    char              pad[UCC_CACHE_LINE_SIZE];
+} ucc_pq_ws_slot_t;
+
+typedef struct ucc_pq_ws {
+    ucc_progress_queue_t super;
+    ucc_pq_ws_slot_t    *slots;
+} ucc_pq_ws_t;
+
+/* thread index is process wide: the same thread uses the same slot in
+   all the contexts */
+static uint32_t          ucc_pq_ws_n_threads = 0;
+static __thread int      ucc_pq_ws_thread_id = -1;
+static __thread uint32_t ucc_pq_ws_n_calls   = 0;
+static __thread uint32_t ucc_pq_ws_victim    = 0; /* next queue to steal */
+
+static inline int ucc_pq_ws_thread_slot(void)
+{
+    if (ucc_unlikely(ucc_pq_ws_thread_id < 0)) {
+        ucc_pq_ws_thread_id = ucc_atomic_fadd32(&ucc_pq_ws_n_threads, 1) %
+                              UCC_PQ_WS_MAX_THREADS;
+    }
+    return ucc_pq_ws_thread_id;
+}
+
+static void ucc_pq_ws_enqueue(ucc_progress_queue_t *pq, ucc_coll_task_t *task)
+{
+    ucc_pq_ws_t       *pq_ws = ucc_derived_of(pq, ucc_pq_ws_t);
+    ucc_pq_ws_queue_t *q     = &pq_ws->slots[ucc_pq_ws_thread_slot()].q;
+
+    ucc_spin_lock(&q->lock);
+    ucc_list_add_tail(&q->tasks, &task->list_elem);
+    q->n_tasks++;
+    ucc_spin_unlock(&q->lock);
+}
+
+/* Moves up to max_tasks tasks of q to the batch list: from the head for
+   the owner, from the tail for a thief */
+static int ucc_pq_ws_take(ucc_pq_ws_queue_t *q, ucc_list_link_t *batch,
+                          uint32_t max_tasks, int steal)
+{
+    ucc_coll_task_t *task;
+    uint32_t         n;
+
+    n = ucc_min(q->n_tasks, max_tasks);
+    for (q->n_tasks -= n; n > 0; n--) {
+        task = steal ? ucc_list_tail(&q->tasks, ucc_coll_task_t, list_elem)
+                     : ucc_list_head(&q->tasks, ucc_coll_task_t, list_elem);
+        ucc_list_del(&task->list_elem);
+        ucc_list_add_tail(batch, &task->list_elem);
+    }
+    return !ucc_list_is_empty(batch);
+}
+
+static int ucc_pq_ws_steal(ucc_pq_ws_t *pq_ws, int self,
+                           ucc_list_link_t *batch)
+{
+    int                n_slots = ucc_min(ucc_pq_ws_n_threads,
+                                         UCC_PQ_WS_MAX_THREADS);
+    ucc_pq_ws_queue_t *q;
+    int                i;
+
+    /* victims are taken in turn, so none of them is left behind */
+    for (i = 0; i < n_slots - 1; i++) {
+        q = &pq_ws->slots[(self + 1 + (ucc_pq_ws_victim + i) % (n_slots - 1)) %
+                          n_slots].q;
+        /* racy check, avoids locking the empty queues */
+        if (q->n_tasks == 0 || !ucc_spin_try_lock(&q->lock)) {
+            continue;
+        }
+        ucc_pq_ws_take(q, batch,
+                       ucc_min((q->n_tasks + 1) / 2, UCC_PQ_WS_BATCH), 1);
+        ucc_spin_unlock(&q->lock);
+        if (!ucc_list_is_empty(batch)) {
+            ucc_pq_ws_victim += i + 1;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Progresses the batch, tasks still in progress, own and stolen, go back to
+   the own queue. Returns the number of completed tasks or an error */
+static int ucc_pq_ws_progress_batch(ucc_pq_ws_queue_t *q,
+                                    ucc_list_link_t   *batch)
+{
+    int              ret = 0;
+    ucc_coll_task_t *task, *tmp;
+    ucc_status_t     status;
+    int              n_left;
+
+    ucc_list_for_each_safe(task, tmp, batch, list_elem) {
+        if (task->progress) {
+            status = task->progress(task);
+            if (ucc_unlikely(status < 0)) {
+                ucc_list_del(&task->list_elem);
+                ret = ucc_task_error(task);
+                break;
+            }
+        }
+        if (UCC_INPROGRESS == task->super.status) {
+            continue;
+        }
+        ucc_list_del(&task->list_elem);
+        if (ucc_unlikely(0 > (status = ucc_task_complete(task)))) {
+            ret = status;
+            break;
+        }
+        ret++;
+    }
+    if (!ucc_list_is_empty(batch)) {
+        n_left = ucc_list_length(batch);
+        ucc_spin_lock(&q->lock);
+        while (!ucc_list_is_empty(batch)) {
+            task = ucc_list_extract_head(batch, ucc_coll_task_t, list_elem);
+            ucc_list_add_tail(&q->tasks, &task->list_elem);
+        }
+        q->n_tasks += n_left;
+        ucc_spin_unlock(&q->lock);
+    }
+    return ret;
+}
+
+static int ucc_pq_ws_progress(ucc_progress_queue_t *pq)
+{
+    ucc_pq_ws_t       *pq_ws = ucc_derived_of(pq, ucc_pq_ws_t);
+    int                self  = ucc_pq_ws_thread_slot();
+    ucc_pq_ws_queue_t *q     = &pq_ws->slots[self].q;
+    int                ret   = 0;
+    ucc_list_link_t    batch;
+    int                n;
+
+    ucc_list_head_init(&batch);
+    if (q->n_tasks) {
+        ucc_spin_lock(&q->lock);
+        ucc_pq_ws_take(q, &batch, UCC_PQ_WS_BATCH, 0);
+        ucc_spin_unlock(&q->lock);
+    }
+    if (!ucc_list_is_empty(&batch)) {
+        ret = ucc_pq_ws_progress_batch(q, &batch);
+        if (ret < 0 ||
+            (ret > 0 && (++ucc_pq_ws_n_calls % UCC_PQ_WS_SWEEP_PERIOD))) {
+            return ret;
+        }
+    }
+    if (!ucc_pq_ws_steal(pq_ws, self, &batch)) {
+        return ret;
+    }
+    n = ucc_pq_ws_progress_batch(q, &batch);
+    return (n < 0) ? n : ret + n;
+}
+
+static void ucc_pq_ws_finalize(ucc_progress_queue_t *pq)
+{
+    ucc_pq_ws_t *pq_ws = ucc_derived_of(pq, ucc_pq_ws_t);
+    int          i;
+
+    for (i = 0; i < UCC_PQ_WS_MAX_THREADS; i++) {
+        ucc_spinlock_destroy(&pq_ws->slots[i].q.lock);
+    }
+    free(pq_ws->slots);
+    ucc_free(pq_ws);
+}
+
+ucc_status_t ucc_pq_ws_init(ucc_progress_queue_t **pq)
+{
+    size_t       size = UCC_PQ_WS_MAX_THREADS * sizeof(ucc_pq_ws_slot_t);
+    ucc_pq_ws_t *pq_ws;
+    int          i;
+
+    pq_ws = ucc_malloc(sizeof(*pq_ws), "pq_ws");
+    if (!pq_ws) {
+        ucc_error("failed to allocate %zd bytes for pq_ws", sizeof(*pq_ws));
+        return UCC_ERR_NO_MEMORY;
+    }
+    if (0 != posix_memalign((void **)&pq_ws->slots, UCC_CACHE_LINE_SIZE,
+                            size)) {
+        ucc_error("failed to allocate %zd bytes for pq_ws slots", size);
+        ucc_free(pq_ws);
+        return UCC_ERR_NO_MEMORY;
+    }
+    for (i = 0; i < UCC_PQ_WS_MAX_THREADS; i++) {
+        ucc_spinlock_init(&pq_ws->slots[i].q.lock, 0);
+        ucc_list_head_init(&pq_ws->slots[i].q.tasks);
+        pq_ws->slots[i].q.n_tasks = 0;
+    }
+    pq_ws->super.enqueue  = ucc_pq_ws_enqueue;
+    pq_ws->super.dequeue  = NULL;
+    pq_ws->super.progress = ucc_pq_ws_progress;
+    pq_ws->super.finalize = ucc_pq_ws_finalize;
+    *pq                   = &pq_ws->super;
+    return UCC_OK;
+}
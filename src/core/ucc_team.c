@@ -8,6 +8,7 @@
 #include "ucc_lib.h"
 #include "components/cl/ucc_cl.h"
 #include "components/tl/ucc_tl.h"
+#include "coll_score/ucc_coll_score.h"
 
 static ucc_status_t ucc_team_alloc_id(ucc_team_t *team);
 static void ucc_team_relase_id(ucc_team_t *team);
@@ -145,7 +146,10 @@ ucc_team_create_service_team(ucc_context_t *context, ucc_team_t *team)
             return status;
         }
         memcpy(&b_params, &team->params, sizeof(ucc_team_params_t));
-        b_params.rank = team->rank;
+        b_params.rank        = team->rank;
+        b_params.size        = team->size;
+        b_params.map.type    = UCC_EP_MAP_FULL;
+        b_params.map.ep_num  = team->size;
         b_params.scope =
             UCC_CL_LAST + 1; // CORE scopre id - never overlaps with CL type
         b_params.scope_id = 0;
@@ -190,9 +194,12 @@ ucc_team_create_cls(ucc_context_t *context, ucc_team_t *team)
         }
     }
     memcpy(&b_params.params, &team->params, sizeof(ucc_team_params_t));
-    b_params.rank = team->rank;
-    b_params.id   = team->id;
-    b_params.team = team;
+    b_params.rank       = team->rank;
+    b_params.size       = team->size;
+    b_params.map.type   = UCC_EP_MAP_FULL;
+    b_params.map.ep_num = team->size;
+    b_params.id         = team->id;
+    b_params.team       = team;
     for (i = team->last_team_create_posted + 1; i < context->n_cl_ctx; i++) {
         cl_iface = UCC_CL_CTX_IFACE(context->cl_ctx[i]);
         status   = cl_iface->team.create_post(&context->cl_ctx[i]->super,
@@ -224,6 +231,46 @@ ucc_team_create_cls(ucc_context_t *context, ucc_team_t *team)
     return UCC_OK;
 }
 
+/* Merges the scores of all the created CL teams into a single team score
+   map: for every coll_type/mem_type/msg range the CL team with the highest
+   score is selected by ucc_collective_init */
+static ucc_status_t ucc_team_build_score_map(ucc_team_t *team)
+{
+    ucc_coll_score_t *score, *score_next, *score_merge;
+    ucc_cl_iface_t   *cl_iface;
+    ucc_status_t      status;
+    int               i;
+
+    cl_iface = UCC_CL_TEAM_IFACE(team->cl_teams[0]);
+    status   = cl_iface->team.get_scores(&team->cl_teams[0]->super, &score);
+    if (UCC_OK != status) {
+        ucc_error("failed to get CL %s scores", cl_iface->super.name);
+        return status;
+    }
+    for (i = 1; i < team->n_cl_teams; i++) {
+        cl_iface = UCC_CL_TEAM_IFACE(team->cl_teams[i]);
+        status   = cl_iface->team.get_scores(&team->cl_teams[i]->super,
+                                             &score_next);
+        if (UCC_OK != status) {
+            ucc_error("failed to get CL %s scores", cl_iface->super.name);
+            ucc_coll_score_free(score);
+            return status;
+        }
+        status = ucc_coll_score_merge(score, score_next, &score_merge, 1);
+        if (UCC_OK != status) {
+            ucc_error("failed to merge CL scores");
+            return status;
+        }
+        score = score_merge;
+    }
+    status = ucc_coll_score_build_map(score, &team->score_map);
+    if (UCC_OK != status) {
+        ucc_error("failed to build team score map");
+        ucc_coll_score_free(score);
+    }
+    return status;
+}
+
 static inline ucc_status_t ucc_team_exchange(ucc_context_t *context,
                                              ucc_team_t *   team)
 {
@@ -301,11 +348,15 @@ ucc_status_t ucc_team_create_test_single(ucc_context_t *context,
         }
     case UCC_TEAM_CL_CREATE:
         status = ucc_team_create_cls(context, team);
+        if (UCC_OK != status) {
+            goto out;
+        }
+        status = ucc_team_build_score_map(team);
     }
 out:
     team->status = status;
-    /* TODO: add team/coll selection and check if some teams are never
-             used after selection and clean them up */
+    /* TODO: check if some CL teams are never selected by the score map
+             and clean them up */
     return status;
 }
 
@@ -346,6 +397,10 @@ static ucc_status_t ucc_team_destroy_single(ucc_team_h team)
         }
         team->cl_teams[i] = NULL;
     }
+    if (team->score_map) {
+        ucc_coll_score_free_map(team->score_map);
+        team->score_map = NULL;
+    }
     /* ucc_topo_cleanup(team->topo); */
     ucc_free(team->addr_storage.storage);
     ucc_free(team->ctx_ranks);
@@ -16,6 +16,7 @@ typedef struct ucc_context ucc_context_t;
 typedef struct ucc_cl_team ucc_cl_team_t;
 typedef struct ucc_tl_team ucc_tl_team_t;
 typedef struct ucc_coll_task ucc_coll_task_t;
+typedef struct ucc_score_map ucc_score_map_t;
 typedef enum {
     UCC_TEAM_ADDR_EXCHANGE,
     UCC_TEAM_SERVICE_TEAM,
@@ -42,6 +43,8 @@ typedef struct ucc_team {
     void *             oob_req;
     ucc_ep_map_t       ctx_map; /*< map to the ctx ranks, defined if CTX
                                   type is global (oob provided) */
+    ucc_score_map_t *  score_map; /*< merged scores of all CL teams, used
+                                    to select CL team for a collective */
 } ucc_team_t;
 
 /* If the bit is set then team_id is provided by the user */
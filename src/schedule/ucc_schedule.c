@@ -4,6 +4,8 @@
  */
 #include "ucc_schedule.h"
 #include "utils/ucc_compiler_def.h"
+#include "utils/ucc_malloc.h"
+#include <string.h>
 
 ucc_status_t ucc_event_manager_init(ucc_event_manager_t *em)
 {
@@ -81,26 +83,89 @@ ucc_status_t ucc_schedule_init(ucc_schedule_t *schedule, ucc_context_t *ctx)
     schedule->n_completed_tasks = 0;
     schedule->ctx               = ctx;
     schedule->n_tasks           = 0;
+    schedule->max_tasks         = UCC_SCHEDULE_N_INLINE_TASKS;
+    schedule->tasks             = schedule->tasks_inline;
     return status;
 }
 
-void ucc_schedule_add_task(ucc_schedule_t *schedule, ucc_coll_task_t *task)
+static ucc_status_t ucc_schedule_grow(ucc_schedule_t *schedule)
 {
+    int               max_tasks = 2 * schedule->max_tasks;
+    ucc_coll_task_t **tasks;
+
+    if (schedule->tasks == schedule->tasks_inline) {
+        tasks = ucc_malloc(max_tasks * sizeof(*tasks), "schedule_tasks");
+        if (tasks) {
+            memcpy(tasks, schedule->tasks_inline,
+                   schedule->n_tasks * sizeof(*tasks));
+        }
+    } else {
+        tasks = ucc_realloc(schedule->tasks, max_tasks * sizeof(*tasks),
+                            "schedule_tasks");
+    }
+    if (ucc_unlikely(!tasks)) {
+        ucc_error("failed to allocate %zd bytes for schedule tasks",
+                  max_tasks * sizeof(*tasks));
+        return UCC_ERR_NO_MEMORY;
+    }
+    schedule->tasks     = tasks;
+    schedule->max_tasks = max_tasks;
+    return UCC_OK;
+}
+
+/* On error the task is not added: it is finalized by the caller */
+ucc_status_t ucc_schedule_add_task(ucc_schedule_t  *schedule,
+                                   ucc_coll_task_t *task)
+{
+    ucc_status_t status;
+
+    if (ucc_unlikely(schedule->n_tasks == schedule->max_tasks)) {
+        status = ucc_schedule_grow(schedule);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
     ucc_event_manager_subscribe(&task->em, UCC_EVENT_COMPLETED,
                                 &schedule->super);
     ucc_event_manager_subscribe(&task->em, UCC_EVENT_ERROR,
                                 &schedule->super);
-    task->schedule = schedule;
-    schedule->n_tasks++;
+    task->schedule                       = schedule;
+    schedule->tasks[schedule->n_tasks++] = task;
+    return UCC_OK;
 }
 
 ucc_status_t ucc_schedule_start(ucc_schedule_t *schedule)
 {
+    schedule->n_completed_tasks  = 0;
     schedule->super.super.status = UCC_INPROGRESS;
     return ucc_event_manager_notify(&schedule->super,
                                     UCC_EVENT_SCHEDULE_STARTED);
 }
 
+/* Finalizes all the tasks of the schedule, the schedule itself is released
+   by the caller */
+ucc_status_t ucc_schedule_finalize(ucc_coll_task_t *task)
+{
+    ucc_schedule_t *schedule = ucc_derived_of(task, ucc_schedule_t);
+    ucc_status_t    status   = UCC_OK;
+    ucc_status_t    st;
+    int             i;
+
+    for (i = 0; i < schedule->n_tasks; i++) {
+        st = schedule->tasks[i]->finalize(schedule->tasks[i]);
+        if (ucc_unlikely(UCC_OK != st)) {
+            status = st;
+        }
+    }
+    schedule->n_tasks = 0;
+    if (schedule->tasks != schedule->tasks_inline) {
+        ucc_free(schedule->tasks);
+        schedule->tasks     = schedule->tasks_inline;
+        schedule->max_tasks = UCC_SCHEDULE_N_INLINE_TASKS;
+    }
+    return status;
+}
+
 ucc_status_t ucc_task_start_handler(ucc_coll_task_t *parent, /* NOLINT */
                                     ucc_coll_task_t *task)
 {
@@ -11,6 +11,8 @@
 #include "utils/ucc_lock_free_queue.h"
 
 #define MAX_LISTENERS 4
+/* tasks stored in the schedule itself, more tasks go to an allocated array */
+#define UCC_SCHEDULE_N_INLINE_TASKS 16
 
 typedef enum {
     UCC_EVENT_COMPLETED = 0,
@@ -33,8 +35,11 @@ typedef struct ucc_event_manager {
 } ucc_event_manager_t;
 
 enum {
-    UCC_COLL_TASK_FLAG_INTERNAL = UCC_BIT(0),
-    UCC_COLL_TASK_FLAG_CB       = UCC_BIT(1)
+    UCC_COLL_TASK_FLAG_INTERNAL     = UCC_BIT(0),
+    UCC_COLL_TASK_FLAG_CB           = UCC_BIT(1),
+    /* task is progressed by the progress queue only when it is runnable */
+    UCC_COLL_TASK_FLAG_EVENT_DRIVEN = UCC_BIT(2),
+    UCC_COLL_TASK_FLAG_RUNNABLE     = UCC_BIT(3)
 };
 
 typedef struct ucc_coll_task {
@@ -61,11 +66,17 @@ typedef struct ucc_coll_task {
 } ucc_coll_task_t;
 
 typedef struct ucc_context ucc_context_t;
+/* A schedule owns its tasks: they are finalized together with the schedule
+   by ucc_schedule_finalize, so a completed schedule can be posted again
+   (persistent collectives) */
 typedef struct ucc_schedule {
-    ucc_coll_task_t super;
-    int             n_completed_tasks;
-    int             n_tasks;
-    ucc_context_t  *ctx;
+    ucc_coll_task_t   super;
+    int               n_completed_tasks;
+    int               n_tasks;
+    int               max_tasks;
+    ucc_context_t    *ctx;
+    ucc_coll_task_t **tasks; /* tasks_inline or allocated when it is full */
+    ucc_coll_task_t  *tasks_inline[UCC_SCHEDULE_N_INLINE_TASKS];
 } ucc_schedule_t;
 
 ucc_status_t ucc_event_manager_init(ucc_event_manager_t *em);
@@ -75,8 +86,12 @@ void ucc_event_manager_subscribe(ucc_event_manager_t *em, ucc_event_t event,
 ucc_status_t ucc_event_manager_notify(ucc_coll_task_t *parent_task,
                                       ucc_event_t event);
 ucc_status_t ucc_schedule_init(ucc_schedule_t *schedule, ucc_context_t *ctx);
-void ucc_schedule_add_task(ucc_schedule_t *schedule, ucc_coll_task_t *task);
+/* Fails only if the schedule already has UCC_SCHEDULE_N_INLINE_TASKS tasks
+   and the larger task array can not be allocated */
+ucc_status_t ucc_schedule_add_task(ucc_schedule_t  *schedule,
+                                   ucc_coll_task_t *task);
 ucc_status_t ucc_schedule_start(ucc_schedule_t *schedule);
+ucc_status_t ucc_schedule_finalize(ucc_coll_task_t *task);
 ucc_status_t ucc_task_start_handler(ucc_coll_task_t *parent,
                                     ucc_coll_task_t *task);
 
@@ -110,4 +125,13 @@ static inline ucc_status_t ucc_task_complete(ucc_coll_task_t *task)
     }
     return status;
 }
+
+/* Called by the transport when there is something new for the task:
+   an event driven task is progressed again on the next queue progress */
+static inline void ucc_coll_task_set_runnable(ucc_coll_task_t *task)
+{
+    if (task->flags & UCC_COLL_TASK_FLAG_EVENT_DRIVEN) {
+        task->flags |= UCC_COLL_TASK_FLAG_RUNNABLE;
+    }
+}
 #endif
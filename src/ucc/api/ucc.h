@@ -196,11 +196,17 @@ typedef enum {
  *
  *  @ref ucc_datatype_t represents the datatypes supported by the UCC library’s
  *  collective and reduction operations. The standard operations are signed and
- *  unsigned integers of various sizes, float 16, 32, and 64, and user-defined
- *  datatypes. The UCC_DT_USERDEFINED represents the user-defined datatype. The
+ *  unsigned integers of various sizes, float 16, 32, and 64, bfloat 16, the
+ *  value-index pairs, and user-defined datatypes. The value-index pairs are
+ *  reduced with UCC_OP_MAXLOC and UCC_OP_MINLOC only, their layout is the one
+ *  of the C structure with the value followed by an int32_t index, e.g.
+ *  struct {double value; int32_t index;} for UCC_DT_FLOAT64_INT32. The
+ *  UCC_DT_USERDEFINED represents the user-defined datatype. The
  *  UCC_DT_OPAQUE is used to represent the user-defined datatypes for
  *  user-defined reductions. When UCC_DT_OPAQUE is used, the library passes the
- *  data to the user-defined reductions without any modifications.
+ *  data to the user-defined reductions without any modifications. New
+ *  datatypes are added after UCC_DT_OPAQUE, the values of the existing ones
+ *  do not change.
  *
  *  @endparblock
  *
@@ -220,7 +226,11 @@ typedef enum {
     UCC_DT_FLOAT32,
     UCC_DT_FLOAT64,
     UCC_DT_USERDEFINED,
-    UCC_DT_OPAQUE
+    UCC_DT_OPAQUE,
+    UCC_DT_BFLOAT16,
+    UCC_DT_FLOAT32_INT32,
+    UCC_DT_FLOAT64_INT32,
+    UCC_DT_INT32_INT32
 } ucc_datatype_t;
 
 /**
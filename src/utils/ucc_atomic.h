@@ -8,6 +8,7 @@
 
 #include "config.h"
 #include <ucs/arch/atomic.h>
+#include <ucs/arch/cpu.h>
 
 #define ucc_atomic_add32          ucs_atomic_add32
 #define ucc_atomic_fadd32         ucs_atomic_fadd32
@@ -17,4 +18,8 @@
 #define ucc_atomic_cswap8         ucs_atomic_cswap8
 #define ucc_atomic_bool_cswap8    ucs_atomic_bool_cswap8
 #define ucc_atomic_bool_cswap64   ucs_atomic_bool_cswap64
+
+#define ucc_memory_cpu_fence       ucs_memory_cpu_fence
+#define ucc_memory_cpu_store_fence ucs_memory_cpu_store_fence
+#define ucc_memory_cpu_load_fence  ucs_memory_cpu_load_fence
 #endif
@@ -152,13 +152,17 @@ size_t ucc_coll_args_msgsize(const ucc_base_coll_args_t *bargs)
         return args->src.info.count * ucc_dt_size(args->src.info.datatype);
     case UCC_COLL_TYPE_ALLTOALL:
     case UCC_COLL_TYPE_ALLGATHER:
-    case UCC_COLL_TYPE_REDUCE_SCATTER:
         return args->dst.info.count * ucc_dt_size(args->dst.info.datatype);
+    /* dst holds the block of the rank only, report the size of the whole
+       reduced vector as for allreduce */
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        return args->dst.info.count * team->size *
+               ucc_dt_size(args->dst.info.datatype);
     case UCC_COLL_TYPE_ALLGATHERV:
     case UCC_COLL_TYPE_REDUCE_SCATTERV:
         return ucc_coll_args_get_total_count(args, args->dst.info_v.counts,
                                              team->size) *
-               ucc_dt_size(args->dst.info.datatype);
+               ucc_dt_size(args->dst.info_v.datatype);
     case UCC_COLL_TYPE_ALLTOALLV:
     case UCC_COLL_TYPE_GATHERV:
     case UCC_COLL_TYPE_SCATTERV:
@@ -172,16 +176,19 @@ size_t ucc_coll_args_msgsize(const ucc_base_coll_args_t *bargs)
                    ? args->dst.info.count * ucc_dt_size(args->dst.info.datatype)
                    : args->src.info.count *
                          ucc_dt_size(args->src.info.datatype);
+    /* Non root ranks only know the size of their own block: scale it by the
+       team size so that all ranks select the algorithm by the same total
+       message size */
     case UCC_COLL_TYPE_GATHER:
         return (root == team->rank)
                    ? args->dst.info.count * ucc_dt_size(args->dst.info.datatype)
-                   : args->src.info.count * ucc_dt_size(args->src.info.datatype);
-//TODO should we multiply it by team_size ?
+                   : args->src.info.count * team->size *
+                         ucc_dt_size(args->src.info.datatype);
     case UCC_COLL_TYPE_SCATTER:
         return (root == team->rank)
                    ? args->src.info.count * ucc_dt_size(args->src.info.datatype)
-                   : args->dst.info.count * ucc_dt_size(args->dst.info.datatype);
-//TODO should we multiply it by team_size ?
+                   : args->dst.info.count * team->size *
+                         ucc_dt_size(args->dst.info.datatype);
     default:
         break;
     }
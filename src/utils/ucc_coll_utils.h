@@ -71,6 +71,30 @@ ucc_coll_args_get_total_count(const ucc_coll_args_t *args,
 
     return count;
 }
+/* Splits a buffer of "total_count" elements into "n_blocks" contiguous blocks
+   whose sizes differ by at most one element: the first
+   (total_count % n_blocks) blocks get the extra element. */
+static inline size_t ucc_buffer_block_count(size_t total_count,
+                                            ucc_rank_t n_blocks,
+                                            ucc_rank_t block)
+{
+    size_t block_count = total_count / n_blocks;
+    size_t left        = total_count % n_blocks;
+
+    return (block < left) ? block_count + 1 : block_count;
+}
+
+static inline size_t ucc_buffer_block_offset(size_t total_count,
+                                             ucc_rank_t n_blocks,
+                                             ucc_rank_t block)
+{
+    size_t block_count = total_count / n_blocks;
+    size_t left        = total_count % n_blocks;
+    size_t offset      = block * block_count + left;
+
+    return (block < left) ? offset - (left - block) : offset;
+}
+
 typedef struct ucc_base_coll_args ucc_base_coll_args_t;
 
 ucc_coll_type_t   ucc_coll_type_from_str(const char *str);
@@ -76,6 +76,14 @@ static inline const char* ucc_coll_type_str(ucc_coll_type_t ct)
         return "Fanin";
     case UCC_COLL_TYPE_FANOUT:
         return "Fanout";
+    case UCC_COLL_TYPE_GATHERV:
+        return "Gatherv";
+    case UCC_COLL_TYPE_SCATTERV:
+        return "Scatterv";
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        return "Reduce_scatter";
+    case UCC_COLL_TYPE_REDUCE_SCATTERV:
+        return "Reduce_scatterv";
     default:
         break;
     }
@@ -95,6 +103,14 @@ static inline const char* ucc_datatype_str(ucc_datatype_t dt)
         return "uint16";
     case UCC_DT_FLOAT16:
         return "float16";
+    case UCC_DT_BFLOAT16:
+        return "bfloat16";
+    case UCC_DT_FLOAT32_INT32:
+        return "float32_int32";
+    case UCC_DT_FLOAT64_INT32:
+        return "float64_int32";
+    case UCC_DT_INT32_INT32:
+        return "int32_int32";
     case UCC_DT_INT32:
         return "int32";
     case UCC_DT_UINT32:
@@ -6,18 +6,23 @@
 #include "ucc/api/ucc.h"
 #include "ucc_math.h"
 
-size_t ucc_dt_sizes[UCC_DT_USERDEFINED] = {
-    [UCC_DT_INT8]    = 1,
-    [UCC_DT_UINT8]   = 1,
-    [UCC_DT_INT16]   = 2,
-    [UCC_DT_UINT16]  = 2,
-    [UCC_DT_FLOAT16] = 2,
-    [UCC_DT_INT32]   = 4,
-    [UCC_DT_UINT32]  = 4,
-    [UCC_DT_FLOAT32] = 4,
-    [UCC_DT_INT64]   = 8,
-    [UCC_DT_UINT64]  = 8,
-    [UCC_DT_FLOAT64] = 8,
-    [UCC_DT_INT128]  = 16,
-    [UCC_DT_UINT128] = 16,
+size_t ucc_dt_sizes[UCC_DT_LAST] = {
+    [UCC_DT_INT8]          = 1,
+    [UCC_DT_UINT8]         = 1,
+    [UCC_DT_INT16]         = 2,
+    [UCC_DT_UINT16]        = 2,
+    [UCC_DT_FLOAT16]       = 2,
+    [UCC_DT_BFLOAT16]      = 2,
+    [UCC_DT_INT32]         = 4,
+    [UCC_DT_UINT32]        = 4,
+    [UCC_DT_FLOAT32]       = 4,
+    [UCC_DT_INT64]         = 8,
+    [UCC_DT_UINT64]        = 8,
+    [UCC_DT_FLOAT64]       = 8,
+    [UCC_DT_INT128]        = 16,
+    [UCC_DT_UINT128]       = 16,
+    /* value-index pairs, with the padding of the C structure */
+    [UCC_DT_FLOAT32_INT32] = 8,
+    [UCC_DT_FLOAT64_INT32] = 16,
+    [UCC_DT_INT32_INT32]   = 8,
 };
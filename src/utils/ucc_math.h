@@ -14,6 +14,8 @@
 #define ucc_min(_a, _b) ucs_min((_a), (_b))
 #define ucc_max(_a, _b) ucs_max((_a), (_b))
 #define ucc_ilog2(_v)   ucs_ilog2((_v))
+#define ucc_is_pow2(_n) ucs_is_pow2((_n))
+#define ucc_align_up(_n, _alignment) ucs_align_up((_n), (_alignment))
 
 #define DO_OP_MAX(_v1, _v2) (_v1 > _v2 ? _v1 : _v2)
 #define DO_OP_MIN(_v1, _v2) (_v1 < _v2 ? _v1 : _v2)
@@ -26,16 +28,36 @@
 #define DO_OP_LXOR(_v1, _v2) ((!_v1) != (!_v2))
 #define DO_OP_BXOR(_v1, _v2) (_v1 ^ _v2)
 
-extern size_t ucc_dt_sizes[UCC_DT_USERDEFINED];
+/* One past the last predefined datatype: the datatypes added after
+   UCC_DT_OPAQUE follow it in ucc_datatype_t */
+#define UCC_DT_LAST (UCC_DT_INT32_INT32 + 1)
+
+/* size is 0 for UCC_DT_USERDEFINED and UCC_DT_OPAQUE */
+extern size_t ucc_dt_sizes[UCC_DT_LAST];
 static inline size_t ucc_dt_size(ucc_datatype_t dt)
 {
-    if (ucc_likely(dt < UCC_DT_USERDEFINED)) {
+    if (ucc_likely(dt < UCC_DT_LAST)) {
         return ucc_dt_sizes[dt];
     }
     // TODO remove ucc_likely once custom datatype is implemented
     return 0;
 }
 
+static inline int ucc_dt_is_loc_pair(ucc_datatype_t dt)
+{
+    return (dt == UCC_DT_FLOAT32_INT32) || (dt == UCC_DT_FLOAT64_INT32) ||
+           (dt == UCC_DT_INT32_INT32);
+}
+
+/* MAXLOC and MINLOC reduce the value-index pairs, the pairs can't be reduced
+   by the other ops */
+static inline int ucc_reduction_op_dt_valid(ucc_reduction_op_t op,
+                                            ucc_datatype_t     dt)
+{
+    return ((op == UCC_OP_MAXLOC) || (op == UCC_OP_MINLOC)) ==
+           ucc_dt_is_loc_pair(dt);
+}
+
 
 #define PTR_OFFSET(_ptr, _offset)                                              \
     ((void *)((ptrdiff_t)(_ptr) + (size_t)(_offset)))
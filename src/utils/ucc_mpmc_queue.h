@@ -0,0 +1,126 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_MPMC_QUEUE_H_
+#define UCC_MPMC_QUEUE_H_
+
+#include "config.h"
+#include "utils/ucc_atomic.h"
+#include "utils/ucc_compiler_def.h"
+#include <stdlib.h>
+
+/* Bounded multi producer multi consumer queue (D. Vyukov): a ring of cells,
+   every cell carries a sequence number telling whether it is ready for the
+   enqueue of position pos (seq == pos) or for the dequeue of position pos
+   (seq == pos + 1). Producers and consumers only contend on the cswap of
+   their own position counter, cells are padded to a cache line. The queue
+   never blocks: enqueue fails when the queue is full and dequeue returns
+   NULL when it is empty. This data structure is thread safe */
+
+typedef struct ucc_mpmc_cell {
+    volatile uint64_t seq;
+    void             *data;
+} ucc_mpmc_cell_t;
+
+typedef union ucc_mpmc_slot {
+    ucc_mpmc_cell_t cell;
+    char            pad[UCC_CACHE_LINE_SIZE];
+} ucc_mpmc_slot_t;
+
+typedef struct ucc_mpmc_queue {
+    ucc_mpmc_slot_t  *slots;
+    uint64_t          mask;
+    char              pad0[UCC_CACHE_LINE_SIZE];
+    volatile uint64_t enq_pos;
+    char              pad1[UCC_CACHE_LINE_SIZE - sizeof(uint64_t)];
+    volatile uint64_t deq_pos;
+    char              pad2[UCC_CACHE_LINE_SIZE - sizeof(uint64_t)];
+} ucc_mpmc_queue_t;
+
+/* capacity is rounded up to a power of 2 */
+static inline ucc_status_t ucc_mpmc_queue_init(ucc_mpmc_queue_t *queue,
+                                               uint32_t          capacity)
+{
+    uint64_t size = 1;
+    uint64_t i;
+
+    while (size < capacity) {
+        size <<= 1;
+    }
+    if (0 != posix_memalign((void **)&queue->slots, UCC_CACHE_LINE_SIZE,
+                            size * sizeof(ucc_mpmc_slot_t))) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    for (i = 0; i < size; i++) {
+        queue->slots[i].cell.seq  = i;
+        queue->slots[i].cell.data = NULL;
+    }
+    queue->mask    = size - 1;
+    queue->enq_pos = 0;
+    queue->deq_pos = 0;
+    return UCC_OK;
+}
+
+static inline void ucc_mpmc_queue_destroy(ucc_mpmc_queue_t *queue)
+{
+    free(queue->slots);
+}
+
+static inline ucc_status_t ucc_mpmc_queue_enqueue(ucc_mpmc_queue_t *queue,
+                                                  void             *data)
+{
+    uint64_t         pos = queue->enq_pos;
+    ucc_mpmc_cell_t *cell;
+    int64_t          diff;
+
+    for (;;) {
+        cell = &queue->slots[pos & queue->mask].cell;
+        diff = (int64_t)cell->seq - (int64_t)pos;
+        ucc_memory_cpu_load_fence();
+        if (diff == 0) {
+            if (ucc_atomic_bool_cswap64((uint64_t *)&queue->enq_pos, pos,
+                                        pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* the cell is not consumed yet since the previous round */
+            return UCC_ERR_NO_RESOURCE;
+        }
+        pos = queue->enq_pos;
+    }
+    cell->data = data;
+    ucc_memory_cpu_store_fence();
+    cell->seq = pos + 1;
+    return UCC_OK;
+}
+
+static inline void *ucc_mpmc_queue_dequeue(ucc_mpmc_queue_t *queue)
+{
+    uint64_t         pos = queue->deq_pos;
+    ucc_mpmc_cell_t *cell;
+    int64_t          diff;
+    void            *data;
+
+    for (;;) {
+        cell = &queue->slots[pos & queue->mask].cell;
+        diff = (int64_t)cell->seq - (int64_t)(pos + 1);
+        ucc_memory_cpu_load_fence();
+        if (diff == 0) {
+            if (ucc_atomic_bool_cswap64((uint64_t *)&queue->deq_pos, pos,
+                                        pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return NULL;
+        }
+        pos = queue->deq_pos;
+    }
+    data = cell->data;
+    ucc_memory_cpu_fence();
+    cell->seq = pos + queue->mask + 1;
+    return data;
+}
+
+#endif
@@ -1,6 +1,91 @@
 #include "ucc_mpool.h"
 #include "ucc_malloc.h"
 #include "ucc_log.h"
+#include <pthread.h>
+#include <limits.h>
+
+/* Index of the calling thread in the mpool caches. Indices are process
+   wide and are released at thread exit, so a new thread takes over the
+   caches of an exited one */
+__thread int           ucc_mpool_thread_idx = UCC_MPOOL_THREAD_IDX_INIT;
+static pthread_once_t  ucc_mpool_key_once   = PTHREAD_ONCE_INIT;
+static pthread_key_t   ucc_mpool_key;
+static pthread_mutex_t ucc_mpool_idx_lock   = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t        ucc_mpool_idx_used[UCC_MPOOL_CACHE_MAX_THREADS / 64];
+
+static void ucc_mpool_thread_idx_release(void *arg)
+{
+    int idx = (int)(uintptr_t)arg - 1;
+
+    pthread_mutex_lock(&ucc_mpool_idx_lock);
+    ucc_mpool_idx_used[idx / 64] &= ~UCC_BIT(idx % 64);
+    pthread_mutex_unlock(&ucc_mpool_idx_lock);
+}
+
+static void ucc_mpool_key_create(void)
+{
+    pthread_key_create(&ucc_mpool_key, ucc_mpool_thread_idx_release);
+}
+
+int ucc_mpool_thread_idx_alloc(void)
+{
+    int idx = UCC_MPOOL_THREAD_IDX_NO_CACHE;
+    int i;
+
+    pthread_once(&ucc_mpool_key_once, ucc_mpool_key_create);
+    pthread_mutex_lock(&ucc_mpool_idx_lock);
+    for (i = 0; i < UCC_MPOOL_CACHE_MAX_THREADS; i++) {
+        if (!(ucc_mpool_idx_used[i / 64] & UCC_BIT(i % 64))) {
+            ucc_mpool_idx_used[i / 64] |= UCC_BIT(i % 64);
+            idx = i;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&ucc_mpool_idx_lock);
+    if (idx >= 0) {
+        /* value is idx + 1: the destructor is not called for NULL */
+        pthread_setspecific(ucc_mpool_key, (void *)(uintptr_t)(idx + 1));
+    }
+    ucc_mpool_thread_idx = idx;
+    return idx;
+}
+
+int ucc_mpool_cache_refill(ucc_mpool_t *mp, ucc_mpool_cache_t *cache)
+{
+    ucs_mpool_elem_t *elem;
+    void             *obj;
+    int               i;
+
+    ucc_spin_lock(&mp->lock);
+    for (i = 0; i < UCC_MPOOL_CACHE_BATCH; i++) {
+        obj = ucs_mpool_get(&mp->super);
+        if (!obj) {
+            break;
+        }
+        elem          = (ucs_mpool_elem_t *)obj - 1;
+        elem->next    = cache->c.head;
+        cache->c.head = elem;
+        cache->c.count++;
+    }
+    ucc_spin_unlock(&mp->lock);
+    return cache->c.count;
+}
+
+void ucc_mpool_cache_flush(ucc_mpool_t *mp, ucc_mpool_cache_t *cache,
+                           uint32_t n_objs)
+{
+    ucs_mpool_elem_t *elem;
+
+    ucc_spin_lock(&mp->lock);
+    for (; n_objs > 0 && cache->c.head; n_objs--) {
+        elem          = cache->c.head;
+        cache->c.head = elem->next;
+        cache->c.count--;
+        elem->mpool   = &mp->super;
+        ucs_mpool_put(elem + 1);
+    }
+    ucc_spin_unlock(&mp->lock);
+}
 
 static ucs_status_t
 ucc_mpool_chunk_alloc_wrapper(ucs_mpool_t *mp, size_t *size_p, void **chunk_p)
@@ -37,12 +122,26 @@ ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
                             const char *name)
 {
     ucs_mpool_ops_t *ucs_ops = ucc_malloc(sizeof(*ucs_ops), "mpool_ops");
+    ucc_status_t     status;
+
     if (!ucs_ops) {
         ucc_error("failed to allocate %zd bytes for mpool ucs ops",
                   sizeof(*ucs_ops));
         return UCC_ERR_NO_MEMORY;
     }
 
+    mp->caches = NULL;
+    if (UCC_THREAD_SINGLE != tm && UINT_MAX == max_elems) {
+        if (0 != posix_memalign((void **)&mp->caches, UCC_CACHE_LINE_SIZE,
+                                UCC_MPOOL_CACHE_MAX_THREADS *
+                                sizeof(ucc_mpool_cache_t))) {
+            ucc_error("failed to allocate mpool caches");
+            ucc_free(ucs_ops);
+            return UCC_ERR_NO_MEMORY;
+        }
+        memset(mp->caches, 0,
+               UCC_MPOOL_CACHE_MAX_THREADS * sizeof(ucc_mpool_cache_t));
+    }
     ucc_spinlock_init(&mp->lock, 0);
     mp->tm                 = tm;
     mp->ucc_ops            = ops;
@@ -57,14 +156,28 @@ ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
         ucs_ops->obj_cleanup = ucc_mpool_obj_cleanup_wrapper;
     }
 
-    return ucs_status_to_ucc_status(
+    status = ucs_status_to_ucc_status(
         ucs_mpool_init(&mp->super, priv_size, elem_size, align_offset,
                        alignment, elems_per_chunk, max_elems, ucs_ops, name));
+    if (UCC_OK != status) {
+        free(mp->caches);
+        ucc_free(ucs_ops);
+    }
+    return status;
 }
 
 void ucc_mpool_cleanup(ucc_mpool_t *mp, int leak_check)
 {
     ucs_mpool_ops_t *ops = mp->super.data->ops;
+    int              i;
+
+    if (mp->caches) {
+        /* cached objects are free: return them before the leak check */
+        for (i = 0; i < UCC_MPOOL_CACHE_MAX_THREADS; i++) {
+            ucc_mpool_cache_flush(mp, &mp->caches[i], UINT_MAX);
+        }
+        free(mp->caches);
+    }
     ucs_mpool_cleanup(&mp->super, leak_check);
     ucc_free(ops);
     ucc_spinlock_destroy(&mp->lock);
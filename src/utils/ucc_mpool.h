@@ -14,6 +14,29 @@
 
 typedef struct ucc_mpool ucc_mpool_t;
 
+/* Per thread caches of multithreaded unbounded mpools: a thread gets and
+   puts objects to its own cache without locking, the cache is refilled
+   from and flushed to the shared pool UCC_MPOOL_CACHE_BATCH objects at a
+   time under the mpool lock. Bounded mpools (max_elems != UINT_MAX) are
+   not cached: their few elements would be stuck in the idle threads */
+#define UCC_MPOOL_CACHE_MAX_THREADS 128
+#define UCC_MPOOL_CACHE_SIZE        32
+#define UCC_MPOOL_CACHE_BATCH       16
+
+/* ucc_mpool_thread_idx values besides the cache index */
+#define UCC_MPOOL_THREAD_IDX_INIT     -1
+#define UCC_MPOOL_THREAD_IDX_NO_CACHE -2
+
+typedef union ucc_mpool_cache {
+    struct {
+        ucs_mpool_elem_t *head; /* free objects linked through elem->next */
+        uint32_t          count;
+    } c;
+    char pad[UCC_CACHE_LINE_SIZE];
+} ucc_mpool_cache_t;
+
+extern __thread int ucc_mpool_thread_idx;
+
 typedef struct ucc_mpool_ops {
     ucc_status_t (*chunk_alloc)(ucc_mpool_t *mp, size_t *size_p,
                                 void **chunk_p);
@@ -23,10 +46,11 @@ typedef struct ucc_mpool_ops {
 } ucc_mpool_ops_t;
 
 struct ucc_mpool {
-    ucs_mpool_t       super;
-    ucc_mpool_ops_t * ucc_ops;
-    ucc_thread_mode_t tm;
-    ucc_spinlock_t    lock;
+    ucs_mpool_t        super;
+    ucc_mpool_ops_t *  ucc_ops;
+    ucc_thread_mode_t  tm;
+    ucc_spinlock_t     lock;
+    ucc_mpool_cache_t *caches; /* NULL if not cached */
 };
 
 ucc_status_t ucc_mpool_init(ucc_mpool_t *mp, size_t priv_size, size_t elem_size,
@@ -42,13 +66,47 @@ ucc_status_t ucc_mpool_hugetlb_malloc(ucc_mpool_t *mp, size_t *size_p,
 
 void ucc_mpool_hugetlb_free(ucc_mpool_t *mp, void *chunk);
 
+int ucc_mpool_thread_idx_alloc(void);
+
+int ucc_mpool_cache_refill(ucc_mpool_t *mp, ucc_mpool_cache_t *cache);
+
+void ucc_mpool_cache_flush(ucc_mpool_t *mp, ucc_mpool_cache_t *cache,
+                           uint32_t n_objs);
+
+static inline ucc_mpool_cache_t *ucc_mpool_get_cache(ucc_mpool_t *mp)
+{
+    int idx = ucc_mpool_thread_idx;
+
+    if (!mp->caches) {
+        return NULL;
+    }
+    if (ucc_unlikely(idx == UCC_MPOOL_THREAD_IDX_INIT)) {
+        idx = ucc_mpool_thread_idx_alloc();
+    }
+    return (idx >= 0) ? &mp->caches[idx] : NULL;
+}
+
 static inline void *ucc_mpool_get(ucc_mpool_t *mp)
 {
-    void *ret;
+    ucc_mpool_cache_t *cache;
+    ucs_mpool_elem_t  *elem;
+    void              *ret;
 
     if (UCC_THREAD_SINGLE == mp->tm) {
         return ucs_mpool_get(&mp->super);
     }
+    cache = ucc_mpool_get_cache(mp);
+    if (ucc_likely(cache != NULL)) {
+        if (ucc_unlikely(!cache->c.count) &&
+            !ucc_mpool_cache_refill(mp, cache)) {
+            return NULL;
+        }
+        elem          = cache->c.head;
+        cache->c.head = elem->next;
+        cache->c.count--;
+        elem->mpool   = &mp->super;
+        return elem + 1;
+    }
     ucc_spin_lock(&mp->lock);
     ret = ucs_mpool_get(&mp->super);
     ucc_spin_unlock(&mp->lock);
@@ -57,13 +115,24 @@ static inline void *ucc_mpool_get(ucc_mpool_t *mp)
 
 static inline void ucc_mpool_put(void *obj)
 {
-    ucs_mpool_elem_t *elem = (ucs_mpool_elem_t *)obj - 1;
-    ucc_mpool_t *     mp   = ucc_derived_of(elem->mpool, ucc_mpool_t);
+    ucs_mpool_elem_t  *elem = (ucs_mpool_elem_t *)obj - 1;
+    ucc_mpool_t *      mp   = ucc_derived_of(elem->mpool, ucc_mpool_t);
+    ucc_mpool_cache_t *cache;
 
     if (UCC_THREAD_SINGLE == mp->tm) {
         ucs_mpool_put(obj);
         return;
     }
+    cache = ucc_mpool_get_cache(mp);
+    if (ucc_likely(cache != NULL)) {
+        if (ucc_unlikely(cache->c.count == UCC_MPOOL_CACHE_SIZE)) {
+            ucc_mpool_cache_flush(mp, cache, UCC_MPOOL_CACHE_BATCH);
+        }
+        elem->next    = cache->c.head;
+        cache->c.head = elem;
+        cache->c.count++;
+        return;
+    }
     ucc_spin_lock(&mp->lock);
     ucs_mpool_put(obj);
     ucc_spin_unlock(&mp->lock);
@@ -30,6 +30,7 @@ typedef ucs_config_global_list_entry_t ucc_config_global_list_entry_t;
 #define UCC_CONFIG_TYPE_STRING          UCS_CONFIG_TYPE_STRING
 #define UCC_CONFIG_TYPE_INT             UCS_CONFIG_TYPE_INT
 #define UCC_CONFIG_TYPE_UINT            UCS_CONFIG_TYPE_UINT
+#define UCC_CONFIG_TYPE_BOOL            UCS_CONFIG_TYPE_BOOL
 #define UCC_CONFIG_TYPE_STRING_ARRAY    UCS_CONFIG_TYPE_STRING_ARRAY
 #define UCC_CONFIG_TYPE_ARRAY           UCS_CONFIG_TYPE_ARRAY
 #define UCC_CONFIG_TYPE_TABLE           UCS_CONFIG_TYPE_TABLE
@@ -37,6 +38,8 @@ typedef ucs_config_global_list_entry_t ucc_config_global_list_entry_t;
 #define UCC_CONFIG_TYPE_ENUM            UCS_CONFIG_TYPE_ENUM
 #define UCC_CONFIG_TYPE_MEMUNITS        UCS_CONFIG_TYPE_MEMUNITS
 #define UCC_ULUNITS_AUTO                UCS_ULUNITS_AUTO
+#define UCC_MEMUNITS_AUTO               UCS_MEMUNITS_AUTO
+#define UCC_MEMUNITS_INF                UCS_MEMUNITS_INF
 #define UCC_CONFIG_TYPE_BITMAP          UCS_CONFIG_TYPE_BITMAP
 #define UCC_CONFIG_TYPE_MEMUNITS        UCS_CONFIG_TYPE_MEMUNITS
 
@@ -0,0 +1,169 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ * See file LICENSE for terms.
+ */
+#include "test_score.h"
+#include <chrono>
+
+class test_score_map : public test_score {
+  public:
+    ucc_score_map_t     *map;
+    ucc_base_coll_args_t args;
+    void                 SetUp() override
+    {
+        ucc_coll_score_t *score;
+
+        test_score::SetUp();
+        ASSERT_EQ(UCC_OK, ucc_coll_score_alloc(&score));
+        /* uint64_t "init"/"team" values are used to identify the range */
+        for (auto i = 0; i < n_ranges; i++) {
+            ASSERT_EQ(UCC_OK,
+                      ucc_coll_score_add_range(
+                          score, UCC_COLL_TYPE_ALLREDUCE, UCC_MEMORY_TYPE_HOST,
+                          i * range_step, i * range_step + range_len, 10,
+                          (ucc_base_coll_init_fn_t)(uint64_t)(i + 1),
+                          (ucc_base_team_t *)(uint64_t)(i + 1)));
+        }
+        ASSERT_EQ(UCC_OK, ucc_coll_score_build_map(score, &map));
+        memset(&args, 0, sizeof(args));
+        args.args.coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+        args.args.src.info.datatype = UCC_DT_INT8;
+        args.args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        args.args.dst.info          = args.args.src.info;
+    }
+    void TearDown() override
+    {
+        ucc_coll_score_free_map(map);
+        test_score::TearDown();
+    }
+    void set_msgsize(size_t msgsize)
+    {
+        args.args.src.info.count = msgsize;
+        args.args.dst.info.count = msgsize;
+    }
+    /* The reference: linear walk over the range list of the score */
+    ucc_status_t list_lookup(ucc_coll_score_t *score, size_t msgsize,
+                             ucc_base_coll_init_fn_t *init)
+    {
+        ucc_msg_range_t *range;
+
+        ucc_list_for_each(range, &score->scores[ucc_ilog2(
+                                     UCC_COLL_TYPE_ALLREDUCE)]
+                                     [UCC_MEMORY_TYPE_HOST], list_elem) {
+            if (msgsize >= range->start && msgsize < range->end) {
+                *init = range->init;
+                return UCC_OK;
+            }
+        }
+        return UCC_ERR_NOT_FOUND;
+    }
+    /* the map keeps the score it was built from, same ranges as in SetUp
+       are used as a reference */
+    ucc_status_t ref_score(ucc_coll_score_t **score)
+    {
+        ucc_status_t status;
+
+        status = ucc_coll_score_alloc(score);
+        for (auto i = 0; i < n_ranges && UCC_OK == status; i++) {
+            status = ucc_coll_score_add_range(
+                *score, UCC_COLL_TYPE_ALLREDUCE, UCC_MEMORY_TYPE_HOST,
+                i * range_step, i * range_step + range_len, 10,
+                (ucc_base_coll_init_fn_t)(uint64_t)(i + 1), NULL);
+        }
+        return status;
+    }
+    /* detailed TUNE string: every range covers [i*step, i*step + len) */
+    static const int    n_ranges   = 64;
+    static const size_t range_step = 1024;
+    static const size_t range_len  = 1000;
+};
+
+UCC_TEST_F(test_score_map, lookup)
+{
+    ucc_base_coll_init_fn_t init;
+    ucc_base_team_t        *team;
+
+    for (auto i = 0; i < n_ranges; i++) {
+        set_msgsize(i * range_step);
+        EXPECT_EQ(UCC_OK, ucc_coll_score_map_lookup(map, &args, &init, &team));
+        EXPECT_EQ(i + 1, (uint64_t)init);
+        EXPECT_EQ(i + 1, (uint64_t)team);
+        set_msgsize(i * range_step + range_len - 1);
+        EXPECT_EQ(UCC_OK, ucc_coll_score_map_lookup(map, &args, &init, &team));
+        EXPECT_EQ(i + 1, (uint64_t)init);
+        /* gap between the ranges */
+        set_msgsize(i * range_step + range_len);
+        EXPECT_EQ(UCC_ERR_NOT_FOUND,
+                  ucc_coll_score_map_lookup(map, &args, &init, &team));
+    }
+    /* no ranges for the coll type */
+    args.args.coll_type = UCC_COLL_TYPE_BCAST;
+    set_msgsize(0);
+    EXPECT_EQ(UCC_ERR_NOT_FOUND,
+              ucc_coll_score_map_lookup(map, &args, &init, &team));
+}
+
+/* The map lookup finds the same range as the list walk used before */
+UCC_TEST_F(test_score_map, lookup_vs_list)
+{
+    const size_t            max_size = n_ranges * range_step;
+    ucc_coll_score_t       *score;
+    ucc_base_coll_init_fn_t init, init_ref;
+    ucc_base_team_t        *team;
+    size_t                  msgsize;
+
+    ASSERT_EQ(UCC_OK, ref_score(&score));
+    for (msgsize = 0; msgsize < max_size; msgsize += 97) {
+        set_msgsize(msgsize);
+        init     = NULL;
+        init_ref = NULL;
+        EXPECT_EQ(list_lookup(score, msgsize, &init_ref),
+                  ucc_coll_score_map_lookup(map, &args, &init, &team));
+        EXPECT_EQ(init_ref, init);
+    }
+    ucc_coll_score_free(score);
+}
+
+/* Benchmark, not run by default (--gtest_also_run_disabled_tests): prints
+   the average time of a single map lookup and list walk */
+UCC_TEST_F(test_score_map, DISABLED_lookup_perf)
+{
+    const int               n_iters  = 100000;
+    const size_t            max_size = n_ranges * range_step;
+    ucc_coll_score_t       *score;
+    ucc_base_coll_init_fn_t init, init_ref;
+    ucc_base_team_t        *team;
+    uint64_t                sum_map, sum_list;
+
+    ASSERT_EQ(UCC_OK, ref_score(&score));
+    sum_map = 0;
+    auto s  = std::chrono::high_resolution_clock::now();
+    for (auto i = 0; i < n_iters; i++) {
+        set_msgsize((i * 7919) % max_size);
+        if (UCC_OK == ucc_coll_score_map_lookup(map, &args, &init, &team)) {
+            sum_map += (uint64_t)init;
+        }
+    }
+    auto t_map = std::chrono::high_resolution_clock::now() - s;
+
+    sum_list = 0;
+    s        = std::chrono::high_resolution_clock::now();
+    for (auto i = 0; i < n_iters; i++) {
+        set_msgsize((i * 7919) % max_size);
+        if (UCC_OK == list_lookup(score, ucc_coll_args_msgsize(&args),
+                                  &init_ref)) {
+            sum_list += (uint64_t)init_ref;
+        }
+    }
+    auto t_list = std::chrono::high_resolution_clock::now() - s;
+
+    EXPECT_EQ(sum_list, sum_map);
+    std::cout << "score lookup, " << n_ranges << " ranges: map "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(t_map)
+                         .count() / n_iters
+              << " ns, list "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(t_list)
+                         .count() / n_iters
+              << " ns" << std::endl;
+    ucc_coll_score_free(score);
+}
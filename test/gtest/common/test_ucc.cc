@@ -246,6 +246,7 @@ UccJob::UccJob(int _n_procs, ucc_job_ctx_mode_t _ctx_mode, ucc_job_env_t vars) :
 
 {
     ucc_job_env_t env_bkp;
+    std::vector<std::string> env_new;
     char *var;
     for (auto &v : vars) {
         var = std::getenv(v.first.c_str());
@@ -253,6 +254,8 @@ UccJob::UccJob(int _n_procs, ucc_job_ctx_mode_t _ctx_mode, ucc_job_env_t vars) :
             /* found env - back it up for later restore
                after processes creation */
             env_bkp.push_back(ucc_env_var_t(v.first, var));
+        } else {
+            env_new.push_back(v.first);
         }
         setenv(v.first.c_str(), v.second.c_str(), 1);
     }
@@ -265,6 +268,10 @@ UccJob::UccJob(int _n_procs, ucc_job_ctx_mode_t _ctx_mode, ucc_job_env_t vars) :
         /*restore original env */
         setenv(v.first.c_str(), v.second.c_str(), 1);
     }
+    for (auto &v : env_new) {
+        /* don't leak job specific env to other jobs */
+        unsetenv(v.c_str());
+    }
 
 }
 
@@ -426,6 +433,7 @@ void UccJob::cleanup()
     staticTeams.clear();
     if (staticUccJob) {
         delete staticUccJob;
+        staticUccJob = NULL;
     }
 }
 
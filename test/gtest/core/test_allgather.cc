@@ -196,3 +196,38 @@ INSTANTIATE_TEST_CASE_P(
 #endif
         ::testing::Values(1,3,8192), // count
         ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));  // inplace
+
+using Param_2 = std::tuple<std::string, int, gtest_ucc_inplace_t>;
+
+class test_allgather_alg : public test_allgather,
+        public ::testing::WithParamInterface<Param_2> {};
+
+UCC_TEST_P(test_allgather_alg, alg)
+{
+    const std::string         alg     = std::get<0>(GetParam());
+    const int                 n_procs = std::get<1>(GetParam());
+    const gtest_ucc_inplace_t inplace = std::get<2>(GetParam());
+    ucc_job_env_t             env     = {{"UCC_TL_UCP_TUNE",
+                                          "allgather:@" + alg + ":inf"}};
+    UccJob                    job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h                 team    = job.create_team(n_procs);
+    UccCollCtxVec             ctxs;
+
+    set_inplace(inplace);
+    set_mem_type(UCC_MEMORY_TYPE_HOST);
+    for (int count : {1, 3, 8192}) {
+        data_init(n_procs, UCC_DT_INT32, count, ctxs);
+        UccReq    req(team, ctxs);
+        req.start();
+        req.wait();
+        EXPECT_EQ(true, data_validate(ctxs));
+        data_fini(ctxs);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_allgather_alg,
+    ::testing::Combine(
+        ::testing::Values("ring", "bruck", "recursive_doubling"), // alg
+        ::testing::Values(7, 8), // team size
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));  // inplace
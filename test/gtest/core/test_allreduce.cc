@@ -12,8 +12,12 @@
 #include "test_mc_reduce.h"
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#include "core/ucc_team.h"
+#include "components/cl/basic/cl_basic.h"
 
 #include <array>
+#include <sstream>
+#include <dlfcn.h>
 
 template<typename T>
 class test_allreduce : public UccCollArgs, public testing::Test {
@@ -158,6 +162,52 @@ TYPED_TEST(test_allreduce, single_cuda_inplace) {
 #endif
 
 
+/* Persistent request is initialized once and posted several times, the
+   result has to be correct after every post */
+#define TEST_DECLARE_PERSISTENT(_mem_type, _inplace)                           \
+{                                                                              \
+    const int n_posts = 3;                                                     \
+    std::array<int,3> counts {1,2,4};                                          \
+    for (int tid = 0; tid < UccJob::nStaticTeams; tid++) {                     \
+        for (int count : counts) {                                             \
+            UccTeam_h team = UccJob::getStaticTeams()[tid];                    \
+            int       size = team->procs.size();                               \
+            size_t    len  = ucc_dt_size(TypeParam::dt) * count;               \
+            UccCollCtxVec ctxs;                                                \
+            this->set_mem_type(_mem_type);                                     \
+            this->set_inplace(_inplace);                                       \
+            this->data_init(size, TypeParam::dt, count, ctxs);                 \
+            for (auto ctx : ctxs) {                                            \
+                ctx->args->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;                 \
+                ctx->args->flags |= UCC_COLL_ARGS_FLAG_PERSISTENT;             \
+            }                                                                  \
+            UccReq    req(team, ctxs);                                         \
+            for (int i = 0; i < n_posts; i++) {                                \
+                if (TEST_INPLACE == _inplace) {                                \
+                    for (auto ctx : ctxs) {                                    \
+                        UCC_CHECK(ucc_mc_memcpy(ctx->args->dst.info.buffer,    \
+                                                ctx->init_buf, len, _mem_type, \
+                                                UCC_MEMORY_TYPE_HOST));        \
+                    }                                                          \
+                }                                                              \
+                req.start();                                                   \
+                req.wait();                                                    \
+                EXPECT_EQ(true, this->data_validate(ctxs));                    \
+            }                                                                  \
+            this->data_fini(ctxs);                                             \
+        }                                                                      \
+    }                                                                          \
+}
+
+TYPED_TEST(test_allreduce, persistent) {
+    TEST_DECLARE_PERSISTENT(UCC_MEMORY_TYPE_HOST, TEST_NO_INPLACE);
+}
+
+TYPED_TEST(test_allreduce, persistent_inplace) {
+    TEST_DECLARE_PERSISTENT(UCC_MEMORY_TYPE_HOST, TEST_INPLACE);
+}
+
+
 #define TEST_DECLARE_MULTIPLE(_mem_type, _inplace)                             \
 {                                                                              \
     std::array<int,3> counts {1,2,4};                                          \
@@ -200,3 +250,175 @@ TYPED_TEST(test_allreduce, multiple_cuda_inplace) {
     TEST_DECLARE_MULTIPLE(UCC_MEMORY_TYPE_CUDA, TEST_INPLACE);
 }
 #endif
+
+template<typename T>
+class test_allreduce_alg : public test_allreduce<T>
+{};
+
+using test_allreduce_alg_type = ::testing::Types<ReductionTest<UCC_DT_INT32, sum>>;
+TYPED_TEST_CASE(test_allreduce_alg, test_allreduce_alg_type);
+
+#define TEST_DECLARE_WITH_ENV(_env, _n_procs)                                  \
+{                                                                              \
+    UccJob        job(_n_procs, UccJob::UCC_JOB_CTX_GLOBAL, _env);             \
+    UccTeam_h     team = job.create_team(_n_procs);                            \
+    UccCollCtxVec ctxs;                                                        \
+    for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {                     \
+        for (size_t count : {1, 3, 15, 1023, 65536}) {                         \
+            this->set_inplace(inplace);                                        \
+            this->set_mem_type(UCC_MEMORY_TYPE_HOST);                          \
+            this->data_init(_n_procs, TypeParam::dt, count, ctxs);             \
+            UccReq req(team, ctxs);                                            \
+            req.start();                                                       \
+            req.wait();                                                        \
+            EXPECT_EQ(true, this->data_validate(ctxs));                        \
+            this->data_fini(ctxs);                                             \
+        }                                                                      \
+    }                                                                          \
+}
+
+TYPED_TEST(test_allreduce_alg, ring) {
+    int           n_procs = 15;
+    ucc_job_env_t env     = {{"UCC_TL_UCP_TUNE", "allreduce:@ring:inf"}};
+    TEST_DECLARE_WITH_ENV(env, n_procs);
+}
+
+TYPED_TEST(test_allreduce_alg, sra_knomial_pipelined) {
+    int           n_procs = 15;
+    ucc_job_env_t env     = {{"UCC_TL_UCP_TUNE", "allreduce:@sra_knomial:inf"},
+                             {"UCC_TL_UCP_ALLREDUCE_SRA_KN_FRAG_SIZE", "1K"},
+                             {"UCC_TL_UCP_ALLREDUCE_SRA_KN_PIPELINE_DEPTH", "3"}};
+    TEST_DECLARE_WITH_ENV(env, n_procs);
+}
+
+typedef ucc_status_t (*tl_ucp_tune_dump_fn_t)(void *tl_team, char *str,
+                                              size_t max_len);
+
+/* TUNE string of the tl/ucp autotuner of the team: tl/ucp is a dynamic
+   component, the dump function is looked up in it */
+static std::string autotune_dump(ucc_team_h team)
+{
+    char                   str[4096];
+    ucc_cl_basic_team_t   *cl_team;
+    ucc_tl_iface_t        *iface;
+    tl_ucp_tune_dump_fn_t  dump;
+
+    for (int i = 0; i < team->n_cl_teams; i++) {
+        if (strcmp(UCC_CL_TEAM_IFACE(team->cl_teams[i])->super.name,
+                   "basic")) {
+            continue;
+        }
+        cl_team = ucc_derived_of(team->cl_teams[i], ucc_cl_basic_team_t);
+        for (unsigned j = 0; j < cl_team->n_tl_teams; j++) {
+            iface = UCC_TL_TEAM_IFACE(cl_team->tl_teams[j]);
+            if (strcmp(iface->super.name, "ucp")) {
+                continue;
+            }
+            dump = (tl_ucp_tune_dump_fn_t)dlsym(iface->super.dl_handle,
+                                                "ucc_tl_ucp_tune_dump");
+            if (dump && UCC_OK == dump(cl_team->tl_teams[j], str,
+                                       sizeof(str))) {
+                return str;
+            }
+        }
+    }
+    return "";
+}
+
+/* msgsize is in one of the host allreduce ranges of the TUNE string */
+static bool autotune_covers(const std::string &str, size_t msgsize)
+{
+    std::istringstream tokens(str);
+    std::string        token;
+    size_t             start;
+    char               end[32];
+
+    while (std::getline(tokens, token, '#')) {
+        if (2 == sscanf(token.c_str(), "allreduce:%zu-%31[^:]:host", &start,
+                        end) &&
+            msgsize >= start &&
+            (!strcmp(end, "inf") || msgsize < std::stoull(end))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Every iteration of a bucket is validated: tuning round over all the
+   candidates, the agreement on the winner and the runs of the winner.
+   Then all the iterations of 2 buckets are outstanding at once: the
+   agreements run concurrently and the collectives initialized after the
+   tuning round are deferred until the winner is known. Tuning has to be
+   done with the same winners on all the ranks */
+TYPED_TEST(test_allreduce_alg, autotune) {
+    int                        n_procs = 8;
+    int                        n_iters = 20;
+    ucc_job_env_t              env     = {{"UCC_TL_UCP_AUTOTUNE", "2"},
+                                          {"UCC_CLS", "basic"}};
+    UccJob                     job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h                  team = job.create_team(n_procs);
+    UccCollCtxVec              ctxs;
+    std::vector<UccReq>        reqs;
+    std::vector<UccCollCtxVec> multi_ctxs;
+    std::string                tuned;
+
+    this->set_inplace(TEST_NO_INPLACE);
+    this->set_mem_type(UCC_MEMORY_TYPE_HOST);
+    for (size_t count : {1, 1023, 65536}) {
+        for (int i = 0; i < n_iters; i++) {
+            this->data_init(n_procs, TypeParam::dt, count, ctxs);
+            UccReq req(team, ctxs);
+            req.start();
+            req.wait();
+            EXPECT_EQ(true, this->data_validate(ctxs));
+            this->data_fini(ctxs);
+        }
+    }
+    for (int i = 0; i < n_iters; i++) {
+        for (size_t count : {3, 8191}) {
+            this->data_init(n_procs, TypeParam::dt, count, ctxs);
+            reqs.push_back(UccReq(team, ctxs));
+            multi_ctxs.push_back(ctxs);
+        }
+    }
+    UccReq::startall(reqs);
+    UccReq::waitall(reqs);
+    for (auto &ctx : multi_ctxs) {
+        EXPECT_EQ(true, this->data_validate(ctx));
+        this->data_fini(ctx);
+    }
+
+    tuned = autotune_dump(team->procs[0].team);
+    for (size_t count : {1, 1023, 65536, 3, 8191}) {
+        EXPECT_TRUE(autotune_covers(tuned,
+                                    count * ucc_dt_size(TypeParam::dt)))
+            << "count " << count << ", TUNE string " << tuned;
+    }
+    for (auto &p : team->procs) {
+        EXPECT_EQ(tuned, autotune_dump(p.team));
+    }
+}
+
+TYPED_TEST(test_allreduce_alg, event_driven) {
+    int           n_procs = 8;
+    ucc_job_env_t env     = {{"UCC_EVENT_DRIVEN_PROGRESS", "y"}};
+    TEST_DECLARE_WITH_ENV(env, n_procs);
+}
+
+/* The reductions of knomial (and of the reduce_scatter of sra_knomial) run
+   on the mc helper threads while no UCP operation is outstanding: the task
+   has to stay runnable in the event driven mode until they complete */
+TYPED_TEST(test_allreduce_alg, event_driven_mc_threads) {
+    int n_procs = 8;
+
+    /* mc cpu reads its config when the first library is initialized: the
+       static job must not keep it initialized */
+    UccJob::cleanup();
+    for (auto alg : {"allreduce:@knomial:inf", "allreduce:@sra_knomial:inf"}) {
+        ucc_job_env_t env = {{"UCC_EVENT_DRIVEN_PROGRESS", "y"},
+                             {"UCC_MC_CPU_THREADS", "2"},
+                             {"UCC_MC_CPU_THREADS_THRESHOLD", "1K"},
+                             {"UCC_TL_UCP_TUNE", alg}};
+        TEST_DECLARE_WITH_ENV(env, n_procs);
+    }
+}
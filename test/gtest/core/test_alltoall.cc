@@ -8,6 +8,7 @@
 
 using Param_0 = std::tuple<int, int, ucc_memory_type_t, gtest_ucc_inplace_t, int>;
 using Param_1 = std::tuple<int, ucc_memory_type_t, gtest_ucc_inplace_t, int>;
+using Param_2 = std::tuple<std::string, int>;
 
 class test_alltoall : public UccCollArgs, public ucc::test
 {
@@ -200,3 +201,34 @@ INSTANTIATE_TEST_CASE_P(
 #endif
         ::testing::Values(/*TEST_INPLACE,*/ TEST_NO_INPLACE), // inplace
         ::testing::Values(1,3,8192))); // count
+
+class test_alltoall_alg : public test_alltoall,
+        public ::testing::WithParamInterface<Param_2> {};
+
+UCC_TEST_P(test_alltoall_alg, alg)
+{
+    const std::string alg     = std::get<0>(GetParam());
+    const int         n_procs = std::get<1>(GetParam());
+    ucc_job_env_t     env     = {{"UCC_TL_UCP_TUNE",
+                                  "alltoall:@" + alg + ":inf"}};
+    UccJob            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h         team    = job.create_team(n_procs);
+    UccCollCtxVec     ctxs;
+
+    set_inplace(TEST_NO_INPLACE);
+    set_mem_type(UCC_MEMORY_TYPE_HOST);
+    for (int count : {1, 3, 8192}) {
+        data_init(n_procs, UCC_DT_INT32, count, ctxs);
+        UccReq    req(team, ctxs);
+        req.start();
+        req.wait();
+        EXPECT_EQ(true, data_validate(ctxs));
+        data_fini(ctxs);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_alltoall_alg,
+    ::testing::Combine(
+        ::testing::Values("pairwise", "bruck"), // alg
+        ::testing::Values(2, 7, 8))); // team size
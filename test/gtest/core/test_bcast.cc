@@ -8,6 +8,7 @@
 
 using Param_0 = std::tuple<int, int, ucc_memory_type_t, int, int>;
 using Param_1 = std::tuple<int, ucc_memory_type_t, int, int>;
+using Param_2 = std::tuple<std::string, int, int>;
 
 class test_bcast : public UccCollArgs, public ucc::test
 {
@@ -67,25 +68,26 @@ public:
     bool data_validate(UccCollCtxVec ctxs)
     {
         bool     ret  = true;
-        int      root = ctxs[0]->args->root;
-        uint8_t *dsts;
+        uint8_t *dsts = nullptr;
 
         if (UCC_MEMORY_TYPE_HOST != mem_type) {
-                dsts = (uint8_t*) ucc_malloc(ctxs[root]->rbuf_size, "dsts buf");
-                EXPECT_NE(dsts, nullptr);
-                UCC_CHECK(ucc_mc_memcpy(dsts, ctxs[root]->args->src.info.buffer,
-                                        ctxs[root]->rbuf_size,
-                                        UCC_MEMORY_TYPE_HOST, mem_type));
-        } else {
-            dsts = (uint8_t*)ctxs[root]->args->src.info.buffer;
+            dsts = (uint8_t*) ucc_malloc(ctxs[0]->rbuf_size, "dsts buf");
+            EXPECT_NE(dsts, nullptr);
         }
         for (int r = 0; r < ctxs.size(); r++) {
             ucc_coll_args_t* coll = ctxs[r]->args;
+            uint8_t         *rbuf = (uint8_t*)coll->src.info.buffer;
             if (coll->root == r) {
                 continue;
             }
+            if (UCC_MEMORY_TYPE_HOST != mem_type) {
+                UCC_CHECK(ucc_mc_memcpy(dsts, coll->src.info.buffer,
+                                        ctxs[r]->rbuf_size,
+                                        UCC_MEMORY_TYPE_HOST, mem_type));
+                rbuf = dsts;
+            }
             for (int i = 0; i < ctxs[r]->rbuf_size; i++) {
-                if ((uint8_t)i != dsts[i]) {
+                if ((uint8_t)i != rbuf[i]) {
                     ret = false;
                     break;
                 }
@@ -184,3 +186,36 @@ INSTANTIATE_TEST_CASE_P(
 #endif
         ::testing::Values(1,3,65536), // count
         ::testing::Values(0,1))); // root
+
+class test_bcast_alg : public test_bcast,
+        public ::testing::WithParamInterface<Param_2> {};
+
+UCC_TEST_P(test_bcast_alg, alg)
+{
+    const std::string alg     = std::get<0>(GetParam());
+    const int         n_procs = std::get<1>(GetParam());
+    const int         root    = std::get<2>(GetParam());
+    ucc_job_env_t     env     = {{"UCC_TL_UCP_TUNE",
+                                  "bcast:@" + alg + ":inf"}};
+    UccJob            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h         team    = job.create_team(n_procs);
+    UccCollCtxVec     ctxs;
+
+    set_mem_type(UCC_MEMORY_TYPE_HOST);
+    set_root(root);
+    for (int count : {1, 3, 65536, 65539}) {
+        data_init(n_procs, UCC_DT_INT8, count, ctxs);
+        UccReq    req(team, ctxs);
+        req.start();
+        req.wait();
+        EXPECT_EQ(true, data_validate(ctxs));
+        data_fini(ctxs);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_bcast_alg,
+    ::testing::Combine(
+        ::testing::Values("knomial", "sag_knomial"), // alg
+        ::testing::Values(7, 8), // team size
+        ::testing::Values(0, 1, 5))); // root
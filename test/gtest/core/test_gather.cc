@@ -0,0 +1,239 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ * See file LICENSE for terms.
+ */
+
+#include "common/test_ucc.h"
+#include "utils/ucc_math.h"
+
+using Param_0 = std::tuple<int, ucc_coll_type_t, ucc_memory_type_t, int, int,
+                           gtest_ucc_inplace_t>;
+using Param_1 = std::tuple<std::string, int, int>;
+
+class test_gather : public UccCollArgs, public ucc::test
+{
+private:
+    int             root;
+    ucc_coll_type_t coll_type;
+public:
+    /* gatherv uses different block sizes on different ranks */
+    size_t rank_count(int r, size_t count)
+    {
+        return (UCC_COLL_TYPE_GATHERV == coll_type) ? (r % 3 + 1) * count
+                                                    : count;
+    }
+    void data_init(int nprocs, ucc_datatype_t dtype, size_t count,
+                   UccCollCtxVec &ctxs)
+    {
+        size_t dt_size     = ucc_dt_size(dtype);
+        size_t total_count = 0;
+
+        for (int r = 0; r < nprocs; r++) {
+            total_count += rank_count(r, count);
+        }
+        ctxs.resize(nprocs);
+        for (int r = 0; r < nprocs; r++) {
+            size_t           my_count = rank_count(r, count);
+            size_t           displ    = 0;
+            ucc_coll_args_t *coll     = (ucc_coll_args_t*)
+                    calloc(1, sizeof(ucc_coll_args_t));
+
+            ctxs[r] = (gtest_ucc_coll_ctx_t*)calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args = coll;
+
+            coll->mask              = 0;
+            coll->coll_type         = coll_type;
+            coll->root              = root;
+            coll->src.info.mem_type = mem_type;
+            coll->src.info.count    = (ucc_count_t)my_count;
+            coll->src.info.datatype = dtype;
+
+            ctxs[r]->init_buf = ucc_malloc(my_count * dt_size, "init buf");
+            EXPECT_NE(ctxs[r]->init_buf, nullptr);
+            for (int i = 0; i < my_count * dt_size; i++) {
+                ((uint8_t*)ctxs[r]->init_buf)[i] = (uint8_t)(r + i);
+            }
+
+            if (r == root) {
+                ctxs[r]->rbuf_size = total_count * dt_size;
+                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->dst_mc_header,
+                                       ctxs[r]->rbuf_size, mem_type));
+                if (UCC_COLL_TYPE_GATHERV == coll_type) {
+                    int *counts = (int*)malloc(sizeof(int) * nprocs);
+                    int *displs = (int*)malloc(sizeof(int) * nprocs);
+
+                    for (int i = 0; i < nprocs; i++) {
+                        counts[i] = rank_count(i, count);
+                        displs[i] = (i == 0) ? 0 : displs[i - 1] + counts[i - 1];
+                    }
+                    displ = displs[r];
+                    coll->dst.info_v.buffer        = ctxs[r]->dst_mc_header->addr;
+                    coll->dst.info_v.counts        = (ucc_count_t*)counts;
+                    coll->dst.info_v.displacements = (ucc_aint_t*)displs;
+                    coll->dst.info_v.datatype      = dtype;
+                    coll->dst.info_v.mem_type      = mem_type;
+                } else {
+                    displ = r * count;
+                    coll->dst.info.buffer   = ctxs[r]->dst_mc_header->addr;
+                    coll->dst.info.count    = (ucc_count_t)total_count;
+                    coll->dst.info.datatype = dtype;
+                    coll->dst.info.mem_type = mem_type;
+                }
+            }
+            if (r == root && TEST_INPLACE == inplace) {
+                coll->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+                coll->flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+                UCC_CHECK(ucc_mc_memcpy(PTR_OFFSET(ctxs[r]->dst_mc_header->addr,
+                                                   displ * dt_size),
+                                        ctxs[r]->init_buf, my_count * dt_size,
+                                        mem_type, UCC_MEMORY_TYPE_HOST));
+            } else {
+                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header,
+                                       my_count * dt_size, mem_type));
+                coll->src.info.buffer = ctxs[r]->src_mc_header->addr;
+                UCC_CHECK(ucc_mc_memcpy(coll->src.info.buffer, ctxs[r]->init_buf,
+                                        my_count * dt_size, mem_type,
+                                        UCC_MEMORY_TYPE_HOST));
+            }
+        }
+    }
+    void data_fini(UccCollCtxVec ctxs)
+    {
+        for (auto r = 0; r < ctxs.size(); r++) {
+            gtest_ucc_coll_ctx_t *ctx  = ctxs[r];
+            ucc_coll_args_t      *coll = ctx->args;
+
+            if (ctx->src_mc_header) {
+                UCC_CHECK(ucc_mc_free(ctx->src_mc_header));
+            }
+            if (ctx->dst_mc_header) {
+                UCC_CHECK(ucc_mc_free(ctx->dst_mc_header));
+            }
+            if (r == root && UCC_COLL_TYPE_GATHERV == coll_type) {
+                free(coll->dst.info_v.counts);
+                free(coll->dst.info_v.displacements);
+            }
+            ucc_free(ctx->init_buf);
+            free(coll);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
+    bool data_validate(UccCollCtxVec ctxs)
+    {
+        bool     ret     = true;
+        size_t   dt_size = ucc_dt_size(ctxs[0]->args->src.info.datatype);
+        uint8_t *rbuf    = (uint8_t*)ctxs[root]->dst_mc_header->addr;
+        size_t   offset  = 0;
+
+        if (UCC_MEMORY_TYPE_HOST != mem_type) {
+            rbuf = (uint8_t*)ucc_malloc(ctxs[root]->rbuf_size, "dsts buf");
+            EXPECT_NE(rbuf, nullptr);
+            UCC_CHECK(ucc_mc_memcpy(rbuf, ctxs[root]->dst_mc_header->addr,
+                                    ctxs[root]->rbuf_size,
+                                    UCC_MEMORY_TYPE_HOST, mem_type));
+        }
+        for (int r = 0; r < ctxs.size() && ret; r++) {
+            size_t rank_size = ctxs[r]->args->src.info.count * dt_size;
+
+            for (int i = 0; i < rank_size; i++) {
+                if ((uint8_t)(r + i) != rbuf[offset + i]) {
+                    ret = false;
+                    break;
+                }
+            }
+            offset += rank_size;
+        }
+        if (UCC_MEMORY_TYPE_HOST != mem_type) {
+            ucc_free(rbuf);
+        }
+        return ret;
+    }
+    void set_root(int _root)
+    {
+        root = _root;
+    }
+    void set_coll_type(ucc_coll_type_t _coll_type)
+    {
+        coll_type = _coll_type;
+    }
+};
+
+class test_gather_0 : public test_gather,
+        public ::testing::WithParamInterface<Param_0> {};
+
+UCC_TEST_P(test_gather_0, single)
+{
+    const int                 team_id   = std::get<0>(GetParam());
+    const ucc_coll_type_t     coll_type = std::get<1>(GetParam());
+    const ucc_memory_type_t   mem_type  = std::get<2>(GetParam());
+    const int                 count     = std::get<3>(GetParam());
+    const int                 last_root = std::get<4>(GetParam());
+    const gtest_ucc_inplace_t inplace   = std::get<5>(GetParam());
+    UccTeam_h                 team      = UccJob::getStaticTeams()[team_id];
+    int                       size      = team->procs.size();
+    UccCollCtxVec             ctxs;
+
+    set_coll_type(coll_type);
+    set_mem_type(mem_type);
+    set_inplace(inplace);
+    set_root(last_root ? size - 1 : 0);
+
+    data_init(size, UCC_DT_INT32, count, ctxs);
+    UccReq    req(team, ctxs);
+    req.start();
+    req.wait();
+    EXPECT_EQ(true, data_validate(ctxs));
+    data_fini(ctxs);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_gather_0,
+    ::testing::Combine(
+        ::testing::Range(0, UccJob::nStaticTeams), // team_ids
+        ::testing::Values(UCC_COLL_TYPE_GATHER, UCC_COLL_TYPE_GATHERV),
+#ifdef HAVE_CUDA
+        ::testing::Values(UCC_MEMORY_TYPE_HOST, UCC_MEMORY_TYPE_CUDA), // mem type
+#else
+        ::testing::Values(UCC_MEMORY_TYPE_HOST),
+#endif
+        ::testing::Values(1,3,8192), // count
+        ::testing::Values(0,1), // root: first or last rank
+        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));  // inplace
+
+class test_gather_alg : public test_gather,
+        public ::testing::WithParamInterface<Param_1> {};
+
+UCC_TEST_P(test_gather_alg, alg)
+{
+    const std::string alg     = std::get<0>(GetParam());
+    const int         n_procs = std::get<1>(GetParam());
+    const int         root    = std::get<2>(GetParam());
+    ucc_job_env_t     env     = {{"UCC_TL_UCP_TUNE", "gather:@" + alg + ":inf"},
+                                 {"UCC_TL_UCP_GATHER_LINEAR_NUM_POSTS", "2"}};
+    UccJob            job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h         team    = job.create_team(n_procs);
+    UccCollCtxVec     ctxs;
+
+    set_coll_type(UCC_COLL_TYPE_GATHER);
+    set_mem_type(UCC_MEMORY_TYPE_HOST);
+    set_root(root);
+    for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+        for (int count : {1, 3, 65539}) {
+            set_inplace(inplace);
+            data_init(n_procs, UCC_DT_INT8, count, ctxs);
+            UccReq    req(team, ctxs);
+            req.start();
+            req.wait();
+            EXPECT_EQ(true, data_validate(ctxs));
+            data_fini(ctxs);
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_gather_alg,
+    ::testing::Combine(
+        ::testing::Values("knomial", "linear"), // alg
+        ::testing::Values(7, 8), // team size
+        ::testing::Values(0, 1, 6))); // root
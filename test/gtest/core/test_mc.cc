@@ -14,8 +14,8 @@ void *mt_ucc_mc_cpu_allocs(void *args)
 {
     // Final size will be:
     // size * (quantifier^(num_of_allocs/2))
-    // and should be larger than mpool buffer size which is 1MB by default,
-    // to assure testing both fast and slow ucc_mc_alloc path.
+    // and should span several size classes of the mc cpu cache,
+    // to assure testing both cache hits and misses of ucc_mc_alloc path.
     // if num_of_allocs is changed, change quantifier accordingly.
     size_t                                size          = 4;
     int                                   quantifier    = 2;
@@ -65,7 +65,7 @@ UCC_TEST_F(test_mc, init_is_required)
 
 UCC_TEST_F(test_mc, can_alloc_and_free_host_mem)
 {
-    // mpool will be used only if size is smaller than UCC_MC_CPU_ELEM_SIZE, which by default set to 1MB and is configurable at runtime.
+    // cache will be used only if size is smaller than UCC_MC_CPU_CACHE_MAX_BUF_SIZE, which by default set to 32MB and is configurable at runtime.
     size_t                  size = 4096;
     ucc_mc_buffer_header_t *h;
     void *ptr = NULL;
@@ -84,7 +84,7 @@ UCC_TEST_F(test_mc, can_alloc_and_free_host_mem)
 
 UCC_TEST_F(test_mc, can_alloc_and_free_host_mem_mt)
 {
-    // mpool will be used only if size is smaller than UCC_MC_CPU_ELEM_SIZE, which by default set to 1MB and is configurable at runtime.
+    // cache will be used only if size is smaller than UCC_MC_CPU_CACHE_MAX_BUF_SIZE, which by default set to 32MB and is configurable at runtime.
     int                    num_of_threads = 10;
     std::vector<pthread_t> threads;
     threads.resize(num_of_threads);
@@ -103,6 +103,26 @@ UCC_TEST_F(test_mc, can_alloc_and_free_host_mem_mt)
     ucc_mc_finalize();
 }
 
+UCC_TEST_F(test_mc, host_mem_cache_reuse)
+{
+    // released buffer is reused by the next request of the same size class
+    ucc_mc_buffer_header_t *h1, *h2;
+
+    ASSERT_EQ(UCC_OK, ucc_constructor());
+    ucc_mc_params_t mc_params = {
+        .thread_mode = UCC_THREAD_SINGLE,
+    };
+    ASSERT_EQ(UCC_OK, ucc_mc_init(&mc_params));
+    ASSERT_EQ(UCC_OK, ucc_mc_alloc(&h1, 16 << 20, UCC_MEMORY_TYPE_HOST));
+    memset(h1->addr, 0, 16 << 20);
+    EXPECT_EQ(UCC_OK, ucc_mc_free(h1));
+    ASSERT_EQ(UCC_OK, ucc_mc_alloc(&h2, (12 << 20) + 1, UCC_MEMORY_TYPE_HOST));
+    EXPECT_EQ(h1, h2);
+    memset(h2->addr, 0, (12 << 20) + 1);
+    EXPECT_EQ(UCC_OK, ucc_mc_free(h2));
+    ucc_mc_finalize();
+}
+
 UCC_TEST_F(test_mc, init_twice)
 {
     ucc_lib_config_h cfg;
@@ -4,6 +4,10 @@
  */
 
 #include "test_mc_reduce.h"
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
 
 TYPED_TEST(test_mc_reduce, ucc_reduce_single_host) {
     this->alloc_bufs(UCC_MEMORY_TYPE_HOST, 1);
@@ -31,3 +35,445 @@ TYPED_TEST(test_mc_reduce, ucc_reduce_multi_host) {
         TypeParam::assert_equal(res, this->res_h[i]);
     }
 }
+
+/* Every instruction set of the vectorized reduction kernels gives the same
+   result as the compiler generated code (UCC_MC_CPU_REDUCE_SIMD=none). The
+   instruction sets not supported by the CPU fall back to the supported one */
+class test_mc_reduce_simd : public ucc::test {
+  public:
+    const char *isas[5] = {"none", "sse", "avx2", "avx512", "neon"};
+    void init_mc(const char *simd)
+    {
+        ucc_mc_params_t mc_params = {
+            .thread_mode = UCC_THREAD_SINGLE,
+        };
+
+        setenv("UCC_MC_CPU_REDUCE_SIMD", simd, 1);
+        ASSERT_EQ(UCC_OK, ucc_constructor());
+        ASSERT_EQ(UCC_OK, ucc_mc_init(&mc_params));
+        unsetenv("UCC_MC_CPU_REDUCE_SIMD");
+    }
+    template <typename T> void fill(std::vector<uint8_t> &buf)
+    {
+        T *p = (T *)buf.data();
+
+        for (size_t i = 0; i < buf.size() / sizeof(T); i++) {
+            p[i] = (T)(rand() % 4 + 1);
+        }
+    }
+    void fill_half(ucc_datatype_t dt, std::vector<uint8_t> &buf)
+    {
+        /* 1.0, 2.0, 3.0 and 4.0 */
+        const uint16_t f16[]  = {0x3c00, 0x4000, 0x4200, 0x4400};
+        const uint16_t bf16[] = {0x3f80, 0x4000, 0x4040, 0x4080};
+        uint16_t      *p      = (uint16_t *)buf.data();
+
+        for (size_t i = 0; i < buf.size() / sizeof(uint16_t); i++) {
+            p[i] = (dt == UCC_DT_FLOAT16) ? f16[rand() % 4] : bf16[rand() % 4];
+        }
+    }
+    void fill(ucc_datatype_t dt, std::vector<uint8_t> &buf)
+    {
+        switch (dt) {
+        case UCC_DT_FLOAT16:
+        case UCC_DT_BFLOAT16:
+            return fill_half(dt, buf);
+        case UCC_DT_FLOAT32:
+            return fill<float>(buf);
+        case UCC_DT_FLOAT64:
+            return fill<double>(buf);
+        default:
+            return fill<uint8_t>(buf);
+        }
+    }
+};
+
+UCC_TEST_F(test_mc_reduce_simd, all_isa)
+{
+    const size_t count = 1027;
+    const size_t size  = 9;
+    struct {
+        ucc_datatype_t     dt;
+        ucc_reduction_op_t op;
+    } cases[] = {{UCC_DT_FLOAT32, UCC_OP_SUM}, {UCC_DT_FLOAT64, UCC_OP_MAX},
+                 {UCC_DT_INT32, UCC_OP_PROD},  {UCC_DT_UINT8, UCC_OP_MIN},
+                 {UCC_DT_INT64, UCC_OP_BXOR},  {UCC_DT_UINT16, UCC_OP_SUM},
+                 {UCC_DT_FLOAT16, UCC_OP_SUM}, {UCC_DT_BFLOAT16, UCC_OP_PROD},
+                 {UCC_DT_FLOAT16, UCC_OP_MIN}, {UCC_DT_BFLOAT16, UCC_OP_MAX}};
+
+    for (auto &c : cases) {
+        size_t               dt_size = ucc_dt_size(c.dt);
+        std::vector<uint8_t> src1(count * dt_size), ref(count * dt_size);
+        std::vector<uint8_t> src2(size * count * dt_size), dst(count * dt_size);
+
+        fill(c.dt, src1);
+        fill(c.dt, src2);
+        for (auto isa : isas) {
+            init_mc(isa);
+            EXPECT_EQ(UCC_OK, ucc_mc_reduce_multi(
+                                  src1.data(), src2.data(),
+                                  (isa == isas[0]) ? ref.data() : dst.data(),
+                                  size, count, count * dt_size, c.dt, c.op,
+                                  UCC_MEMORY_TYPE_HOST));
+            ucc_mc_finalize();
+            if (isa != isas[0]) {
+                EXPECT_EQ(0, memcmp(ref.data(), dst.data(), ref.size()))
+                    << "dt " << c.dt << " op " << c.op << " isa " << isa;
+            }
+        }
+    }
+}
+
+/* Benchmark, not run by default (--gtest_also_run_disabled_tests): prints
+   the bandwidth (sources and destination bytes) of float SUM kernels of
+   every instruction set */
+UCC_TEST_F(test_mc_reduce_simd, DISABLED_perf)
+{
+    const size_t bytes   = 1 << 20;
+    const int    n_iters = 200;
+
+    for (ucc_datatype_t dt : {UCC_DT_FLOAT32, UCC_DT_FLOAT64}) {
+        for (size_t size : {1, 7}) {
+            std::vector<uint8_t> src1(bytes), src2(size * bytes), dst(bytes);
+            size_t               count = bytes / ucc_dt_size(dt);
+
+            for (auto isa : isas) {
+                init_mc(isa);
+                auto s = std::chrono::high_resolution_clock::now();
+                for (int i = 0; i < n_iters; i++) {
+                    EXPECT_EQ(UCC_OK,
+                              ucc_mc_reduce_multi(src1.data(), src2.data(),
+                                                  dst.data(), size, count,
+                                                  bytes, dt, UCC_OP_SUM,
+                                                  UCC_MEMORY_TYPE_HOST));
+                }
+                auto time = std::chrono::high_resolution_clock::now() - s;
+                ucc_mc_finalize();
+                std::cout << "reduce "
+                          << (dt == UCC_DT_FLOAT32 ? "float32" : "float64")
+                          << " sum, " << size << " srcs, " << isa << ": "
+                          << (double)(size + 2) * bytes * n_iters /
+                                 std::chrono::duration<double>(time).count() /
+                                 1e9
+                          << " GB/s" << std::endl;
+            }
+        }
+    }
+}
+
+/* Fan-in above UCC_MC_CPU_REDUCE_SINGLE_PASS_MAX: scalar tiled path with
+   simd "none", single pass vector kernels with non temporal stores for
+   every dst size otherwise */
+UCC_TEST_F(test_mc_reduce_simd, large_fan_in)
+{
+    const size_t count = 5003;
+    const size_t size  = 31;
+    float       *dst;
+
+    for (auto dt : {UCC_DT_FLOAT32, UCC_DT_INT32}) {
+        std::vector<uint8_t> src1(count * 4), src2(size * count * 4);
+        std::vector<float>   ref(count);
+        ucc_reduction_op_t   op = (dt == UCC_DT_FLOAT32) ? UCC_OP_SUM :
+                                                          UCC_OP_LAND;
+
+        fill(dt, src1);
+        fill(dt, src2);
+        for (size_t i = 0; i < size * count; i += 97) {
+            ((uint32_t *)src2.data())[i] = 0;
+        }
+        for (size_t i = 0; i < count; i++) {
+            float    s = ((float *)src1.data())[i];
+            uint32_t l = ((uint32_t *)src1.data())[i] != 0;
+
+            for (size_t j = 0; j < size; j++) {
+                s += ((float *)src2.data())[j * count + i];
+                l  = l && ((uint32_t *)src2.data())[j * count + i];
+            }
+            if (dt == UCC_DT_FLOAT32) {
+                ref[i] = s;
+            } else {
+                memcpy(&ref[i], &l, sizeof(l));
+            }
+        }
+        ASSERT_EQ(0, posix_memalign((void **)&dst, 64, count * 4));
+        setenv("UCC_MC_CPU_REDUCE_NT_THRESHOLD", "0", 1);
+        for (auto isa : {"none", "auto"}) {
+            memset(dst, 0, count * 4);
+            init_mc(isa);
+            EXPECT_EQ(UCC_OK, ucc_mc_reduce_multi(src1.data(), src2.data(),
+                                                  dst, size, count, count * 4,
+                                                  dt, op,
+                                                  UCC_MEMORY_TYPE_HOST));
+            ucc_mc_finalize();
+            EXPECT_EQ(0, memcmp(ref.data(), dst, count * 4))
+                << "dt " << dt << " isa " << isa;
+        }
+        unsetenv("UCC_MC_CPU_REDUCE_NT_THRESHOLD");
+        free(dst);
+    }
+}
+
+/* 2048 + 1 is a tie between 2048 and 2050 in float16, the result rounded
+   after every source stays 2048, float32 accumulation gives 2056. Same for
+   256 + 1 in bfloat16 */
+UCC_TEST_F(test_mc_reduce_simd, half_acc32)
+{
+    const size_t count = 100;
+    const size_t size  = 8;
+    struct {
+        ucc_datatype_t dt;
+        uint16_t       one, big, rounded, acc32;
+    } cases[] = {{UCC_DT_FLOAT16, 0x3c00, 0x6800, 0x6800, 0x6804},
+                 {UCC_DT_BFLOAT16, 0x3f80, 0x4380, 0x4380, 0x4384}};
+
+    for (auto &c : cases) {
+        std::vector<uint16_t> src1(count, c.big), src2(size * count, c.one);
+        std::vector<uint16_t> dst(count);
+
+        for (auto acc32 : {"n", "y"}) {
+            setenv("UCC_MC_CPU_REDUCE_HALF_ACC32", acc32, 1);
+            for (auto isa : {"none", "auto"}) {
+                init_mc(isa);
+                EXPECT_EQ(UCC_OK, ucc_mc_reduce_multi(
+                                      src1.data(), src2.data(), dst.data(),
+                                      size, count, count * sizeof(uint16_t),
+                                      c.dt, UCC_OP_SUM, UCC_MEMORY_TYPE_HOST));
+                ucc_mc_finalize();
+                for (size_t i = 0; i < count; i++) {
+                    EXPECT_EQ((acc32[0] == 'y') ? c.acc32 : c.rounded, dst[i])
+                        << "dt " << c.dt << " isa " << isa << " i " << i;
+                }
+            }
+        }
+        unsetenv("UCC_MC_CPU_REDUCE_HALF_ACC32");
+    }
+}
+
+/* bfloat16 denormals are not flushed to zero by any instruction set: 9
+   times the smallest denormal is exact */
+UCC_TEST_F(test_mc_reduce_simd, bfloat16_denormals)
+{
+    const size_t          count = 100;
+    const size_t          size  = 8;
+    std::vector<uint16_t> src1(count, 0x0001), src2(size * count, 0x0001);
+    std::vector<uint16_t> dst(count);
+
+    for (auto isa : isas) {
+        init_mc(isa);
+        EXPECT_EQ(UCC_OK, ucc_mc_reduce_multi(
+                              src1.data(), src2.data(), dst.data(), size,
+                              count, count * sizeof(uint16_t),
+                              UCC_DT_BFLOAT16, UCC_OP_SUM,
+                              UCC_MEMORY_TYPE_HOST));
+        ucc_mc_finalize();
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(0x0009, dst[i]) << "isa " << isa << " i " << i;
+        }
+    }
+}
+
+/* MAXLOC and MINLOC keep the pair with the best value and the smallest
+   index of the equal values, more sources than a single pass of the
+   scalar kernels */
+UCC_TEST_F(test_mc_reduce_simd, loc_pairs)
+{
+    const size_t count = 1000;
+    const size_t size  = 11;
+    struct pair {
+        double  value;
+        int32_t index;
+    };
+    std::vector<pair> src1(count), src2(size * count), dst(count);
+
+    for (size_t i = 0; i < count; i++) {
+        src1[i] = {(double)(rand() % 4), (int32_t)size};
+        for (size_t j = 0; j < size; j++) {
+            src2[j * count + i] = {(double)(rand() % 4), (int32_t)j};
+        }
+    }
+    for (auto op : {UCC_OP_MAXLOC, UCC_OP_MINLOC}) {
+        init_mc("auto");
+        EXPECT_EQ(UCC_OK, ucc_mc_reduce_multi(src1.data(), src2.data(),
+                                              dst.data(), size, count,
+                                              count * sizeof(pair),
+                                              UCC_DT_FLOAT64_INT32, op,
+                                              UCC_MEMORY_TYPE_HOST));
+        EXPECT_EQ(UCC_ERR_NOT_SUPPORTED,
+                  ucc_mc_reduce(src1.data(), src2.data(), dst.data(), count,
+                                UCC_DT_FLOAT64_INT32, UCC_OP_SUM,
+                                UCC_MEMORY_TYPE_HOST));
+        ucc_mc_finalize();
+        for (size_t i = 0; i < count; i++) {
+            pair r = src1[i];
+
+            for (size_t j = 0; j < size; j++) {
+                pair s      = src2[j * count + i];
+                bool better = (op == UCC_OP_MAXLOC) ? s.value > r.value
+                                                    : s.value < r.value;
+
+                if (better || (s.value == r.value && s.index < r.index)) {
+                    r = s;
+                }
+            }
+            EXPECT_EQ(r.value, dst[i].value) << "op " << op << " i " << i;
+            EXPECT_EQ(r.index, dst[i].index) << "op " << op << " i " << i;
+        }
+    }
+}
+
+#ifdef __SIZEOF_INT128__
+UCC_TEST_F(test_mc_reduce_simd, int128)
+{
+    const size_t          count = 100;
+    const __int128        big   = (__int128)1 << 100;
+    std::vector<__int128> src1(count), src2(count), dst(count);
+
+    for (size_t i = 0; i < count; i++) {
+        src1[i] = big + i;
+        src2[i] = -(__int128)i * big;
+    }
+    init_mc("auto");
+    EXPECT_EQ(UCC_OK, ucc_mc_reduce(src1.data(), src2.data(), dst.data(),
+                                    count, UCC_DT_INT128, UCC_OP_SUM,
+                                    UCC_MEMORY_TYPE_HOST));
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_TRUE(dst[i] == src1[i] + src2[i]) << "i " << i;
+    }
+    EXPECT_EQ(UCC_OK, ucc_mc_reduce(src1.data(), src2.data(), dst.data(),
+                                    count, UCC_DT_UINT128, UCC_OP_MAX,
+                                    UCC_MEMORY_TYPE_HOST));
+    ucc_mc_finalize();
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_TRUE(dst[i] == (i ? src2[i] : src1[i])) << "i " << i;
+    }
+}
+#endif
+
+/* Helper threads of mc cpu: the reductions and copies above the threshold
+   are split in chunks executed by the pool, the result is the same as of
+   the inline reduction */
+class test_mc_cpu_threads : public ucc::test {
+  public:
+    void init_mc(int n_threads, const char *threshold)
+    {
+        ucc_mc_params_t mc_params = {
+            .thread_mode = UCC_THREAD_SINGLE,
+        };
+
+        setenv("UCC_MC_CPU_THREADS", std::to_string(n_threads).c_str(), 1);
+        setenv("UCC_MC_CPU_THREADS_THRESHOLD", threshold, 1);
+        ASSERT_EQ(UCC_OK, ucc_constructor());
+        ASSERT_EQ(UCC_OK, ucc_mc_init(&mc_params));
+        unsetenv("UCC_MC_CPU_THREADS");
+        unsetenv("UCC_MC_CPU_THREADS_THRESHOLD");
+    }
+    ucc_status_t wait(ucc_status_t status, ucc_mc_req_t *req)
+    {
+        if (status != UCC_INPROGRESS) {
+            EXPECT_EQ(nullptr, req);
+            return status;
+        }
+        while (UCC_INPROGRESS == (status = ucc_mc_req_test(req))) {
+        }
+        return status;
+    }
+};
+
+UCC_TEST_F(test_mc_cpu_threads, reduce_memcpy)
+{
+    const size_t        count = (3 << 20) + 13;
+    const size_t        size  = 3;
+    std::vector<double> src1(count), src2(size * count), ref(count);
+    std::vector<double> dst(count);
+    ucc_mc_req_t       *req;
+
+    for (size_t i = 0; i < count; i++) {
+        src1[i] = rand() % 8;
+    }
+    for (size_t i = 0; i < size * count; i++) {
+        src2[i] = rand() % 8;
+    }
+    init_mc(0, "inf");
+    EXPECT_EQ(UCC_OK, ucc_mc_reduce_multi(src1.data(), src2.data(),
+                                          ref.data(), size, count,
+                                          count * sizeof(double),
+                                          UCC_DT_FLOAT64, UCC_OP_SUM,
+                                          UCC_MEMORY_TYPE_HOST));
+    ucc_mc_finalize();
+    for (int n_threads : {0, 1, 3}) {
+        init_mc(n_threads, "1Mb");
+        /* blocking: the calling thread executes chunks as well */
+        std::fill(dst.begin(), dst.end(), 0);
+        EXPECT_EQ(UCC_OK, ucc_mc_reduce_multi(src1.data(), src2.data(),
+                                              dst.data(), size, count,
+                                              count * sizeof(double),
+                                              UCC_DT_FLOAT64, UCC_OP_SUM,
+                                              UCC_MEMORY_TYPE_HOST));
+        EXPECT_EQ(ref, dst) << "threads " << n_threads;
+
+        std::fill(dst.begin(), dst.end(), 0);
+        EXPECT_EQ(UCC_OK,
+                  wait(ucc_mc_reduce_multi_nb(src1.data(), src2.data(),
+                                              dst.data(), size, count,
+                                              count * sizeof(double),
+                                              UCC_DT_FLOAT64, UCC_OP_SUM,
+                                              UCC_MEMORY_TYPE_HOST, &req),
+                       req));
+        EXPECT_EQ(ref, dst) << "threads " << n_threads;
+
+        std::fill(dst.begin(), dst.end(), 0);
+        EXPECT_EQ(UCC_OK,
+                  wait(ucc_mc_memcpy_nb(dst.data(), src1.data(),
+                                        count * sizeof(double),
+                                        UCC_MEMORY_TYPE_HOST,
+                                        UCC_MEMORY_TYPE_HOST, &req),
+                       req));
+        EXPECT_EQ(src1, dst) << "threads " << n_threads;
+        ucc_mc_finalize();
+    }
+}
+
+/* Benchmark, not run by default (--gtest_also_run_disabled_tests): prints
+   the bandwidth of a 256MB float32 sum reduction and copy for 0 (the inline
+   reduction) to N helper threads */
+UCC_TEST_F(test_mc_cpu_threads, DISABLED_perf)
+{
+    const size_t         bytes   = 256 << 20;
+    const size_t         size    = 1;
+    const int            n_iters = 4;
+    int                  n_cpus  = std::max(1L, sysconf(_SC_NPROCESSORS_ONLN));
+    std::vector<uint8_t> src1(bytes), src2(size * bytes), dst(bytes);
+    ucc_mc_req_t        *req;
+
+    for (int n_threads = 0; n_threads < n_cpus; n_threads++) {
+        init_mc(n_threads, "4Mb");
+        auto s = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < n_iters; i++) {
+            EXPECT_EQ(UCC_OK,
+                      wait(ucc_mc_reduce_multi_nb(
+                               src1.data(), src2.data(), dst.data(), size,
+                               bytes / sizeof(float), bytes, UCC_DT_FLOAT32,
+                               UCC_OP_SUM, UCC_MEMORY_TYPE_HOST, &req),
+                           req));
+        }
+        auto reduce = std::chrono::high_resolution_clock::now() - s;
+        s = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < n_iters; i++) {
+            EXPECT_EQ(UCC_OK, wait(ucc_mc_memcpy_nb(dst.data(), src1.data(),
+                                                    bytes,
+                                                    UCC_MEMORY_TYPE_HOST,
+                                                    UCC_MEMORY_TYPE_HOST,
+                                                    &req),
+                                   req));
+        }
+        auto copy = std::chrono::high_resolution_clock::now() - s;
+        ucc_mc_finalize();
+        std::cout << n_threads << " helper threads: reduce "
+                  << (double)(size + 2) * bytes * n_iters /
+                         std::chrono::duration<double>(reduce).count() / 1e9
+                  << " GB/s, memcpy "
+                  << 2.0 * bytes * n_iters /
+                         std::chrono::duration<double>(copy).count() / 1e9
+                  << " GB/s" << std::endl;
+    }
+}
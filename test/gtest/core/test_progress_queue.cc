@@ -0,0 +1,286 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ * See file LICENSE for terms.
+ */
+
+extern "C" {
+#include "core/ucc_progress_queue.h"
+}
+#include <common/test.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/* Dummy collective: completes after n_steps calls of progress. Detects the
+   concurrent progress of the same task and the double completion */
+typedef struct test_pq_task {
+    ucc_coll_task_t super;
+    uint32_t        n_steps;
+    uint32_t        busy;
+} test_pq_task_t;
+
+/* counters of the posting thread, updated by the completing one */
+typedef struct test_pq_thread {
+    std::atomic<uint32_t> n_done{0};
+    std::atomic<uint32_t> errors{0};
+} test_pq_thread_t;
+
+/* Completes once the task it depends on is completed */
+typedef struct test_pq_wait_task {
+    ucc_coll_task_t  super;
+    ucc_coll_task_t *dep;
+} test_pq_wait_task_t;
+
+static ucc_status_t test_pq_task_progress(ucc_coll_task_t *coll_task)
+{
+    test_pq_task_t   *task = ucc_derived_of(coll_task, test_pq_task_t);
+    test_pq_thread_t *th   = (test_pq_thread_t *)coll_task->cb.data;
+
+    if (!__sync_bool_compare_and_swap(&task->busy, 0, 1)) {
+        th->errors++;
+        return UCC_OK;
+    }
+    if (--task->n_steps == 0) {
+        task->super.super.status = UCC_OK;
+    }
+    task->busy = 0;
+    return UCC_OK;
+}
+
+static ucc_status_t test_pq_wait_task_progress(ucc_coll_task_t *coll_task)
+{
+    test_pq_wait_task_t *task = ucc_derived_of(coll_task, test_pq_wait_task_t);
+
+    if (task->dep->super.status == UCC_OK) {
+        task->super.super.status = UCC_OK;
+    }
+    return UCC_OK;
+}
+
+static void test_pq_task_cb(void *data, ucc_status_t status)
+{
+    test_pq_thread_t *th = (test_pq_thread_t *)data;
+
+    if (status != UCC_OK) {
+        th->errors++;
+    }
+    th->n_done++;
+}
+
+class test_progress_queue : public ucc::test {
+  public:
+    static const int n_tasks = 2000; /* per thread */
+    static const int n_steps = 4;
+    static const int window  = 64;   /* outstanding tasks per thread */
+    /* Every thread posts its own tasks and progresses the queue until all
+       the tasks of all the threads are completed. Returns ops/sec */
+    double run(uint32_t pq_type, int n_threads)
+    {
+        std::vector<test_pq_task_t>   tasks(n_threads * n_tasks);
+        std::vector<test_pq_thread_t> th(n_threads);
+        std::vector<std::thread>      threads;
+        ucc_progress_queue_t         *pq;
+        std::atomic<uint32_t>         n_done{0};
+
+        EXPECT_EQ(UCC_OK, ucc_progress_queue_init(&pq, UCC_THREAD_MULTIPLE,
+                                                  pq_type, 1024, 0));
+        auto s = std::chrono::high_resolution_clock::now();
+        for (int t = 0; t < n_threads; t++) {
+            threads.emplace_back([&, t]() {
+                test_pq_task_t *my_tasks = &tasks[t * n_tasks];
+                int             posted   = 0;
+                uint32_t        done     = 0;
+                uint32_t        cur;
+
+                while (n_done < (uint32_t)(n_threads * n_tasks)) {
+                    if (posted < n_tasks &&
+                        posted - (int)th[t].n_done.load() < window) {
+                        test_pq_task_t *task = &my_tasks[posted++];
+                        ucc_coll_task_init(&task->super);
+                        task->n_steps            = n_steps;
+                        task->busy               = 0;
+                        task->super.progress     = test_pq_task_progress;
+                        task->super.flags        = UCC_COLL_TASK_FLAG_CB;
+                        task->super.cb.cb        = test_pq_task_cb;
+                        task->super.cb.data      = &th[t];
+                        task->super.super.status = UCC_INPROGRESS;
+                        ucc_progress_enqueue(pq, &task->super);
+                    }
+                    ucc_progress_queue(pq);
+                    cur = th[t].n_done.load();
+                    if (cur != done) {
+                        n_done += cur - done;
+                        done    = cur;
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto time = std::chrono::high_resolution_clock::now() - s;
+        ucc_progress_queue_finalize(pq);
+        for (int t = 0; t < n_threads; t++) {
+            EXPECT_EQ(0u, th[t].errors.load());
+            EXPECT_EQ((uint32_t)n_tasks, th[t].n_done.load());
+        }
+        for (auto &task : tasks) {
+            EXPECT_EQ(UCC_OK, task.super.super.status);
+            EXPECT_EQ(0u, task.n_steps);
+        }
+        return (double)n_threads * n_tasks /
+               std::chrono::duration<double>(time).count();
+    }
+};
+
+/* Event driven queue: an EVENT_DRIVEN task is progressed once after enqueue
+   and then only after it is made runnable, other tasks on every call */
+UCC_TEST_F(test_progress_queue, event_driven)
+{
+    ucc_progress_queue_t *pq;
+    test_pq_task_t        tasks[2];
+    test_pq_thread_t      th;
+
+    ASSERT_EQ(UCC_OK, ucc_progress_queue_init(&pq, UCC_THREAD_SINGLE, 0, 0,
+                                              1));
+    for (auto &task : tasks) {
+        ucc_coll_task_init(&task.super);
+        task.n_steps            = 3;
+        task.busy               = 0;
+        task.super.progress     = test_pq_task_progress;
+        task.super.flags        = UCC_COLL_TASK_FLAG_CB;
+        task.super.cb.cb        = test_pq_task_cb;
+        task.super.cb.data      = &th;
+        task.super.super.status = UCC_INPROGRESS;
+    }
+    tasks[0].super.flags |= UCC_COLL_TASK_FLAG_EVENT_DRIVEN;
+    ucc_progress_enqueue(pq, &tasks[0].super);
+    ucc_progress_enqueue(pq, &tasks[1].super);
+
+    ucc_progress_queue(pq);
+    EXPECT_EQ(2u, tasks[0].n_steps);
+    EXPECT_EQ(2u, tasks[1].n_steps);
+    ucc_progress_queue(pq);
+    ucc_progress_queue(pq);
+    EXPECT_EQ(2u, tasks[0].n_steps);
+    EXPECT_EQ(0u, tasks[1].n_steps);
+    EXPECT_EQ(1u, th.n_done.load());
+
+    ucc_coll_task_set_runnable(&tasks[0].super);
+    ucc_progress_queue(pq);
+    EXPECT_EQ(1u, tasks[0].n_steps);
+    ucc_progress_queue(pq);
+    EXPECT_EQ(1u, tasks[0].n_steps);
+    ucc_coll_task_set_runnable(&tasks[0].super);
+    ucc_progress_queue(pq);
+    EXPECT_EQ(0u, tasks[0].n_steps);
+    EXPECT_EQ(2u, th.n_done.load());
+    EXPECT_EQ(0u, th.errors.load());
+    ucc_progress_queue_finalize(pq);
+}
+
+UCC_TEST_F(test_progress_queue, work_stealing_stress)
+{
+    for (int n_threads : {1, 8, 16, 32}) {
+        run(UCC_PQ_MT_WORK_STEALING, n_threads);
+    }
+}
+
+/* The task of the progressing thread waits for a task queued by a thread
+   which does not progress the queue anymore: the waiting thread's own
+   batch makes no progress, so it has to steal */
+UCC_TEST_F(test_progress_queue, work_stealing_idle_thread)
+{
+    ucc_progress_queue_t *pq;
+    test_pq_task_t        dep;
+    test_pq_wait_task_t   task;
+    test_pq_thread_t      th;
+
+    ASSERT_EQ(UCC_OK, ucc_progress_queue_init(&pq, UCC_THREAD_MULTIPLE,
+                                              UCC_PQ_MT_WORK_STEALING, 0, 0));
+    std::thread([&]() {
+        ucc_coll_task_init(&dep.super);
+        dep.n_steps            = n_steps;
+        dep.busy               = 0;
+        dep.super.progress     = test_pq_task_progress;
+        dep.super.flags        = UCC_COLL_TASK_FLAG_CB;
+        dep.super.cb.cb        = test_pq_task_cb;
+        dep.super.cb.data      = &th;
+        dep.super.super.status = UCC_INPROGRESS;
+        ucc_progress_enqueue(pq, &dep.super);
+    }).join();
+    ucc_coll_task_init(&task.super);
+    task.dep                = &dep.super;
+    task.super.progress     = test_pq_wait_task_progress;
+    task.super.flags        = UCC_COLL_TASK_FLAG_CB;
+    task.super.cb.cb        = test_pq_task_cb;
+    task.super.cb.data      = &th;
+    task.super.super.status = UCC_INPROGRESS;
+    ucc_progress_enqueue(pq, &task.super);
+    for (int i = 0; i < 1000 && th.n_done.load() < 2; i++) {
+        ucc_progress_queue(pq);
+    }
+    EXPECT_EQ(2u, th.n_done.load());
+    EXPECT_EQ(0u, th.errors.load());
+    ucc_progress_queue_finalize(pq);
+}
+
+/* Lock free queue with a ring smaller than the number of tasks: the ring
+   is kept full by the tasks waiting for the overflowed one, which has to
+   get its turn */
+UCC_TEST_F(test_progress_queue, lock_free_overflow)
+{
+    const int             n_wait = 8;
+    ucc_progress_queue_t *pq;
+    test_pq_task_t        dep;
+    test_pq_wait_task_t   tasks[n_wait];
+    test_pq_thread_t      th;
+
+    ASSERT_EQ(UCC_OK, ucc_progress_queue_init(&pq, UCC_THREAD_MULTIPLE,
+                                              UCC_PQ_MT_LOCK_FREE, n_wait,
+                                              0));
+    for (auto &task : tasks) {
+        ucc_coll_task_init(&task.super);
+        task.dep                = &dep.super;
+        task.super.progress     = test_pq_wait_task_progress;
+        task.super.flags        = UCC_COLL_TASK_FLAG_CB;
+        task.super.cb.cb        = test_pq_task_cb;
+        task.super.cb.data      = &th;
+        task.super.super.status = UCC_INPROGRESS;
+        ucc_progress_enqueue(pq, &task.super);
+    }
+    ucc_coll_task_init(&dep.super);
+    dep.n_steps            = n_steps;
+    dep.busy               = 0;
+    dep.super.progress     = test_pq_task_progress;
+    dep.super.flags        = UCC_COLL_TASK_FLAG_CB;
+    dep.super.cb.cb        = test_pq_task_cb;
+    dep.super.cb.data      = &th;
+    dep.super.super.status = UCC_INPROGRESS;
+    ucc_progress_enqueue(pq, &dep.super);
+    for (int i = 0; i < 1000 && th.n_done.load() < n_wait + 1; i++) {
+        ucc_progress_queue(pq);
+    }
+    EXPECT_EQ((uint32_t)n_wait + 1, th.n_done.load());
+    EXPECT_EQ(0u, th.errors.load());
+    ucc_progress_queue_finalize(pq);
+}
+
+/* Benchmark, not run by default (--gtest_also_run_disabled_tests): prints
+   the completion rate of the independent dummy collectives posted by all
+   the threads, for every multithreaded queue type */
+UCC_TEST_F(test_progress_queue, DISABLED_throughput)
+{
+    const char *names[] = {"locked", "lock free", "work stealing"};
+
+    for (int n_threads : {8, 16, 32}) {
+        for (uint32_t pq_type : {UCC_PQ_MT_LOCKED, UCC_PQ_MT_LOCK_FREE,
+                                 UCC_PQ_MT_WORK_STEALING}) {
+            double rate = run(pq_type, n_threads);
+            std::cout << "progress queue " << names[pq_type] << ", "
+                      << n_threads << " threads: " << (uint64_t)rate
+                      << " colls/sec" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,207 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ * See file LICENSE for terms.
+ */
+
+#include "test_mc_reduce.h"
+#include "common/test_ucc.h"
+#include "utils/ucc_math.h"
+
+#include <array>
+
+template<typename T>
+class test_reduce : public UccCollArgs, public testing::Test {
+  private:
+    int root;
+  public:
+    void data_init(int nprocs, ucc_datatype_t dt, size_t count,
+                   UccCollCtxVec &ctxs)
+    {
+        ctxs.resize(nprocs);
+        for (int r = 0; r < nprocs; r++) {
+            ucc_coll_args_t *coll = (ucc_coll_args_t*)
+                    calloc(1, sizeof(ucc_coll_args_t));
+
+            ctxs[r] = (gtest_ucc_coll_ctx_t*)calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args = coll;
+
+            coll->mask = UCC_COLL_ARGS_FIELD_PREDEFINED_REDUCTIONS;
+            coll->coll_type = UCC_COLL_TYPE_REDUCE;
+            coll->reduce.predefined_op = T::redop;
+            coll->root = root;
+
+            ctxs[r]->init_buf = ucc_malloc(ucc_dt_size(dt) * count, "init buf");
+            EXPECT_NE(ctxs[r]->init_buf, nullptr);
+            for (int i = 0; i < count; i++) {
+                typename T::type * ptr;
+                ptr = (typename T::type *)ctxs[r]->init_buf;
+                ptr[i] = (typename T::type)(2 * i + r + 1);
+            }
+
+            if (r == root) {
+                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->dst_mc_header,
+                                       ucc_dt_size(dt) * count, mem_type));
+                coll->dst.info.buffer = ctxs[r]->dst_mc_header->addr;
+            }
+            if (r == root && TEST_INPLACE == inplace) {
+                coll->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+                coll->flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+                UCC_CHECK(ucc_mc_memcpy(coll->dst.info.buffer, ctxs[r]->init_buf,
+                                        ucc_dt_size(dt) * count, mem_type,
+                                        UCC_MEMORY_TYPE_HOST));
+            } else {
+                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header,
+                                       ucc_dt_size(dt) * count, mem_type));
+                coll->src.info.buffer = ctxs[r]->src_mc_header->addr;
+                UCC_CHECK(ucc_mc_memcpy(coll->src.info.buffer, ctxs[r]->init_buf,
+                                        ucc_dt_size(dt) * count, mem_type,
+                                        UCC_MEMORY_TYPE_HOST));
+            }
+            coll->src.info.mem_type = mem_type;
+            coll->src.info.count   = (ucc_count_t)count;
+            coll->src.info.datatype = dt;
+
+            coll->dst.info.mem_type = mem_type;
+            coll->dst.info.count   = (ucc_count_t)count;
+            coll->dst.info.datatype = dt;
+        }
+    }
+    void data_fini(UccCollCtxVec ctxs) {
+        for (gtest_ucc_coll_ctx_t* ctx : ctxs) {
+            ucc_coll_args_t* coll = ctx->args;
+            if (coll->src.info.buffer) {
+                UCC_CHECK(ucc_mc_free(ctx->src_mc_header));
+            }
+            if (coll->dst.info.buffer) {
+                UCC_CHECK(ucc_mc_free(ctx->dst_mc_header));
+            }
+            ucc_free(ctx->init_buf);
+            free(coll);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
+    bool data_validate(UccCollCtxVec ctxs)
+    {
+        size_t            count = (ctxs[0])->args->src.info.count;
+        typename T::type *dsts;
+
+        if (UCC_MEMORY_TYPE_HOST != mem_type) {
+            dsts = (typename T::type *) ucc_malloc(count * sizeof(typename T::type), "dsts buf");
+            EXPECT_NE(dsts, nullptr);
+            UCC_CHECK(ucc_mc_memcpy(dsts, ctxs[root]->args->dst.info.buffer,
+                                    count * sizeof(typename T::type),
+                                    UCC_MEMORY_TYPE_HOST, mem_type));
+        } else {
+            dsts = (typename T::type *)(ctxs[root]->args->dst.info.buffer);
+        }
+        for (int i = 0; i < count; i++) {
+            typename T::type res =
+                    ((typename T::type *)((ctxs[0])->init_buf))[i];
+            for (int r = 1; r < ctxs.size(); r++) {
+                res = T::do_op(res, ((typename T::type *)((ctxs[r])->init_buf))[i]);
+            }
+            T::assert_equal(res, dsts[i]);
+        }
+        if (UCC_MEMORY_TYPE_HOST != mem_type) {
+            ucc_free(dsts);
+        }
+        return true;
+    }
+    void set_root(int _root)
+    {
+        root = _root;
+    }
+};
+
+TYPED_TEST_CASE(test_reduce, ReductionTypesOps);
+
+#define TEST_DECLARE(_mem_type, _inplace)                                      \
+{                                                                              \
+    std::array<int,3> counts {1,2,4};                                          \
+    for (int tid = 0; tid < UccJob::nStaticTeams; tid++) {                     \
+        UccTeam_h team = UccJob::getStaticTeams()[tid];                        \
+        int       size = team->procs.size();                                   \
+        for (int root : {0, size / 2}) {                                       \
+            for (int count : counts) {                                         \
+                UccCollCtxVec ctxs;                                            \
+                this->set_mem_type(_mem_type);                                 \
+                this->set_inplace(_inplace);                                   \
+                this->set_root(root);                                          \
+                this->data_init(size, TypeParam::dt, count, ctxs);             \
+                UccReq    req(team, ctxs);                                     \
+                req.start();                                                   \
+                req.wait();                                                    \
+                EXPECT_EQ(true, this->data_validate(ctxs));                    \
+                this->data_fini(ctxs);                                         \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+}
+
+TYPED_TEST(test_reduce, single_host) {
+    TEST_DECLARE(UCC_MEMORY_TYPE_HOST, TEST_NO_INPLACE);
+}
+
+TYPED_TEST(test_reduce, single_host_inplace) {
+    TEST_DECLARE(UCC_MEMORY_TYPE_HOST, TEST_INPLACE);
+}
+
+#ifdef HAVE_CUDA
+TYPED_TEST(test_reduce, single_cuda) {
+    TEST_DECLARE(UCC_MEMORY_TYPE_CUDA, TEST_NO_INPLACE);
+}
+
+TYPED_TEST(test_reduce, single_cuda_inplace) {
+    TEST_DECLARE(UCC_MEMORY_TYPE_CUDA, TEST_INPLACE);
+}
+#endif
+
+template<typename T>
+class test_reduce_alg : public test_reduce<T>
+{};
+
+using test_reduce_alg_type = ::testing::Types<ReductionTest<UCC_DT_INT32, sum>>;
+TYPED_TEST_CASE(test_reduce_alg, test_reduce_alg_type);
+
+#define TEST_DECLARE_WITH_ENV(_env, _n_procs)                                  \
+{                                                                              \
+    UccJob        job(_n_procs, UccJob::UCC_JOB_CTX_GLOBAL, _env);             \
+    UccTeam_h     team = job.create_team(_n_procs);                            \
+    UccCollCtxVec ctxs;                                                        \
+    for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {                     \
+        for (int root : {0, 3, _n_procs - 1}) {                                \
+            for (size_t count : {1, 3, 15, 1023, 65536}) {                     \
+                this->set_inplace(inplace);                                    \
+                this->set_mem_type(UCC_MEMORY_TYPE_HOST);                      \
+                this->set_root(root);                                          \
+                this->data_init(_n_procs, TypeParam::dt, count, ctxs);         \
+                UccReq req(team, ctxs);                                        \
+                req.start();                                                   \
+                req.wait();                                                    \
+                EXPECT_EQ(true, this->data_validate(ctxs));                    \
+                this->data_fini(ctxs);                                         \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+}
+
+TYPED_TEST(test_reduce_alg, knomial) {
+    int           n_procs = 15;
+    ucc_job_env_t env     = {{"UCC_TL_UCP_TUNE", "reduce:@knomial:inf"}};
+    TEST_DECLARE_WITH_ENV(env, n_procs);
+}
+
+TYPED_TEST(test_reduce_alg, chain) {
+    int           n_procs = 15;
+    ucc_job_env_t env     = {{"UCC_TL_UCP_TUNE", "reduce:@chain:inf"}};
+    TEST_DECLARE_WITH_ENV(env, n_procs);
+}
+
+TYPED_TEST(test_reduce_alg, chain_pipelined) {
+    int           n_procs = 15;
+    ucc_job_env_t env     = {{"UCC_TL_UCP_TUNE", "reduce:@chain:inf"},
+                             {"UCC_TL_UCP_REDUCE_CHAIN_FRAG_SIZE", "1K"},
+                             {"UCC_TL_UCP_REDUCE_CHAIN_PIPELINE_DEPTH", "3"}};
+    TEST_DECLARE_WITH_ENV(env, n_procs);
+}
@@ -6,12 +6,15 @@
 
 extern "C" {
 #include "utils/ucc_lock_free_queue.h"
+#include "utils/ucc_mpmc_queue.h"
 #include "utils/ucc_atomic.h"
 #include "utils/ucc_malloc.h"
 #include <pthread.h>
 #include <stdio.h>
 }
 #include <common/test.h>
+#include <chrono>
+#include <thread>
 #include <vector>
 
 #define NUM_ITERS 5000000
@@ -113,3 +116,168 @@ UCC_TEST_F(test_lf_queue, manyProducersManyConsumers)
 {
     EXPECT_EQ(lf_test(7, 7), 0);
 }
+
+class test_mpmc_queue : public ucc::test {
+  public:
+    static const int capacity = 64;
+    ucc_mpmc_queue_t queue;
+    int64_t          sum;
+    uint32_t         n_elems;
+    uint32_t         active_producers;
+    void             SetUp() override
+    {
+        ucc::test::SetUp();
+        ASSERT_EQ(UCC_OK, ucc_mpmc_queue_init(&queue, capacity));
+        sum              = 0;
+        n_elems          = 0;
+        active_producers = 0;
+    }
+    void TearDown() override
+    {
+        ucc_mpmc_queue_destroy(&queue);
+        ucc::test::TearDown();
+    }
+    /* every element enqueued by the producers has to be dequeued once by
+       the consumers, producers retry when the queue is full */
+    void mpmc_test(int n_producers, int n_consumers)
+    {
+        const int                n_iters = 1000000;
+        std::vector<std::thread> threads;
+
+        active_producers = n_producers;
+        for (int i = 0; i < n_producers; i++) {
+            threads.emplace_back([this, i, n_iters]() {
+                for (int j = 1; j <= n_iters; j++) {
+                    uintptr_t v = (uintptr_t)j * 64 + i;
+                    while (UCC_OK != ucc_mpmc_queue_enqueue(&queue,
+                                                            (void *)v)) {
+                    }
+                    ucc_atomic_add64((uint64_t *)&sum, v);
+                    ucc_atomic_add32(&n_elems, 1);
+                }
+                ucc_atomic_sub32(&active_producers, 1);
+            });
+        }
+        for (int i = 0; i < n_consumers; i++) {
+            threads.emplace_back([this]() {
+                while (active_producers || n_elems) {
+                    void *v = ucc_mpmc_queue_dequeue(&queue);
+                    if (v) {
+                        ucc_atomic_sub64((uint64_t *)&sum, (uint64_t)v);
+                        ucc_atomic_sub32(&n_elems, 1);
+                    }
+                }
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        EXPECT_EQ(0, sum);
+        EXPECT_EQ(nullptr, ucc_mpmc_queue_dequeue(&queue));
+    }
+};
+
+UCC_TEST_F(test_mpmc_queue, full_empty)
+{
+    std::vector<uintptr_t> elems(capacity);
+
+    EXPECT_EQ(nullptr, ucc_mpmc_queue_dequeue(&queue));
+    for (int i = 0; i < capacity; i++) {
+        elems[i] = i;
+        EXPECT_EQ(UCC_OK, ucc_mpmc_queue_enqueue(&queue, &elems[i]));
+    }
+    EXPECT_EQ(UCC_ERR_NO_RESOURCE, ucc_mpmc_queue_enqueue(&queue, &elems[0]));
+    /* FIFO order */
+    for (int i = 0; i < capacity; i++) {
+        EXPECT_EQ(&elems[i], ucc_mpmc_queue_dequeue(&queue));
+    }
+    EXPECT_EQ(nullptr, ucc_mpmc_queue_dequeue(&queue));
+}
+
+UCC_TEST_F(test_mpmc_queue, oneProducerManyConsumers)
+{
+    mpmc_test(1, 7);
+}
+
+UCC_TEST_F(test_mpmc_queue, manyProducersManyConsumers)
+{
+    mpmc_test(7, 7);
+}
+
+/* Benchmark, not run by default (--gtest_also_run_disabled_tests): every
+   thread owns one element, it enqueues the element it holds or tries to
+   dequeue one, as the progress queue does with the tasks in progress.
+   Prints the successful ops/sec of ucc_lf_queue and ucc_mpmc_queue */
+UCC_TEST_F(test_mpmc_queue, DISABLED_contention)
+{
+    const int n_iters = 100000;
+
+    for (int n_threads : {2, 4, 8, 16, 32, 64}) {
+        std::vector<ucc_lf_queue_elem_t> elems(n_threads);
+        std::vector<std::thread>         threads;
+        ucc_lf_queue_t                   lf_queue;
+        uint64_t                         ops_lf   = 0;
+        uint64_t                         ops_mpmc = 0;
+
+        ucc_lf_queue_init(&lf_queue);
+        auto s = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < n_threads; i++) {
+            threads.emplace_back([&, i]() {
+                ucc_lf_queue_elem_t *elem = &elems[i];
+                uint64_t             ops  = 0;
+
+                ucc_lf_queue_init_elem(elem);
+                for (int j = 0; j < n_iters; j++) {
+                    if (elem) {
+                        ucc_lf_queue_enqueue(&lf_queue, elem);
+                        elem = NULL;
+                        ops++;
+                    } else if ((elem = ucc_lf_queue_dequeue(&lf_queue, 1))) {
+                        ops++;
+                    }
+                }
+                ucc_atomic_add64(&ops_lf, ops);
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        auto t_lf = std::chrono::high_resolution_clock::now() - s;
+        ucc_lf_queue_destroy(&lf_queue);
+
+        threads.clear();
+        s = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < n_threads; i++) {
+            threads.emplace_back([&, i]() {
+                void    *elem = &elems[i];
+                uint64_t ops  = 0;
+
+                for (int j = 0; j < n_iters; j++) {
+                    if (elem) {
+                        /* never full: at most n_threads <= capacity elems */
+                        ucc_mpmc_queue_enqueue(&queue, elem);
+                        elem = NULL;
+                        ops++;
+                    } else if ((elem = ucc_mpmc_queue_dequeue(&queue))) {
+                        ops++;
+                    }
+                }
+                ucc_atomic_add64(&ops_mpmc, ops);
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        auto t_mpmc = std::chrono::high_resolution_clock::now() - s;
+        while (ucc_mpmc_queue_dequeue(&queue)) {
+        }
+
+        std::cout << n_threads << " threads: lf_queue "
+                  << (uint64_t)(ops_lf / std::chrono::duration<double>(t_lf)
+                                             .count())
+                  << " ops/sec, mpmc_queue "
+                  << (uint64_t)(ops_mpmc /
+                                std::chrono::duration<double>(t_mpmc).count())
+                  << " ops/sec" << std::endl;
+    }
+}
@@ -0,0 +1,176 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ * See file LICENSE for terms.
+ */
+
+extern "C" {
+#include "utils/ucc_mpool.h"
+#include "utils/ucc_atomic.h"
+}
+#include <common/test.h>
+#include <chrono>
+#include <climits>
+#include <thread>
+#include <vector>
+
+typedef struct test_mpool_obj {
+    uint32_t owner; /* 0 - free, thread index + 1 otherwise */
+    char     data[60];
+} test_mpool_obj_t;
+
+static uint32_t test_mpool_n_init;
+static uint32_t test_mpool_n_cleanup;
+
+static void test_mpool_obj_init(ucc_mpool_t *mp, void *obj, void *chunk)
+{
+    ((test_mpool_obj_t *)obj)->owner = 0;
+    ucc_atomic_add32(&test_mpool_n_init, 1);
+}
+
+static void test_mpool_obj_cleanup(ucc_mpool_t *mp, void *obj)
+{
+    ucc_atomic_add32(&test_mpool_n_cleanup, 1);
+}
+
+static ucc_mpool_ops_t test_mpool_ops = {
+    .chunk_alloc   = ucc_mpool_hugetlb_malloc,
+    .chunk_release = ucc_mpool_hugetlb_free,
+    .obj_init      = test_mpool_obj_init,
+    .obj_cleanup   = test_mpool_obj_cleanup
+};
+
+class test_mpool : public ucc::test {
+  public:
+    ucc_mpool_t mp;
+    uint32_t    errors;
+    void        init_mpool(unsigned max_elems)
+    {
+        test_mpool_n_init    = 0;
+        test_mpool_n_cleanup = 0;
+        errors               = 0;
+        ASSERT_EQ(UCC_OK, ucc_mpool_init(&mp, 0, sizeof(test_mpool_obj_t), 0,
+                                         UCC_CACHE_LINE_SIZE, 8, max_elems,
+                                         &test_mpool_ops, UCC_THREAD_MULTIPLE,
+                                         "test_mpool"));
+    }
+    test_mpool_obj_t *get(uint32_t owner)
+    {
+        test_mpool_obj_t *obj = (test_mpool_obj_t *)ucc_mpool_get(&mp);
+
+        if (!obj || !__sync_bool_compare_and_swap(&obj->owner, 0, owner)) {
+            ucc_atomic_add32(&errors, 1);
+            return NULL;
+        }
+        return obj;
+    }
+    void put(test_mpool_obj_t *obj)
+    {
+        obj->owner = 0;
+        ucc_mpool_put(obj);
+    }
+    /* every thread gets a burst of objects and puts them back n_iters
+       times, returns the time in seconds */
+    static const int burst = 8;
+    double get_put(int n_threads, unsigned max_elems, int n_iters)
+    {
+        std::vector<std::thread> threads;
+
+        init_mpool(max_elems);
+        auto s = std::chrono::high_resolution_clock::now();
+        for (int t = 0; t < n_threads; t++) {
+            threads.emplace_back([&, t]() {
+                test_mpool_obj_t *objs[burst];
+
+                for (int i = 0; i < n_iters; i++) {
+                    for (int j = 0; j < burst; j++) {
+                        objs[j] = get(t + 1);
+                    }
+                    for (int j = 0; j < burst; j++) {
+                        if (objs[j]) {
+                            put(objs[j]);
+                        }
+                    }
+                }
+            });
+        }
+        for (auto &th : threads) {
+            th.join();
+        }
+        auto time = std::chrono::high_resolution_clock::now() - s;
+        EXPECT_EQ(0u, errors);
+        ucc_mpool_cleanup(&mp, 1);
+        EXPECT_EQ(test_mpool_n_init, test_mpool_n_cleanup);
+        return std::chrono::duration<double>(time).count();
+    }
+};
+
+/* Objects are allocated by one thread and released by another one, then
+   the threads exit with objects left in their caches: no object is given
+   to two threads at once and the cleanup finds all the objects free */
+UCC_TEST_F(test_mpool, mt_leak_check)
+{
+    const int                                   n_threads = 16;
+    const int                                   n_objs    = 100;
+    std::vector<std::vector<test_mpool_obj_t *>> objs(n_threads);
+    std::vector<std::thread>                    threads;
+
+    init_mpool(UINT_MAX);
+    for (int t = 0; t < n_threads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < n_objs; i++) {
+                objs[t].push_back(get(t + 1));
+            }
+        });
+    }
+    for (auto &th : threads) {
+        th.join();
+    }
+    threads.clear();
+    EXPECT_EQ(0u, errors);
+    for (int t = 0; t < n_threads; t++) {
+        threads.emplace_back([&, t]() {
+            for (auto obj : objs[(t + 1) % n_threads]) {
+                if (obj) {
+                    put(obj);
+                }
+            }
+        });
+    }
+    for (auto &th : threads) {
+        th.join();
+    }
+    EXPECT_LT(0u, test_mpool_n_init);
+    ucc_mpool_cleanup(&mp, 1);
+    EXPECT_EQ(test_mpool_n_init, test_mpool_n_cleanup);
+}
+
+/* Every thread gets and puts a few objects in a loop, as the posting
+   threads do with the tasks, with the per thread caches and with the
+   locked shared pool (bounded mpool is not cached) */
+UCC_TEST_F(test_mpool, mt_get_put)
+{
+    for (int n_threads : {1, 4, 8, 16}) {
+        for (unsigned max_elems : {UINT_MAX, UINT_MAX - 1}) {
+            get_put(n_threads, max_elems, 1000);
+        }
+    }
+}
+
+/* Benchmark, not run by default (--gtest_also_run_disabled_tests): prints
+   ops/sec of the get/put loop of mt_get_put */
+UCC_TEST_F(test_mpool, DISABLED_mt_perf)
+{
+    const int n_iters = 100000;
+
+    for (int n_threads : {1, 4, 8, 16}) {
+        for (unsigned max_elems : {UINT_MAX, UINT_MAX - 1}) {
+            double time = get_put(n_threads, max_elems, n_iters);
+
+            std::cout << "mpool " << (max_elems == UINT_MAX ? "cached" :
+                                      "locked")
+                      << ", " << n_threads << " threads: "
+                      << (uint64_t)(2.0 * n_threads * n_iters * burst / time)
+                      << " ops/sec" << std::endl;
+        }
+    }
+}
@@ -23,6 +23,36 @@ void init_buffer_host(void *buf, size_t count, int _value)
     }
 }
 
+/* value-index pairs of MAXLOC and MINLOC: the index is the initial value
+   (the rank), so the ranks contribute different values at the same index */
+template<typename T>
+void init_buffer_host_loc(void *buf, size_t count, int _value)
+{
+    struct pair {
+        T       value;
+        int32_t index;
+    } *ptr = (struct pair *)buf;
+    for (size_t i = 0; i < count; i++) {
+        ptr[i].value = (T)((_value + i + 1) % 128);
+        ptr[i].index = _value;
+    }
+}
+
+template<typename T>
+ucc_status_t compare_buffers_loc(void *b1, void *b2, size_t count) {
+    struct pair {
+        T       value;
+        int32_t index;
+    } *p1 = (struct pair *)b1, *p2 = (struct pair *)b2;
+    /* compare the fields, the padding of the pair is not defined */
+    for (size_t i = 0; i < count; i++) {
+        if (p1[i].value != p2[i].value || p1[i].index != p2[i].index) {
+            return UCC_ERR_NO_MESSAGE;
+        }
+    }
+    return UCC_OK;
+}
+
 void init_buffer(void *_buf, size_t count, ucc_datatype_t dt,
                  ucc_memory_type_t mt, int value)
 {
@@ -67,6 +97,15 @@ void init_buffer(void *_buf, size_t count, ucc_datatype_t dt,
     case UCC_DT_FLOAT64:
         init_buffer_host<double>(buf, count, value);
         break;
+    case UCC_DT_FLOAT32_INT32:
+        init_buffer_host_loc<float>(buf, count, value);
+        break;
+    case UCC_DT_FLOAT64_INT32:
+        init_buffer_host_loc<double>(buf, count, value);
+        break;
+    case UCC_DT_INT32_INT32:
+        init_buffer_host_loc<int32_t>(buf, count, value);
+        break;
     default:
         std::cerr << "Unsupported dt\n";
         MPI_Abort(MPI_COMM_WORLD, -1);
@@ -119,6 +158,12 @@ ucc_status_t compare_buffers(void *_rst, void *expected, size_t count,
     } else if (dt == UCC_DT_FLOAT64) {
         status = compare_buffers_fp<double>((double*)rst, (double*)expected,
                                             count);
+    } else if (dt == UCC_DT_FLOAT32_INT32) {
+        status = compare_buffers_loc<float>(rst, expected, count);
+    } else if (dt == UCC_DT_FLOAT64_INT32) {
+        status = compare_buffers_loc<double>(rst, expected, count);
+    } else if (dt == UCC_DT_INT32_INT32) {
+        status = compare_buffers_loc<int32_t>(rst, expected, count);
     } else {
         status = memcmp(rst, expected, count*ucc_dt_size(dt)) ?
             UCC_ERR_NO_MESSAGE : UCC_OK;
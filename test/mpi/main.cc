@@ -12,7 +12,13 @@ static std::vector<ucc_coll_type_t> colls = {UCC_COLL_TYPE_BARRIER,
                                              UCC_COLL_TYPE_ALLGATHER,
                                              UCC_COLL_TYPE_ALLGATHERV,
                                              UCC_COLL_TYPE_ALLTOALL,
-                                             UCC_COLL_TYPE_ALLTOALLV};
+                                             UCC_COLL_TYPE_ALLTOALLV,
+                                             UCC_COLL_TYPE_GATHER,
+                                             UCC_COLL_TYPE_GATHERV,
+                                             UCC_COLL_TYPE_SCATTER,
+                                             UCC_COLL_TYPE_SCATTERV,
+                                             UCC_COLL_TYPE_REDUCE_SCATTER,
+                                             UCC_COLL_TYPE_REDUCE_SCATTERV};
 static std::vector<ucc_memory_type_t> mtypes = {UCC_MEMORY_TYPE_HOST};
 static std::vector<ucc_datatype_t> dtypes = {UCC_DT_INT32, UCC_DT_INT64,
                                              UCC_DT_FLOAT32, UCC_DT_FLOAT64};
@@ -52,11 +58,12 @@ static std::vector<std::string> str_split(const char *value, const char *delimit
 void PrintHelp()
 {
     std::cout <<
-       "--colls      <c1,c2,..>:        list of collectives: barrier,allreduce,allgather,allgatherv,bcast,alltoall,alltoallv\n"
+       "--colls      <c1,c2,..>:        list of collectives: barrier,allreduce,allgather,allgatherv,bcast,alltoall,alltoallv,gather,gatherv,scatter,scatterv,reduce_scatter,reduce_scatterv\n"
        "--teams      <t1,t2,..>:        list of teams: world,half,reverse,odd_even\n"
        "--mtypes     <m1,m2,..>:        list of mtypes: host,cuda\n"
-       "--dtypes     <d1,d2,..>:        list of dtypes: (u)int8(16,32,64),float32(64)\n"
-       "--ops        <o1,o2,..>:        list of ops:sum,prod,max,min,land,lor,lxor,band,bor,bxor\n"
+       "--dtypes     <d1,d2,..>:        list of dtypes: (u)int8(16,32,64),float32(64),\n"
+       "                                float32_int32,float64_int32,int32_int32 (maxloc,minloc only)\n"
+       "--ops        <o1,o2,..>:        list of ops:sum,prod,max,min,land,lor,lxor,band,bor,bxor,maxloc,minloc\n"
        "--inplace    <value>:           0 - no inplace, 1 - inplace, 2 - both\n"
        "--msgsize    <min:max[:power]>  mesage sizes range:\n"
        "--root       <type:[value]>     type of root selection: single:<value>, random:<value>, all\n"
@@ -113,6 +120,18 @@ static ucc_coll_type_t coll_str_to_type(std::string coll)
         return UCC_COLL_TYPE_ALLTOALL;
     } else if (coll == "alltoallv") {
         return UCC_COLL_TYPE_ALLTOALLV;
+    } else if (coll == "gather") {
+        return UCC_COLL_TYPE_GATHER;
+    } else if (coll == "gatherv") {
+        return UCC_COLL_TYPE_GATHERV;
+    } else if (coll == "scatter") {
+        return UCC_COLL_TYPE_SCATTER;
+    } else if (coll == "scatterv") {
+        return UCC_COLL_TYPE_SCATTERV;
+    } else if (coll == "reduce_scatter") {
+        return UCC_COLL_TYPE_REDUCE_SCATTER;
+    } else if (coll == "reduce_scatterv") {
+        return UCC_COLL_TYPE_REDUCE_SCATTERV;
     } else {
         std::cerr << "incorrect coll type: " << coll << std::endl;
         PrintHelp();
@@ -158,6 +177,12 @@ static ucc_datatype_t dtype_str_to_type(std::string dtype)
         return UCC_DT_FLOAT32;
     } else if (dtype == "float64") {
         return UCC_DT_FLOAT64;
+    } else if (dtype == "float32_int32") {
+        return UCC_DT_FLOAT32_INT32;
+    } else if (dtype == "float64_int32") {
+        return UCC_DT_FLOAT64_INT32;
+    } else if (dtype == "int32_int32") {
+        return UCC_DT_INT32_INT32;
     } else {
         std::cerr << "incorrect dtype: " << dtype << std::endl;
         PrintHelp();
@@ -187,6 +212,10 @@ static ucc_reduction_op_t op_str_to_type(std::string op)
         return UCC_OP_BOR;
     } else if (op == "bxor") {
         return UCC_OP_BXOR;
+    } else if (op == "maxloc") {
+        return UCC_OP_MAXLOC;
+    } else if (op == "minloc") {
+        return UCC_OP_MINLOC;
     } else {
         std::cerr << "incorrect op: " << op << std::endl;
         PrintHelp();
@@ -31,7 +31,14 @@ static inline MPI_Datatype ucc_dt_to_mpi(ucc_datatype_t dt) {
         return MPI_UINT64_T;
     case UCC_DT_FLOAT64:
         return MPI_DOUBLE;
+    case UCC_DT_FLOAT32_INT32:
+        return MPI_FLOAT_INT;
+    case UCC_DT_FLOAT64_INT32:
+        return MPI_DOUBLE_INT;
+    case UCC_DT_INT32_INT32:
+        return MPI_2INT;
     case UCC_DT_FLOAT16:
+    case UCC_DT_BFLOAT16:
     case UCC_DT_INT128:
     case UCC_DT_UINT128:
     default:
@@ -24,6 +24,12 @@ std::shared_ptr<TestCase> TestCase::init(ucc_coll_type_t _type,
     case UCC_COLL_TYPE_ALLREDUCE:
         return std::make_shared<TestAllreduce>(msgsize, inplace, dt,
                                                op, mt, _team, max_size);
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        return std::make_shared<TestReduceScatter>(msgsize, inplace, dt,
+                                                   op, mt, _team, max_size);
+    case UCC_COLL_TYPE_REDUCE_SCATTERV:
+        return std::make_shared<TestReduceScatterv>(msgsize, inplace, dt,
+                                                    op, mt, _team, max_size);
     case UCC_COLL_TYPE_ALLGATHER:
         return std::make_shared<TestAllgather>(msgsize, inplace, mt, _team,
                                                max_size);
@@ -33,6 +39,18 @@ std::shared_ptr<TestCase> TestCase::init(ucc_coll_type_t _type,
     case UCC_COLL_TYPE_BCAST:
         return std::make_shared<TestBcast>(msgsize, inplace, mt, root, _team,
                                            max_size);
+    case UCC_COLL_TYPE_GATHER:
+        return std::make_shared<TestGather>(msgsize, inplace, mt, root, _team,
+                                            max_size);
+    case UCC_COLL_TYPE_GATHERV:
+        return std::make_shared<TestGatherv>(msgsize, inplace, mt, root, _team,
+                                             max_size);
+    case UCC_COLL_TYPE_SCATTER:
+        return std::make_shared<TestScatter>(msgsize, inplace, mt, root, _team,
+                                             max_size);
+    case UCC_COLL_TYPE_SCATTERV:
+        return std::make_shared<TestScatterv>(msgsize, inplace, mt, root,
+                                              _team, max_size);
     case UCC_COLL_TYPE_ALLTOALL:
         return std::make_shared<TestAlltoall>(msgsize, inplace, mt, _team,
                                               max_size);
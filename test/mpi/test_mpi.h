@@ -279,6 +279,32 @@ public:
     std::string str();
 };
 
+class TestReduceScatter : public TestCase {
+    ucc_datatype_t dt;
+    ucc_reduction_op_t op;
+public:
+    TestReduceScatter(size_t _msgsize, ucc_test_mpi_inplace_t inplace,
+                      ucc_datatype_t _dt, ucc_reduction_op_t _op,
+                      ucc_memory_type_t _mt, ucc_test_team_t &team,
+                      size_t _max_size);
+    ucc_status_t check();
+    std::string str();
+};
+
+class TestReduceScatterv : public TestCase {
+    ucc_datatype_t dt;
+    ucc_reduction_op_t op;
+    int *counts;
+public:
+    TestReduceScatterv(size_t _msgsize, ucc_test_mpi_inplace_t inplace,
+                       ucc_datatype_t _dt, ucc_reduction_op_t _op,
+                       ucc_memory_type_t _mt, ucc_test_team_t &team,
+                       size_t _max_size);
+    ~TestReduceScatterv();
+    ucc_status_t check();
+    std::string str();
+};
+
 class TestAllgather : public TestCase {
 public:
     TestAllgather(size_t _msgsize, ucc_test_mpi_inplace_t inplace,
@@ -306,6 +332,25 @@ public:
     ucc_status_t check();
 };
 
+class TestGather : public TestCase {
+public:
+    TestGather(size_t _msgsize, ucc_test_mpi_inplace_t _inplace,
+               ucc_memory_type_t _mt, int root, ucc_test_team_t &team,
+               size_t _max_size);
+    ucc_status_t check();
+};
+
+class TestGatherv : public TestCase {
+    int *counts;
+    int *displacements;
+public:
+    TestGatherv(size_t _msgsize, ucc_test_mpi_inplace_t _inplace,
+                ucc_memory_type_t _mt, int root, ucc_test_team_t &team,
+                size_t _max_size);
+    ~TestGatherv();
+    ucc_status_t check() override;
+};
+
 class TestAlltoall : public TestCase {
 public:
     TestAlltoall(size_t _msgsize, ucc_test_mpi_inplace_t _inplace,
@@ -341,6 +386,25 @@ public:
     ~TestAlltoallv();
 };
 
+class TestScatter : public TestCase {
+public:
+    TestScatter(size_t _msgsize, ucc_test_mpi_inplace_t _inplace,
+                ucc_memory_type_t _mt, int root, ucc_test_team_t &team,
+                size_t _max_size);
+    ucc_status_t check();
+};
+
+class TestScatterv : public TestCase {
+    int *counts;
+    int *displacements;
+public:
+    TestScatterv(size_t _msgsize, ucc_test_mpi_inplace_t _inplace,
+                 ucc_memory_type_t _mt, int root, ucc_test_team_t &team,
+                 size_t _max_size);
+    ~TestScatterv();
+    ucc_status_t check() override;
+};
+
 void init_buffer(void *buf, size_t count, ucc_datatype_t dt,
                  ucc_memory_type_t mt, int value);
 
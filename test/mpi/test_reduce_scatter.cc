@@ -0,0 +1,83 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "test_mpi.h"
+#include "mpi_util.h"
+
+TestReduceScatter::TestReduceScatter(size_t _msgsize,
+                                     ucc_test_mpi_inplace_t _inplace,
+                                     ucc_datatype_t _dt, ucc_reduction_op_t _op,
+                                     ucc_memory_type_t _mt,
+                                     ucc_test_team_t &_team, size_t _max_size) :
+    TestCase(_team, _mt, _msgsize, _inplace, _max_size)
+{
+    size_t dt_size = ucc_dt_size(_dt);
+    size_t count = _msgsize/dt_size;
+    int rank, size;
+
+    MPI_Comm_rank(team.comm, &rank);
+    MPI_Comm_size(team.comm, &size);
+    op = _op;
+    dt = _dt;
+    args.coll_type = UCC_COLL_TYPE_REDUCE_SCATTER;
+
+    if (skip_reduce(test_max_size < (_msgsize*size), TEST_SKIP_MEM_LIMIT,
+                    team.comm)) {
+        return;
+    }
+
+    /* in place: the whole vector is taken from rbuf */
+    check_rbuf = ucc_malloc(_msgsize*size, "check rbuf");
+    UCC_MALLOC_CHECK(check_rbuf);
+    if (TEST_NO_INPLACE == inplace) {
+        UCC_CHECK(ucc_mc_alloc(&rbuf_mc_header, _msgsize, _mt));
+        rbuf = rbuf_mc_header->addr;
+        UCC_CHECK(ucc_mc_alloc(&sbuf_mc_header, _msgsize*size, _mt));
+        sbuf = sbuf_mc_header->addr;
+        init_buffer(sbuf, count*size, dt, _mt, rank);
+        UCC_ALLOC_COPY_BUF(check_sbuf_mc_header, UCC_MEMORY_TYPE_HOST, sbuf,
+                           _mt, _msgsize*size);
+        check_sbuf = check_sbuf_mc_header->addr;
+    } else {
+        args.mask = UCC_COLL_ARGS_FIELD_FLAGS;
+        args.flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        UCC_CHECK(ucc_mc_alloc(&rbuf_mc_header, _msgsize*size, _mt));
+        rbuf = rbuf_mc_header->addr;
+        init_buffer(rbuf, count*size, dt, _mt, rank);
+        init_buffer(check_rbuf, count*size, dt, UCC_MEMORY_TYPE_HOST, rank);
+    }
+
+    args.mask                |= UCC_COLL_ARGS_FIELD_PREDEFINED_REDUCTIONS;
+    args.reduce.predefined_op = _op;
+
+    args.src.info.buffer      = sbuf;
+    args.src.info.count       = count*size;
+    args.src.info.datatype    = _dt;
+    args.src.info.mem_type    = _mt;
+
+    args.dst.info.buffer      = rbuf;
+    args.dst.info.count       = count;
+    args.dst.info.datatype    = _dt;
+    args.dst.info.mem_type    = _mt;
+    UCC_CHECK_SKIP(ucc_collective_init(&args, &req, team.team), test_skip);
+}
+
+ucc_status_t TestReduceScatter::check()
+{
+    size_t count = args.dst.info.count;
+    MPI_Reduce_scatter_block(inplace ? MPI_IN_PLACE : check_sbuf, check_rbuf,
+                             count, ucc_dt_to_mpi(dt), ucc_op_to_mpi(op),
+                             team.comm);
+    return compare_buffers(rbuf, check_rbuf, count, dt, mem_type);
+}
+
+std::string TestReduceScatter::str() {
+    return std::string("tc=")+ucc_coll_type_str(args.coll_type) +
+        " team=" + team_str(team.type) + " msgsize=" +
+        std::to_string(msgsize) + " inplace=" +
+        (inplace == TEST_INPLACE ? "1" : "0") + " dt=" +
+        ucc_datatype_str(dt) + " op=" + ucc_reduction_op_str(op);
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "test_mpi.h"
+#include "mpi_util.h"
+
+TestReduceScatterv::TestReduceScatterv(size_t _msgsize,
+                                       ucc_test_mpi_inplace_t _inplace,
+                                       ucc_datatype_t _dt,
+                                       ucc_reduction_op_t _op,
+                                       ucc_memory_type_t _mt,
+                                       ucc_test_team_t &_team,
+                                       size_t _max_size) :
+    TestCase(_team, _mt, _msgsize, _inplace, _max_size)
+{
+    size_t dt_size = ucc_dt_size(_dt);
+    size_t count = _msgsize/dt_size;
+    size_t total_count = 0;
+    int rank, size;
+
+    counts = NULL;
+    MPI_Comm_rank(team.comm, &rank);
+    MPI_Comm_size(team.comm, &size);
+    op = _op;
+    dt = _dt;
+    args.coll_type = UCC_COLL_TYPE_REDUCE_SCATTERV;
+
+    if (skip_reduce(test_max_size < (_msgsize*size*2), TEST_SKIP_MEM_LIMIT,
+                    team.comm)) {
+        return;
+    }
+
+    /* odd ranks get twice as much as even ones */
+    counts = (int *) ucc_malloc(size * sizeof(uint32_t), "counts buf");
+    UCC_MALLOC_CHECK(counts);
+    for (int i = 0; i < size; i++) {
+        counts[i] = (i % 2 + 1) * count;
+        total_count += counts[i];
+    }
+    /* in place: the whole vector is taken from rbuf */
+    check_rbuf = ucc_malloc(total_count*dt_size, "check rbuf");
+    UCC_MALLOC_CHECK(check_rbuf);
+    if (TEST_NO_INPLACE == inplace) {
+        UCC_CHECK(ucc_mc_alloc(&rbuf_mc_header, counts[rank]*dt_size, _mt));
+        rbuf = rbuf_mc_header->addr;
+        UCC_CHECK(ucc_mc_alloc(&sbuf_mc_header, total_count*dt_size, _mt));
+        sbuf = sbuf_mc_header->addr;
+        init_buffer(sbuf, total_count, dt, _mt, rank);
+        UCC_ALLOC_COPY_BUF(check_sbuf_mc_header, UCC_MEMORY_TYPE_HOST, sbuf,
+                           _mt, total_count*dt_size);
+        check_sbuf = check_sbuf_mc_header->addr;
+    } else {
+        args.mask = UCC_COLL_ARGS_FIELD_FLAGS;
+        args.flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        UCC_CHECK(ucc_mc_alloc(&rbuf_mc_header, total_count*dt_size, _mt));
+        rbuf = rbuf_mc_header->addr;
+        init_buffer(rbuf, total_count, dt, _mt, rank);
+        init_buffer(check_rbuf, total_count, dt, UCC_MEMORY_TYPE_HOST, rank);
+    }
+
+    args.mask                |= UCC_COLL_ARGS_FIELD_PREDEFINED_REDUCTIONS;
+    args.reduce.predefined_op = _op;
+
+    args.src.info.buffer      = sbuf;
+    args.src.info.count       = total_count;
+    args.src.info.datatype    = _dt;
+    args.src.info.mem_type    = _mt;
+
+    args.dst.info_v.buffer    = rbuf;
+    args.dst.info_v.counts    = (ucc_count_t*)counts;
+    args.dst.info_v.datatype  = _dt;
+    args.dst.info_v.mem_type  = _mt;
+    UCC_CHECK_SKIP(ucc_collective_init(&args, &req, team.team), test_skip);
+}
+
+TestReduceScatterv::~TestReduceScatterv() {
+    if (counts) {
+        ucc_free(counts);
+    }
+}
+
+ucc_status_t TestReduceScatterv::check()
+{
+    int rank;
+
+    MPI_Comm_rank(team.comm, &rank);
+    MPI_Reduce_scatter(inplace ? MPI_IN_PLACE : check_sbuf, check_rbuf,
+                       counts, ucc_dt_to_mpi(dt), ucc_op_to_mpi(op), team.comm);
+    return compare_buffers(rbuf, check_rbuf, counts[rank], dt, mem_type);
+}
+
+std::string TestReduceScatterv::str() {
+    return std::string("tc=")+ucc_coll_type_str(args.coll_type) +
+        " team=" + team_str(team.type) + " msgsize=" +
+        std::to_string(msgsize) + " inplace=" +
+        (inplace == TEST_INPLACE ? "1" : "0") + " dt=" +
+        ucc_datatype_str(dt) + " op=" + ucc_reduction_op_str(op);
+}
@@ -0,0 +1,95 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "test_mpi.h"
+#include "mpi_util.h"
+
+#define TEST_DT UCC_DT_UINT32
+
+TestScatterv::TestScatterv(size_t _msgsize, ucc_test_mpi_inplace_t _inplace,
+                           ucc_memory_type_t _mt, int _root,
+                           ucc_test_team_t &_team, size_t _max_size) :
+    TestCase(_team, _mt, _msgsize, _inplace, _max_size)
+{
+    size_t dt_size = ucc_dt_size(TEST_DT);
+    size_t count = _msgsize/dt_size;
+    int rank, size;
+    counts = NULL;
+    displacements = NULL;
+    MPI_Comm_rank(team.comm, &rank);
+    MPI_Comm_size(team.comm, &size);
+    root = _root;
+    args.coll_type = UCC_COLL_TYPE_SCATTERV;
+
+    if (TEST_SKIP_NONE != skip_reduce(test_max_size < (_msgsize*size),
+                                      TEST_SKIP_MEM_LIMIT, team.comm)) {
+        return;
+    }
+
+    counts = (int *) ucc_malloc(size * sizeof(uint32_t), "counts buf");
+    UCC_MALLOC_CHECK(counts);
+    displacements = (int *) ucc_malloc(size * sizeof(uint32_t), "displacements buf");
+    UCC_MALLOC_CHECK(displacements);
+    for (int i = 0; i < size; i++) {
+        counts[i] = count;
+        displacements[i] = i * count;
+    }
+    if (rank == root) {
+        UCC_CHECK(ucc_mc_alloc(&sbuf_mc_header, _msgsize * size, _mt));
+        sbuf = sbuf_mc_header->addr;
+        for (int i = 0; i < size; i++) {
+            init_buffer((void*)((ptrdiff_t)sbuf + i*count*dt_size),
+                        count, TEST_DT, _mt, i);
+        }
+        UCC_ALLOC_COPY_BUF(check_sbuf_mc_header, UCC_MEMORY_TYPE_HOST, sbuf,
+                           _mt, _msgsize * size);
+        check_sbuf = check_sbuf_mc_header->addr;
+    }
+    if (rank == root && TEST_INPLACE == inplace) {
+        args.mask = UCC_COLL_ARGS_FIELD_FLAGS;
+        args.flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+    } else {
+        UCC_CHECK(ucc_mc_alloc(&rbuf_mc_header, _msgsize, _mt));
+        rbuf       = rbuf_mc_header->addr;
+        check_rbuf = ucc_malloc(_msgsize, "check rbuf");
+        UCC_MALLOC_CHECK(check_rbuf);
+    }
+
+    args.src.info_v.buffer        = sbuf;
+    args.src.info_v.counts        = (ucc_count_t*)counts;
+    args.src.info_v.displacements = (ucc_aint_t*)displacements;
+    args.src.info_v.datatype      = TEST_DT;
+    args.src.info_v.mem_type      = _mt;
+    args.dst.info.buffer          = rbuf;
+    args.dst.info.count           = count;
+    args.dst.info.datatype        = TEST_DT;
+    args.dst.info.mem_type        = _mt;
+    args.root                     = root;
+    UCC_CHECK_SKIP(ucc_collective_init(&args, &req, team.team), test_skip);
+}
+
+TestScatterv::~TestScatterv() {
+    if (counts) {
+        ucc_free(counts);
+    }
+    if (displacements) {
+        ucc_free(displacements);
+    }
+}
+
+ucc_status_t TestScatterv::check()
+{
+    size_t       count = counts[0];
+    MPI_Datatype dt    = ucc_dt_to_mpi(TEST_DT);
+    int          rank;
+
+    MPI_Comm_rank(team.comm, &rank);
+    MPI_Scatterv(check_sbuf, counts, displacements, dt,
+                 (rank == root && inplace) ? MPI_IN_PLACE : check_rbuf, count,
+                 dt, root, team.comm);
+    return (rank == root && inplace) ? UCC_OK :
+        compare_buffers(rbuf, check_rbuf, count, TEST_DT, mem_type);
+}
@@ -3,12 +3,14 @@
 #include "ucc_pt_config.h"
 #include "ucc_pt_coll.h"
 #include "ucc_pt_benchmark.h"
+#include "ucc_pt_tuner.h"
 
 int main(int argc, char *argv[])
 {
     ucc_pt_config pt_config;
     ucc_pt_comm *comm;
     ucc_pt_benchmark *bench;
+    ucc_pt_tuner *tuner;
     ucc_status_t st;
 
     pt_config.process_args(argc, argv);
@@ -23,6 +25,14 @@ int main(int argc, char *argv[])
         delete comm;
         std::exit(1);
     }
+    if (pt_config.tuner.enabled) {
+        tuner = new ucc_pt_tuner(pt_config, comm);
+        st    = tuner->run();
+        delete tuner;
+        comm->finalize();
+        delete comm;
+        return (st == UCC_OK) ? 0 : 1;
+    }
     try {
         bench = new ucc_pt_benchmark(pt_config.bench, comm);
     } catch(std::exception &e) {
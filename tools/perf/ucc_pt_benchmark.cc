@@ -2,7 +2,10 @@
 #include "ucc_pt_benchmark.h"
 #include "core/ucc_mc.h"
 #include "ucc_perftest.h"
+extern "C" {
+#include "components/base/ucc_base_iface.h"
 #include "utils/ucc_coll_utils.h"
+}
 
 ucc_pt_benchmark::ucc_pt_benchmark(ucc_pt_benchmark_config cfg,
                                    ucc_pt_comm *communcator):
@@ -35,6 +38,33 @@ ucc_pt_benchmark::ucc_pt_benchmark(ucc_pt_benchmark_config cfg,
     case UCC_COLL_TYPE_BCAST:
         coll = new ucc_pt_coll_bcast(cfg.dt, cfg.mt);
         break;
+    case UCC_COLL_TYPE_GATHER:
+        coll = new ucc_pt_coll_gather(comm->get_size(), cfg.dt, cfg.mt,
+                                      cfg.inplace);
+        break;
+    case UCC_COLL_TYPE_GATHERV:
+        coll = new ucc_pt_coll_gatherv(comm->get_size(), cfg.dt, cfg.mt,
+                                       cfg.inplace);
+        break;
+    case UCC_COLL_TYPE_REDUCE:
+        coll = new ucc_pt_coll_reduce(cfg.dt, cfg.mt, cfg.op, cfg.inplace);
+        break;
+    case UCC_COLL_TYPE_REDUCE_SCATTER:
+        coll = new ucc_pt_coll_reduce_scatter(comm->get_size(), cfg.dt, cfg.mt,
+                                              cfg.op, cfg.inplace);
+        break;
+    case UCC_COLL_TYPE_REDUCE_SCATTERV:
+        coll = new ucc_pt_coll_reduce_scatterv(comm->get_size(), cfg.dt,
+                                               cfg.mt, cfg.op, cfg.inplace);
+        break;
+    case UCC_COLL_TYPE_SCATTER:
+        coll = new ucc_pt_coll_scatter(comm->get_size(), cfg.dt, cfg.mt,
+                                       cfg.inplace);
+        break;
+    case UCC_COLL_TYPE_SCATTERV:
+        coll = new ucc_pt_coll_scatterv(comm->get_size(), cfg.dt, cfg.mt,
+                                        cfg.inplace);
+        break;
     default:
         throw std::runtime_error("not supported collective");
     }
@@ -57,6 +87,12 @@ ucc_status_t ucc_pt_benchmark::run_bench() noexcept
             iter = config.n_iter_large;
             warmup = config.n_warmup_large;
         }
+        if (config.n_outstanding > 1) {
+            UCCCHECK_GOTO(run_outstanding_test(cnt, warmup, iter, time),
+                          exit_err, st);
+            print_time(cnt, time);
+            continue;
+        }
         UCCCHECK_GOTO(coll->init_coll_args(cnt, args), exit_err, st);
         UCCCHECK_GOTO(run_single_test(args, warmup, iter, time), free_coll, st);
         coll->free_coll_args(args);
@@ -80,37 +116,159 @@ ucc_status_t ucc_pt_benchmark::run_single_test(ucc_coll_args_t args,
     ucc_status_t  st   = UCC_OK;
     ucc_coll_req_h req;
 
-    UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+    if (config.persistent) {
+        args.mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+        args.flags |= UCC_COLL_ARGS_FLAG_PERSISTENT;
+        UCCCHECK_GOTO(ucc_collective_init(&args, &req, team), exit_err, st);
+    }
+    UCCCHECK_GOTO(comm->barrier(), err, st);
     time = std::chrono::nanoseconds::zero();
     for (int i = 0; i < nwarmup + niter; i++) {
         auto s = std::chrono::high_resolution_clock::now();
-        UCCCHECK_GOTO(ucc_collective_init(&args, &req, team), exit_err, st);
+        if (!config.persistent) {
+            UCCCHECK_GOTO(ucc_collective_init(&args, &req, team), exit_err, st);
+        }
         UCCCHECK_GOTO(ucc_collective_post(req), free_req, st);
         st = ucc_collective_test(req);
         while (st == UCC_INPROGRESS) {
             UCCCHECK_GOTO(ucc_context_progress(ctx), free_req, st);
             st = ucc_collective_test(req);
         }
-        ucc_collective_finalize(req);
+        if (!config.persistent) {
+            ucc_collective_finalize(req);
+        }
         auto f = std::chrono::high_resolution_clock::now();
         if (st != UCC_OK) {
-            goto exit_err;
+            goto err;
         }
         if (i >= nwarmup) {
             time += std::chrono::duration_cast<std::chrono::nanoseconds>(f - s);
         }
-        UCCCHECK_GOTO(comm->barrier(), exit_err, st);
+        UCCCHECK_GOTO(comm->barrier(), err, st);
     }
     if (niter != 0) {
         time /= niter;
     }
+    if (config.persistent) {
+        ucc_collective_finalize(req);
+    }
     return UCC_OK;
 free_req:
     ucc_collective_finalize(req);
+    return st;
+err:
+    /* persistent request is still alive, non persistent one is released */
+    if (config.persistent) {
+        ucc_collective_finalize(req);
+    }
 exit_err:
     return st;
 }
 
+/* Every iteration posts n_outstanding collectives, each one with its own
+   buffers, and waits for all of them. The time is per collective */
+ucc_status_t ucc_pt_benchmark::run_outstanding_test(size_t count,
+                                                    int nwarmup, int niter,
+                                                    std::chrono::nanoseconds
+                                                    &time) noexcept
+{
+    ucc_team_h                   team = comm->get_team();
+    ucc_context_h                ctx  = comm->get_context();
+    int                          n    = config.n_outstanding;
+    std::vector<ucc_coll_args_t> args(n);
+    std::vector<ucc_coll_req_h>  reqs(n);
+    ucc_status_t                 st   = UCC_OK;
+    int                          n_args, n_reqs, n_done, i, j;
+
+    n_reqs = 0;
+    for (n_args = 0; n_args < n; n_args++) {
+        UCCCHECK_GOTO(coll->init_coll_args(count, args[n_args]), free_args,
+                      st);
+    }
+    UCCCHECK_GOTO(comm->barrier(), free_args, st);
+    time = std::chrono::nanoseconds::zero();
+    for (i = 0; i < nwarmup + niter; i++) {
+        auto s = std::chrono::high_resolution_clock::now();
+        for (n_reqs = 0; n_reqs < n; n_reqs++) {
+            UCCCHECK_GOTO(ucc_collective_init(&args[n_reqs], &reqs[n_reqs],
+                                              team), free_reqs, st);
+        }
+        for (j = 0; j < n; j++) {
+            UCCCHECK_GOTO(ucc_collective_post(reqs[j]), free_reqs, st);
+        }
+        do {
+            UCCCHECK_GOTO(ucc_context_progress(ctx), free_reqs, st);
+            for (n_done = 0, j = 0; j < n; j++) {
+                st = ucc_collective_test(reqs[j]);
+                if (st < 0) {
+                    goto free_reqs;
+                }
+                n_done += (st == UCC_OK);
+            }
+        } while (n_done < n);
+        for (j = 0; j < n; j++) {
+            ucc_collective_finalize(reqs[j]);
+        }
+        n_reqs = 0;
+        auto f = std::chrono::high_resolution_clock::now();
+        if (i >= nwarmup) {
+            time += std::chrono::duration_cast<std::chrono::nanoseconds>(f - s);
+        }
+        UCCCHECK_GOTO(comm->barrier(), free_args, st);
+    }
+    if (niter != 0) {
+        time /= niter * n;
+    }
+    st = UCC_OK;
+    goto free_args;
+free_reqs:
+    for (j = 0; j < n_reqs; j++) {
+        ucc_collective_finalize(reqs[j]);
+    }
+free_args:
+    for (j = 0; j < n_args; j++) {
+        coll->free_coll_args(args[j]);
+    }
+    return st;
+}
+
+/* Runs the collective with the given count and returns the max time over
+   the ranks (us) along with the msgsize used by the score based selection */
+ucc_status_t ucc_pt_benchmark::run_count(size_t count, size_t &msgsize,
+                                         float &time_max) noexcept
+{
+    size_t coll_size = count * ucc_dt_size(config.dt);
+    int iter = config.n_iter_small;
+    int warmup = config.n_warmup_small;
+    ucc_base_coll_args_t bargs;
+    ucc_coll_args_t args;
+    std::chrono::nanoseconds time;
+    ucc_status_t st;
+    float time_us;
+
+    if (coll_size >= config.large_thresh) {
+        iter = config.n_iter_large;
+        warmup = config.n_warmup_large;
+    }
+    UCCCHECK_GOTO(coll->init_coll_args(count, args), exit_err, st);
+    UCCCHECK_GOTO(run_single_test(args, warmup, iter, time), free_coll, st);
+    bargs.args = args;
+    bargs.team = comm->get_team();
+    msgsize    = ucc_coll_args_msgsize(&bargs);
+    coll->free_coll_args(args);
+    time_us = time.count() / 1000.0;
+    return comm->allreduce(&time_us, &time_max, 1, UCC_OP_MAX);
+free_coll:
+    coll->free_coll_args(args);
+exit_err:
+    return st;
+}
+
+bool ucc_pt_benchmark::has_range()
+{
+    return coll->has_range();
+}
+
 void ucc_pt_benchmark::print_header()
 {
     if (comm->get_rank() == 0) {
@@ -137,6 +295,12 @@ void ucc_pt_benchmark::print_header()
                         std::to_string(config.inplace):
                         "N/A")
                   << std::endl;
+        std::cout << std::left << std::setw(24)
+                  << "Persistent: " << std::to_string(config.persistent)
+                  << std::endl;
+        std::cout << std::left << std::setw(24)
+                  << "Outstanding: " << config.n_outstanding
+                  << std::endl;
         std::cout << std::left << std::setw(24)
                   << "Warmup:" << std::endl
                   << std::left << std::setw(24)
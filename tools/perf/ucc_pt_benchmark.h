@@ -27,6 +27,11 @@ public:
     ucc_status_t run_single_test(ucc_coll_args_t args,
                                  int nwarmup, int niter,
                                  std::chrono::nanoseconds &time) noexcept;
+    ucc_status_t run_outstanding_test(size_t count, int nwarmup, int niter,
+                                      std::chrono::nanoseconds &time) noexcept;
+    ucc_status_t run_count(size_t count, size_t &msgsize,
+                           float &time_max) noexcept;
+    bool has_range();
     ~ucc_pt_benchmark();
 };
 
@@ -100,4 +100,80 @@ public:
     double get_bus_bw(double time_us) override;
 };
 
+class ucc_pt_coll_gather: public ucc_pt_coll {
+protected:
+    int comm_size;
+public:
+    ucc_pt_coll_gather(int size, ucc_datatype_t dt, ucc_memory_type mt,
+                       bool is_inplace);
+    ucc_status_t init_coll_args(size_t count, ucc_coll_args_t &args) override;
+    void free_coll_args(ucc_coll_args_t &args) override;
+    double get_bus_bw(double time_us) override;
+};
+
+class ucc_pt_coll_gatherv: public ucc_pt_coll {
+protected:
+    int comm_size;
+public:
+    ucc_pt_coll_gatherv(int size, ucc_datatype_t dt, ucc_memory_type mt,
+                        bool is_inplace);
+    ucc_status_t init_coll_args(size_t count, ucc_coll_args_t &args) override;
+    void free_coll_args(ucc_coll_args_t &args) override;
+    double get_bus_bw(double time_us) override;
+};
+
+class ucc_pt_coll_reduce: public ucc_pt_coll {
+public:
+    ucc_pt_coll_reduce(ucc_datatype_t dt, ucc_memory_type mt,
+                       ucc_reduction_op_t op, bool is_inplace);
+    ucc_status_t init_coll_args(size_t count, ucc_coll_args_t &args) override;
+    void free_coll_args(ucc_coll_args_t &args) override;
+    double get_bus_bw(double time_us) override;
+};
+
+class ucc_pt_coll_reduce_scatter: public ucc_pt_coll {
+protected:
+    int comm_size;
+public:
+    ucc_pt_coll_reduce_scatter(int size, ucc_datatype_t dt, ucc_memory_type mt,
+                               ucc_reduction_op_t op, bool is_inplace);
+    ucc_status_t init_coll_args(size_t count, ucc_coll_args_t &args) override;
+    void free_coll_args(ucc_coll_args_t &args) override;
+    double get_bus_bw(double time_us) override;
+};
+
+class ucc_pt_coll_reduce_scatterv: public ucc_pt_coll {
+protected:
+    int comm_size;
+public:
+    ucc_pt_coll_reduce_scatterv(int size, ucc_datatype_t dt,
+                                ucc_memory_type mt, ucc_reduction_op_t op,
+                                bool is_inplace);
+    ucc_status_t init_coll_args(size_t count, ucc_coll_args_t &args) override;
+    void free_coll_args(ucc_coll_args_t &args) override;
+    double get_bus_bw(double time_us) override;
+};
+
+class ucc_pt_coll_scatter: public ucc_pt_coll {
+protected:
+    int comm_size;
+public:
+    ucc_pt_coll_scatter(int size, ucc_datatype_t dt, ucc_memory_type mt,
+                        bool is_inplace);
+    ucc_status_t init_coll_args(size_t count, ucc_coll_args_t &args) override;
+    void free_coll_args(ucc_coll_args_t &args) override;
+    double get_bus_bw(double time_us) override;
+};
+
+class ucc_pt_coll_scatterv: public ucc_pt_coll {
+protected:
+    int comm_size;
+public:
+    ucc_pt_coll_scatterv(int size, ucc_datatype_t dt, ucc_memory_type mt,
+                         bool is_inplace);
+    ucc_status_t init_coll_args(size_t count, ucc_coll_args_t &args) override;
+    void free_coll_args(ucc_coll_args_t &args) override;
+    double get_bus_bw(double time_us) override;
+};
+
 #endif
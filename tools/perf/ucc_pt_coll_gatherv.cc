@@ -0,0 +1,77 @@
+#include "ucc_pt_coll.h"
+#include "ucc_perftest.h"
+#include <ucc/api/ucc.h>
+#include <utils/ucc_math.h>
+#include <utils/ucc_coll_utils.h>
+
+ucc_pt_coll_gatherv::ucc_pt_coll_gatherv(int size, ucc_datatype_t dt,
+                                         ucc_memory_type mt, bool is_inplace):
+    comm_size(size)
+{
+    has_inplace_   = true;
+    has_reduction_ = false;
+    has_range_     = true;
+
+    coll_args.mask = 0;
+    coll_args.coll_type = UCC_COLL_TYPE_GATHERV;
+    coll_args.root = 0;
+    coll_args.src.info.datatype = dt;
+    coll_args.src.info.mem_type = mt;
+    coll_args.dst.info_v.datatype = dt;
+    coll_args.dst.info_v.mem_type = mt;
+    if (is_inplace) {
+        coll_args.mask = UCC_COLL_ARGS_FIELD_FLAGS;
+        coll_args.flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+    }
+}
+
+ucc_status_t ucc_pt_coll_gatherv::init_coll_args(size_t count,
+                                                 ucc_coll_args_t &args)
+{
+    size_t       dt_size  = ucc_dt_size(coll_args.src.info.datatype);
+    size_t       size_src = count * dt_size;
+    size_t       size_dst = comm_size * count * dt_size;
+    ucc_status_t st;
+
+    args = coll_args;
+    args.src.info.count = count;
+    /* dst is significant at root only, buffers are allocated on every rank
+       for simplicity */
+    args.dst.info_v.counts = (ucc_count_t *) ucc_malloc(comm_size * sizeof(uint32_t), "counts buf");
+    UCC_MALLOC_CHECK_GOTO(args.dst.info_v.counts, exit, st);
+    args.dst.info_v.displacements = (ucc_aint_t *) ucc_malloc(comm_size * sizeof(uint32_t), "displacements buf");
+    UCC_MALLOC_CHECK_GOTO(args.dst.info_v.displacements, free_count, st);
+    UCCCHECK_GOTO(ucc_mc_alloc(&dst_header, size_dst, args.dst.info_v.mem_type),
+                  free_displ, st);
+    args.dst.info_v.buffer = dst_header->addr;
+    UCCCHECK_GOTO(ucc_mc_alloc(&src_header, size_src, args.src.info.mem_type),
+                  free_dst, st);
+    args.src.info.buffer = src_header->addr;
+    for (int i = 0; i < comm_size; i++) {
+        ((uint32_t*)args.dst.info_v.counts)[i] = count;
+        ((uint32_t*)args.dst.info_v.displacements)[i] = count * i;
+    }
+    return UCC_OK;
+free_dst:
+    ucc_mc_free(dst_header);
+free_displ:
+    ucc_free(args.dst.info_v.displacements);
+free_count:
+    ucc_free(args.dst.info_v.counts);
+exit:
+    return st;
+}
+
+void ucc_pt_coll_gatherv::free_coll_args(ucc_coll_args_t &args)
+{
+    ucc_mc_free(src_header);
+    ucc_mc_free(dst_header);
+    ucc_free(args.dst.info_v.counts);
+    ucc_free(args.dst.info_v.displacements);
+}
+
+double ucc_pt_coll_gatherv::get_bus_bw(double time_us)
+{
+    //TODO
+    return 0.0;
+}
@@ -41,6 +41,11 @@ int ucc_pt_comm::get_size()
     return bootstrap->get_size();
 }
 
+int ucc_pt_comm::get_ppn()
+{
+    return bootstrap->get_ppn();
+}
+
 ucc_team_h ucc_pt_comm::get_team()
 {
     return team;
@@ -9,11 +9,15 @@ ucc_pt_config::ucc_pt_config() {
     bench.mt             = UCC_MEMORY_TYPE_HOST;
     bench.op             = UCC_OP_SUM;
     bench.inplace        = false;
+    bench.persistent     = false;
+    bench.n_outstanding  = 1;
     bench.n_iter_small   = 1000;
     bench.n_warmup_small = 100;
     bench.n_iter_large   = 200;
     bench.n_warmup_large = 20;
     bench.large_thresh   = 64 * 1024;
+    tuner.enabled        = false;
+    tuner.radices        = {2, 4, 8};
 }
 
 const std::map<std::string, ucc_reduction_op_t> ucc_pt_op_map = {
@@ -21,6 +25,8 @@ const std::map<std::string, ucc_reduction_op_t> ucc_pt_op_map = {
     {"prod", UCC_OP_PROD},
     {"min", UCC_OP_MIN},
     {"max", UCC_OP_MAX},
+    {"maxloc", UCC_OP_MAXLOC},
+    {"minloc", UCC_OP_MINLOC},
 };
 
 const std::map<std::string, ucc_coll_type_t> ucc_pt_coll_map = {
@@ -31,6 +37,13 @@ const std::map<std::string, ucc_coll_type_t> ucc_pt_coll_map = {
     {"alltoallv", UCC_COLL_TYPE_ALLTOALLV},
     {"barrier", UCC_COLL_TYPE_BARRIER},
     {"bcast", UCC_COLL_TYPE_BCAST},
+    {"gather", UCC_COLL_TYPE_GATHER},
+    {"gatherv", UCC_COLL_TYPE_GATHERV},
+    {"reduce", UCC_COLL_TYPE_REDUCE},
+    {"reduce_scatter", UCC_COLL_TYPE_REDUCE_SCATTER},
+    {"reduce_scatterv", UCC_COLL_TYPE_REDUCE_SCATTERV},
+    {"scatter", UCC_COLL_TYPE_SCATTER},
+    {"scatterv", UCC_COLL_TYPE_SCATTERV},
 };
 
 const std::map<std::string, ucc_memory_type_t> ucc_pt_memtype_map = {
@@ -44,6 +57,7 @@ const std::map<std::string, ucc_datatype_t> ucc_pt_datatype_map = {
     {"int16", UCC_DT_INT16},
     {"uint16", UCC_DT_UINT16},
     {"float16", UCC_DT_FLOAT16},
+    {"bfloat16", UCC_DT_BFLOAT16},
     {"int32", UCC_DT_INT32},
     {"float32", UCC_DT_FLOAT32},
     {"int64", UCC_DT_INT64},
@@ -51,13 +65,19 @@ const std::map<std::string, ucc_datatype_t> ucc_pt_datatype_map = {
     {"float64", UCC_DT_FLOAT64},
     {"int128", UCC_DT_INT128},
     {"uint128", UCC_DT_UINT128},
+    {"float32_int32", UCC_DT_FLOAT32_INT32},
+    {"float64_int32", UCC_DT_FLOAT64_INT32},
+    {"int32_int32", UCC_DT_INT32_INT32},
 };
 
 ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
 {
+    std::string radix;
+    std::stringstream radices;
+    unsigned r;
     int c;
 
-    while ((c = getopt(argc, argv, "c:b:e:d:m:n:w:o:ih")) != -1) {
+    while ((c = getopt(argc, argv, "c:b:e:d:m:n:w:o:O:ipTF:R:h")) != -1) {
         switch (c) {
             case 'c':
                 if (ucc_pt_coll_map.count(optarg) == 0) {
@@ -65,6 +85,7 @@ ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
                     return UCC_ERR_INVALID_PARAM;
                 }
                 bench.coll_type = ucc_pt_coll_map.at(optarg);
+                tuner.colls.push_back(bench.coll_type);
                 break;
             case 'o':
                 if (ucc_pt_op_map.count(optarg) == 0) {
@@ -102,15 +123,49 @@ ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
                 std::stringstream(optarg) >> bench.n_warmup_small;
                 bench.n_warmup_large = bench.n_warmup_small;
                 break;
+            case 'O':
+                std::stringstream(optarg) >> bench.n_outstanding;
+                if (bench.n_outstanding < 1) {
+                    std::cerr << "invalid number of outstanding collectives"
+                              << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                break;
             case 'i':
                 bench.inplace = true;
                 break;
+            case 'p':
+                bench.persistent = true;
+                break;
+            case 'T':
+                tuner.enabled = true;
+                break;
+            case 'F':
+                tuner.output = optarg;
+                break;
+            case 'R':
+                tuner.radices.clear();
+                radices.str(optarg);
+                while (std::getline(radices, radix, ',')) {
+                    r = 0;
+                    std::stringstream(radix) >> r;
+                    if (r < 2) {
+                        std::cerr << "invalid radix" << std::endl;
+                        return UCC_ERR_INVALID_PARAM;
+                    }
+                    tuner.radices.push_back(r);
+                }
+                break;
             case 'h':
             default:
                 print_help();
                 std::exit(0);
         }
     }
+    if (bench.persistent && bench.n_outstanding > 1) {
+        std::cerr << "persistent collectives can't be outstanding" << std::endl;
+        return UCC_ERR_INVALID_PARAM;
+    }
     return UCC_OK;
 }
 
@@ -121,11 +176,20 @@ void ucc_pt_config::print_help()
     std::cout << "  -b <count>: Min number of elements"<<std::endl;
     std::cout << "  -e <count>: Max number of elements"<<std::endl;
     std::cout << "  -i: inplace collective"<<std::endl;
+    std::cout << "  -p: persistent collective"<<std::endl;
     std::cout << "  -d <dt name>: datatype"<<std::endl;
     std::cout << "  -o <op name>: reduction operation type"<<std::endl;
     std::cout << "  -m <mtype name>: memory type"<<std::endl;
     std::cout << "  -n <number>: number of iterations"<<std::endl;
     std::cout << "  -w <number>: number of warmup iterations"<<std::endl;
+    std::cout << "  -O <number>: number of collectives outstanding at once, "
+                 "time is per collective"<<std::endl;
+    std::cout << "  -T: generate tuning table: sweep all TL/UCP algorithms "
+                 "and radices over [-b, -e] for the collectives given by -c "
+                 "(all if none)"<<std::endl;
+    std::cout << "  -F <file>: tuning table output file"<<std::endl;
+    std::cout << "  -R <r1,r2,..>: radices of knomial algorithms to sweep "
+                 "(default: 2,4,8)"<<std::endl;
     std::cout << "  -h: show this help message"<<std::endl;
     std::cout << std::endl;
 }
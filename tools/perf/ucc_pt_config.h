@@ -11,6 +11,7 @@
 #include <sstream>
 #include <string>
 #include <map>
+#include <vector>
 #include <getopt.h>
 #include <ucc/api/ucc.h>
 
@@ -35,6 +36,8 @@ struct ucc_pt_benchmark_config {
     ucc_memory_type_t  mt;
     ucc_reduction_op_t op;
     bool               inplace;
+    bool               persistent;
+    int                n_outstanding;
     size_t             large_thresh;
     int                n_iter_small;
     int                n_warmup_small;
@@ -42,10 +45,21 @@ struct ucc_pt_benchmark_config {
     int                n_warmup_large;
 };
 
+struct ucc_pt_tuner_config {
+    bool                         enabled;
+    std::vector<ucc_coll_type_t> colls;
+    std::vector<unsigned>        radices;
+    std::string                  output;
+};
+
+extern const std::map<std::string, ucc_coll_type_t>   ucc_pt_coll_map;
+extern const std::map<std::string, ucc_memory_type_t> ucc_pt_memtype_map;
+
 struct ucc_pt_config {
     ucc_pt_bootstrap_config bootstrap;
     ucc_pt_comm_config      comm;
     ucc_pt_benchmark_config bench;
+    ucc_pt_tuner_config     tuner;
 
     ucc_pt_config();
     ucc_status_t process_args(int argc, char *argv[]);
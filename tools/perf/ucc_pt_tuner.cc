@@ -0,0 +1,297 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <cstdlib>
+#include "ucc_pt_tuner.h"
+#include "ucc_pt_benchmark.h"
+#include "ucc_perftest.h"
+extern "C" {
+#include "core/ucc_global_opts.h"
+#include "components/tl/ucc_tl.h"
+#include "utils/ucc_math.h"
+}
+
+/* The candidate settings are passed to UCC with the perftest env prefix:
+   they take precedence over the UCC_ variables set by the user */
+#define UCC_PT_TUNER_ENV_PREFIX "PERFTEST_UCC_TL_UCP_"
+#define UCC_PT_TUNER_CFG_PREFIX "UCC_TL_UCP_"
+
+struct ucc_pt_tuner_radix_cfg {
+    ucc_coll_type_t coll_type;
+    const char     *alg;
+    const char     *var;
+};
+
+static const ucc_pt_tuner_radix_cfg ucc_pt_tuner_radix_cfgs[] = {
+    {UCC_COLL_TYPE_ALLREDUCE, "knomial", "ALLREDUCE_KN_RADIX"},
+    {UCC_COLL_TYPE_ALLREDUCE, "sra_knomial", "ALLREDUCE_SRA_KN_RADIX"},
+    {UCC_COLL_TYPE_BCAST, "knomial", "BCAST_KN_RADIX"},
+    {UCC_COLL_TYPE_BCAST, "sag_knomial", "BCAST_SAG_KN_RADIX"},
+    {UCC_COLL_TYPE_REDUCE, "knomial", "REDUCE_KN_RADIX"},
+    {UCC_COLL_TYPE_REDUCE_SCATTER, "knomial", "REDUCE_SCATTER_KN_RADIX"},
+    {UCC_COLL_TYPE_GATHER, "knomial", "GATHER_KN_RADIX"},
+    {UCC_COLL_TYPE_SCATTER, "knomial", "SCATTER_KN_RADIX"},
+};
+
+static const char *ucc_pt_tuner_radix_var(ucc_coll_type_t coll_type,
+                                          const std::string &alg)
+{
+    for (auto &r : ucc_pt_tuner_radix_cfgs) {
+        if (r.coll_type == coll_type && alg == r.alg) {
+            return r.var;
+        }
+    }
+    return nullptr;
+}
+
+template <typename T>
+static std::string ucc_pt_tuner_name(const std::map<std::string, T> &map,
+                                     T value)
+{
+    for (auto &e : map) {
+        if (e.second == value) {
+            return e.first;
+        }
+    }
+    return "unknown";
+}
+
+ucc_pt_tuner::ucc_pt_tuner(ucc_pt_config config, ucc_pt_comm *communicator):
+    cfg(config),
+    comm(communicator)
+{
+}
+
+ucc_status_t ucc_pt_tuner::get_candidates(ucc_coll_type_t coll_type,
+                                          std::vector<candidate> &cands)
+{
+    ucc_component_iface_t    *iface;
+    ucc_base_coll_alg_info_t *info;
+    const char               *var;
+    unsigned                  radix;
+    bool                      dup;
+
+    iface = ucc_get_component(&ucc_global_config.tl_framework, "ucp");
+    if (!iface) {
+        std::cerr << "TL/UCP is not available" << std::endl;
+        return UCC_ERR_NOT_FOUND;
+    }
+    info = ucc_derived_of(iface, ucc_tl_iface_t)->alg_info[
+        ucc_ilog2(coll_type)];
+    if (!info) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    for (; info->name; info++) {
+        var = ucc_pt_tuner_radix_var(coll_type, info->name);
+        if (!var) {
+            cands.push_back({info->name, 0});
+            continue;
+        }
+        for (auto r : cfg.tuner.radices) {
+            /* radices above the team size are equivalent */
+            radix = std::min(r, (unsigned)comm->get_size());
+            dup   = false;
+            for (auto &c : cands) {
+                dup |= (c.alg == info->name && c.radix == radix);
+            }
+            if (!dup) {
+                cands.push_back({info->name, radix});
+            }
+        }
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_pt_tuner::run_candidate(ucc_coll_type_t coll_type,
+                                         const candidate &cand, int cand_id,
+                                         std::vector<result> &results)
+{
+    ucc_pt_benchmark_config bench_cfg = cfg.bench;
+    const char *var = ucc_pt_tuner_radix_var(coll_type, cand.alg);
+    std::string tune;
+    ucc_pt_benchmark *bench;
+    ucc_status_t st;
+    size_t msgsize;
+    float time;
+    size_t i;
+
+    /* force the algorithm: max score over the whole msg range */
+    tune = ucc_pt_tuner_name(ucc_pt_coll_map, coll_type) + ":0-inf:" +
+           ucc_pt_tuner_name(ucc_pt_memtype_map, cfg.bench.mt) + ":inf:@" +
+           cand.alg;
+    setenv(UCC_PT_TUNER_ENV_PREFIX "TUNE", tune.c_str(), 1);
+    setenv(UCC_PT_TUNER_ENV_PREFIX "KN_RADIX", "0", 1);
+    if (var) {
+        setenv((std::string(UCC_PT_TUNER_ENV_PREFIX) + var).c_str(),
+               std::to_string(cand.radix).c_str(), 1);
+    }
+    /* TL config is read at lib init: recreate lib/context/team */
+    comm->finalize();
+    if (UCC_OK != comm->init()) {
+        std::cerr << "failed to reinit ucc for " << tune << std::endl;
+        std::exit(1);
+    }
+    bench_cfg.coll_type = coll_type;
+    bench = new ucc_pt_benchmark(bench_cfg, comm);
+    st    = UCC_OK;
+    i     = 0;
+    for (size_t cnt = cfg.bench.min_count; cnt <= cfg.bench.max_count;
+         cnt *= 2, i++) {
+        st = bench->run_count(cnt, msgsize, time);
+        if (st != UCC_OK) {
+            break;
+        }
+        if (i == results.size()) {
+            results.push_back({msgsize, time, cand_id});
+        } else if (time < results[i].time) {
+            results[i].time = time;
+            results[i].cand = cand_id;
+        }
+    }
+    delete bench;
+    if (var) {
+        unsetenv((std::string(UCC_PT_TUNER_ENV_PREFIX) + var).c_str());
+    }
+    return st;
+}
+
+ucc_status_t ucc_pt_tuner::tune_coll(ucc_coll_type_t coll_type)
+{
+    std::string coll_name = ucc_pt_tuner_name(ucc_pt_coll_map, coll_type);
+    std::string mem_name  = ucc_pt_tuner_name(ucc_pt_memtype_map,
+                                              cfg.bench.mt);
+    std::map<std::string, std::map<unsigned, int>> votes;
+    std::map<std::string, unsigned> radix;
+    std::vector<candidate> cands;
+    std::vector<result> results;
+    ucc_status_t st;
+    size_t i, j;
+
+    st = get_candidates(coll_type, cands);
+    if (st != UCC_OK) {
+        return st;
+    }
+    for (i = 0; i < cands.size(); i++) {
+        st = run_candidate(coll_type, cands[i], i, results);
+        if (st != UCC_OK && comm->get_rank() == 0) {
+            std::cerr << "skipping " << coll_name << " @" << cands[i].alg
+                      << ": " << ucc_status_string(st) << std::endl;
+        }
+    }
+    if (results.empty()) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    /* radix is a per algorithm setting: use the one winning the most sizes */
+    for (auto &r : results) {
+        if (cands[r.cand].radix) {
+            votes[cands[r.cand].alg][cands[r.cand].radix]++;
+        }
+    }
+    for (auto &v : votes) {
+        int max = 0;
+        for (auto &r : v.second) {
+            if (r.second > max) {
+                max            = r.second;
+                radix[v.first] = r.first;
+            }
+        }
+        radix_vars.push_back(
+            std::string(UCC_PT_TUNER_CFG_PREFIX) +
+            ucc_pt_tuner_radix_var(coll_type, v.first) + "=" +
+            std::to_string(radix[v.first]));
+    }
+    if (comm->get_rank() == 0) {
+        std::ios iostate(nullptr);
+        iostate.copyfmt(std::cout);
+        std::cout << std::left << std::setw(24)
+                  << "Collective: " << ucc_coll_type_str(coll_type)
+                  << std::endl;
+        std::cout << std::setw(12) << "Size" << std::setw(24) << "Algorithm"
+                  << std::setw(12) << "Radix" << std::setw(12) << "Time, us"
+                  << std::endl;
+        std::cout << std::setprecision(2) << std::fixed;
+        for (auto &r : results) {
+            std::cout << std::setw(12) << r.msgsize
+                      << std::setw(24) << cands[r.cand].alg
+                      << std::setw(12) << (cands[r.cand].radix ?
+                                           std::to_string(cands[r.cand].radix):
+                                           "N/A")
+                      << std::setw(12) << r.time << std::endl;
+        }
+        std::cout.copyfmt(iostate);
+        std::cout << std::endl;
+    }
+    /* merge the adjacent sizes with the same winner into a single range,
+       the first range starts at 0 and the last one is open ended */
+    for (i = 0; i < results.size(); i = j) {
+        for (j = i + 1; j < results.size() &&
+             cands[results[j].cand].alg == cands[results[i].cand].alg; j++) {
+        }
+        if (!tune_str.empty()) {
+            tune_str += "#";
+        }
+        tune_str += coll_name + ":" +
+                    std::to_string(i == 0 ? 0 : results[i].msgsize) + "-" +
+                    (j == results.size() ? std::string("inf") :
+                     std::to_string(results[j].msgsize)) + ":" + mem_name +
+                    ":[" + std::to_string(comm->get_size()) + "]:@" +
+                    cands[results[i].cand].alg;
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_pt_tuner::run() noexcept
+{
+    std::vector<ucc_coll_type_t> colls = cfg.tuner.colls;
+    std::string output = cfg.tuner.output;
+    ucc_pt_benchmark_config bench_cfg = cfg.bench;
+    ucc_status_t st;
+    int ppn;
+
+    if (colls.empty()) {
+        for (auto &c : ucc_pt_coll_map) {
+            colls.push_back(c.second);
+        }
+    }
+    for (auto c : colls) {
+        bench_cfg.coll_type = c;
+        try {
+            if (!ucc_pt_benchmark(bench_cfg, comm).has_range()) {
+                /* no msg ranges: nothing to tune */
+                continue;
+            }
+        } catch(std::exception &e) {
+            continue;
+        }
+        st = tune_coll(c);
+        if (st != UCC_OK && st != UCC_ERR_NOT_SUPPORTED) {
+            return st;
+        }
+    }
+    unsetenv(UCC_PT_TUNER_ENV_PREFIX "TUNE");
+    unsetenv(UCC_PT_TUNER_ENV_PREFIX "KN_RADIX");
+    ppn = comm->get_ppn();
+    if (comm->get_rank() != 0) {
+        return UCC_OK;
+    }
+    /* the table depends on the team size and the number of ranks per node */
+    if (output.empty()) {
+        output = "ucc_tune_n" + std::to_string(comm->get_size()) + "_ppn" +
+                 std::to_string(ppn) + ".conf";
+    }
+    std::ofstream out(output);
+    if (!out) {
+        std::cerr << "failed to open " << output << std::endl;
+        return UCC_ERR_NO_MESSAGE;
+    }
+    out << "# ucc_perftest tuning: team size " << comm->get_size()
+        << ", ppn " << ppn << ", memory type "
+        << ucc_pt_tuner_name(ucc_pt_memtype_map, cfg.bench.mt) << std::endl;
+    out << UCC_PT_TUNER_CFG_PREFIX "TUNE=" << tune_str << std::endl;
+    for (auto &v : radix_vars) {
+        out << v << std::endl;
+    }
+    std::cout << "Tuning table written to " << output << ":" << std::endl
+              << UCC_PT_TUNER_CFG_PREFIX "TUNE=" << tune_str << std::endl;
+    return UCC_OK;
+}
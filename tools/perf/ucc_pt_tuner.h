@@ -0,0 +1,45 @@
+/**
+ * Copyright (C) Mellanox Technologies Ltd. 2021.  ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_PT_TUNER_H
+#define UCC_PT_TUNER_H
+
+#include "ucc_pt_config.h"
+#include "ucc_pt_comm.h"
+#include <ucc/api/ucc.h>
+#include <string>
+#include <vector>
+
+/* Sweeps all the TL/UCP algorithms (and radices of the knomial ones) over
+   the msg range of the benchmark and generates the UCC_TL_UCP_TUNE string
+   selecting the fastest algorithm for every msgsize */
+class ucc_pt_tuner {
+    struct candidate {
+        std::string alg;
+        unsigned    radix;
+    };
+    struct result {
+        size_t msgsize;
+        float  time;
+        int    cand;
+    };
+    ucc_pt_config cfg;
+    ucc_pt_comm  *comm;
+    std::string   tune_str;
+    std::vector<std::string> radix_vars;
+
+    ucc_status_t get_candidates(ucc_coll_type_t coll_type,
+                                std::vector<candidate> &cands);
+    ucc_status_t run_candidate(ucc_coll_type_t coll_type,
+                               const candidate &cand, int cand_id,
+                               std::vector<result> &results);
+    ucc_status_t tune_coll(ucc_coll_type_t coll_type);
+public:
+    ucc_pt_tuner(ucc_pt_config config, ucc_pt_comm *communicator);
+    ucc_status_t run() noexcept;
+};
+
+#endif